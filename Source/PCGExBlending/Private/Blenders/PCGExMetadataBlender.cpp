@@ -112,6 +112,20 @@ namespace PCGExBlending
 		}
 	}
 
+	void FMetadataBlender::BlendRange(TConstArrayView<int32> SourceIndices, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const
+	{
+		BlendRange(SourceIndices, TargetIndices, TargetIndices, Weights);
+	}
+
+	void FMetadataBlender::BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const
+	{
+		// Attribute-major: each blender streams the whole span through its typed kernel
+		for (int i = 0; i < Blenders.Num(); i++)
+		{
+			Blenders[i]->BlendRange(SourceIndicesA, SourceIndicesB, TargetIndices, Weights);
+		}
+	}
+
 	void FMetadataBlender::InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		Trackers.SetNumUninitialized(Blenders.Num());
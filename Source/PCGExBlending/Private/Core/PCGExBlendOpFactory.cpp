@@ -375,6 +375,14 @@ void FPCGExBlendOperation::Blend(const int32 SourceIndexA, const int32 SourceInd
 	Blender->Blend(SourceIndexA, SourceIndexB, TargetIndex, Config.Weighting.ScoreLUT->Eval(InWeight));
 }
 
+void FPCGExBlendOperation::BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> InWeights)
+{
+	TArray<double> Weights(InWeights.GetData(), InWeights.Num());
+	Config.Weighting.ScoreLUT->EvalInPlace(Weights);
+
+	Blender->BlendRange(SourceIndicesA, SourceIndicesB, TargetIndices, Weights);
+}
+
 void FPCGExBlendOperation::BlendScope(const PCGExMT::FScope& Scope)
 {
 	TArray<double> Weights;
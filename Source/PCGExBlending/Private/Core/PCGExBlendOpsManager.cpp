@@ -270,6 +270,19 @@ namespace PCGExBlending
 		}
 	}
 
+	void FBlendOpsManager::BlendRange(TConstArrayView<int32> SourceIndices, TConstArrayView<int32> TargetIndices, TConstArrayView<double> InWeights) const
+	{
+		BlendRange(SourceIndices, TargetIndices, TargetIndices, InWeights);
+	}
+
+	void FBlendOpsManager::BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> InWeights) const
+	{
+		for (const auto Op : CachedOperations)
+		{
+			Op->BlendRange(SourceIndicesA, SourceIndicesB, TargetIndices, InWeights);
+		}
+	}
+
 	void FBlendOpsManager::BlendAutoWeight(const PCGExMT::FScope& Scope) const
 	{
 		for (const auto Op : CachedOperations)
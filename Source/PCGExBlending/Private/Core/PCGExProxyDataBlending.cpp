@@ -63,84 +63,113 @@ namespace PCGExBlending
 		C->SetVoid(TargetIndex, ValC.GetRaw());
 	}
 
-	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, const double Weight) const
+	void FProxyDataBlender::BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const
 	{
 		if (!Operation || !A || !C)
 		{
 			return;
 		}
 
-		PCGExTypes::FScopedTypedValue ValA = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValB = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValC = MakeScopedValue();
+		const int32 NumBlends = TargetIndices.Num();
+		check(SourceIndicesA.Num() == NumBlends && SourceIndicesB.Num() == NumBlends && Weights.Num() == NumBlends)
 
-		PCGEX_SCOPE_LOOP(Index)
+		const int32 Stride = Operation->GetValueSize();
+		const bool bPacked = !bNeedsLifecycleManagement && Operation->SupportsRange()
+			&& A->GetValueSize() == Stride && B->GetValueSize() == Stride && C->GetValueSize() == Stride;
+
+		if (!bPacked)
 		{
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
+			PCGExTypes::FScopedTypedValue ValA = MakeScopedValue();
+			PCGExTypes::FScopedTypedValue ValB = MakeScopedValue();
+			PCGExTypes::FScopedTypedValue ValC = MakeScopedValue();
+
+			for (int32 i = 0; i < NumBlends; i++)
+			{
+				A->GetVoid(SourceIndicesA[i], ValA.GetRaw());
+				B->GetVoid(SourceIndicesB[i], ValB.GetRaw());
+
+				Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[i], ValC.GetRaw());
+				C->SetVoid(TargetIndices[i], ValC.GetRaw());
+			}
 
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weight, ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
+			return;
 		}
-	}
 
-	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
-	{
-		if (!Operation || !A || !C)
+		// Small chunks keep the packed A/B/C working set in L1 regardless of value size
+		constexpr int32 ChunkSize = 64;
+
+		TArray<uint8, TAlignedHeapAllocator<16>> Scratch;
+		Scratch.SetNumUninitialized(3 * ChunkSize * Stride);
+
+		uint8* ValsA = Scratch.GetData();
+		uint8* ValsB = ValsA + ChunkSize * Stride;
+		uint8* ValsC = ValsB + ChunkSize * Stride;
+
+		for (int32 Start = 0; Start < NumBlends; Start += ChunkSize)
 		{
-			return;
+			const int32 Count = FMath::Min(ChunkSize, NumBlends - Start);
+
+			A->GetVoids(SourceIndicesA.Slice(Start, Count), ValsA);
+			B->GetVoids(SourceIndicesB.Slice(Start, Count), ValsB);
+
+			Operation->BlendRange(ValsA, ValsB, Weights.GetData() + Start, ValsC, Count);
+			C->SetVoids(TargetIndices.Slice(Start, Count), ValsC);
 		}
+	}
 
-		PCGExTypes::FScopedTypedValue ValA = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValB = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValC = MakeScopedValue();
+	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, const double Weight) const
+	{
+		TArray<int32> Indices;
+		TArray<double> Weights;
+		Indices.SetNumUninitialized(Scope.Count);
+		Weights.Init(Weight, Scope.Count);
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[Index - Scope.Start], ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
+			Indices[Index - Scope.Start] = Index;
 		}
+
+		BlendRange(Indices, Indices, Indices, Weights);
 	}
 
-	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const
+	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
 	{
-		if (!Operation || !A || !C)
+		TArray<int32> Indices;
+		Indices.SetNumUninitialized(Scope.Count);
+
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			return;
+			Indices[Index - Scope.Start] = Index;
 		}
 
-		PCGExTypes::FScopedTypedValue ValA = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValB = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValC = MakeScopedValue();
+		BlendRange(Indices, Indices, Indices, TConstArrayView<double>(Weights.GetData(), Scope.Count));
+	}
+
+	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const
+	{
+		TArray<int32> Indices;
+		Indices.Reserve(Scope.Count);
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			if (!Mask[Index - Scope.Start])
+			if (Mask[Index - Scope.Start])
 			{
-				continue;
+				Indices.Add(Index);
 			}
+		}
 
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
+		TArray<double> Weights;
+		Weights.Init(Weight, Indices.Num());
 
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weight, ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		BlendRange(Indices, Indices, Indices, Weights);
 	}
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, TArrayView<const double> Weights) const
 	{
-		if (!Operation || !A || !C)
-		{
-			return;
-		}
-
-		PCGExTypes::FScopedTypedValue ValA = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValB = MakeScopedValue();
-		PCGExTypes::FScopedTypedValue ValC = MakeScopedValue();
+		TArray<int32> Indices;
+		TArray<double> MaskedWeights;
+		Indices.Reserve(Scope.Count);
+		MaskedWeights.Reserve(Scope.Count);
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
@@ -150,12 +179,11 @@ namespace PCGExBlending
 				continue;
 			}
 
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[i], ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
+			Indices.Add(Index);
+			MaskedWeights.Add(Weights[i]);
 		}
+
+		BlendRange(Indices, Indices, Indices, MaskedWeights);
 	}
 
 	PCGEx::FOpStats FProxyDataBlender::BeginMultiBlend(const int32 TargetIndex)
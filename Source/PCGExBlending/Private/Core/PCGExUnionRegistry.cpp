@@ -2,9 +2,12 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Core/PCGExUnionRegistry.h"
+#include "Async/ParallelFor.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGBasePointData.h"
 #include "Details/PCGExFuseDetails.h"
 #include "Math/PCGExMath.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExData
 {
@@ -63,4 +66,277 @@ namespace PCGExData
 		}
 		return Insert(Point);
 	}
+
+	namespace UnionRegistryInternal
+	{
+		constexpr int32 CellBits = 21;
+		constexpr int32 MaxCellCoord = (1 << CellBits) - 1;
+
+		FORCEINLINE uint64 PackCell(const int32 X, const int32 Y, const int32 Z)
+		{
+			return (static_cast<uint64>(X) << (CellBits * 2)) | (static_cast<uint64>(Y) << CellBits) | static_cast<uint64>(Z);
+		}
+
+		FORCEINLINE FIntVector UnpackCell(const uint64 Key)
+		{
+			return FIntVector(
+				static_cast<int32>((Key >> (CellBits * 2)) & MaxCellCoord),
+				static_cast<int32>((Key >> CellBits) & MaxCellCoord),
+				static_cast<int32>(Key & MaxCellCoord));
+		}
+	}
+
+	void FUnionRegistry::FuseParallel(TConstArrayView<FConstPoint> Points, const FPCGExFuseDetails& FuseDetails, TArray<int32>& OutRepIndices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionRegistry::FuseParallel);
+
+		using namespace UnionRegistryInternal;
+
+		check(Reps.IsEmpty())
+
+		const int32 NumPoints = Points.Num();
+		OutRepIndices.SetNumUninitialized(NumPoints);
+		if (NumPoints == 0)
+		{
+			return;
+		}
+
+		// Same broad phase (query box vs. rep bounds) and narrow phase as Find, evaluated once per point
+		TArray<FVector> Locations;
+		TArray<FBox> QueryBoxes;
+		TArray<FBox> WorldBounds;
+		Locations.SetNumUninitialized(NumPoints);
+		QueryBoxes.SetNumUninitialized(NumPoints);
+		WorldBounds.SetNumUninitialized(NumPoints);
+
+		PCGExMT::ParallelOrSequential(
+			NumPoints, [&](const int32 i)
+			{
+				const FConstPoint& Point = Points[i];
+				Locations[i] = Point.GetLocation();
+				QueryBoxes[i] = FuseDetails.GetOctreeBox(Locations[i], Point.Index);
+				WorldBounds[i] = Point.Data->GetLocalBounds(Point.Index).TransformBy(Point.Data->GetTransform(Point.Index));
+			});
+
+		auto IsMatch = [&](const int32 Source, const int32 Target)
+		{
+			if (!QueryBoxes[Source].Intersect(WorldBounds[Target]))
+			{
+				return false;
+			}
+			return FuseDetails.bComponentWiseTolerance
+				? FuseDetails.IsWithinToleranceComponentWise(Points[Source], Points[Target])
+				: FuseDetails.IsWithinTolerance(Points[Source], Points[Target]);
+		};
+
+		// Cell size must cover the farthest a match can sit from a point's location. Center-to-center
+		// matching never exceeds the tolerance; bounds-based distances can reach as far as the bounds do.
+		const bool bUsesBounds = FuseDetails.SourceDistance != EPCGExDistance::Center || FuseDetails.TargetDistance != EPCGExDistance::Center;
+
+		FBox LocationBounds(ForceInit);
+		FVector Reach = FVector::ZeroVector;
+		FVector BoundsReach = FVector::ZeroVector;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			LocationBounds += Locations[i];
+			Reach = Reach.ComponentMax(QueryBoxes[i].GetExtent());
+			if (bUsesBounds)
+			{
+				BoundsReach = BoundsReach.ComponentMax((WorldBounds[i].Max - Locations[i]).ComponentMax(Locations[i] - WorldBounds[i].Min));
+			}
+		}
+
+		const FVector CellSize = (Reach + BoundsReach)
+		                         .ComponentMax(LocationBounds.GetSize() / (MaxCellCoord - 1))
+		                         .ComponentMax(FVector(UE_KINDA_SMALL_NUMBER));
+		const FVector InvCellSize = FVector(1.0) / CellSize;
+		const FVector Origin = LocationBounds.Min;
+
+		// Group points by cell; the stable sort keeps array order within each cell
+		TArray<PCGEx::FIndexKey> Sorted;
+		Sorted.SetNumUninitialized(NumPoints);
+		PCGExMT::ParallelOrSequential(
+			NumPoints, [&](const int32 i)
+			{
+				const FVector Cell = (Locations[i] - Origin) * InvCellSize;
+				Sorted[i] = PCGEx::FIndexKey(
+					i, PackCell(
+						FMath::Clamp(FMath::FloorToInt32(Cell.X), 0, MaxCellCoord),
+						FMath::Clamp(FMath::FloorToInt32(Cell.Y), 0, MaxCellCoord),
+						FMath::Clamp(FMath::FloorToInt32(Cell.Z), 0, MaxCellCoord)));
+			});
+
+		PCGExSortingHelpers::RadixSort(Sorted);
+
+		TArray<int32> CellStarts;
+		TMap<uint64, int32> CellLookup;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (i == 0 || Sorted[i].Key != Sorted[i - 1].Key)
+			{
+				CellLookup.Add(Sorted[i].Key, CellStarts.Add(i));
+			}
+		}
+		const int32 NumCells = CellStarts.Num();
+		CellStarts.Add(NumPoints);
+
+		// Pass 1 -- sequential rules within each cell. Leaders[i] is the founding point of i's in-cell rep,
+		// LeaderCenters[Leader] that rep's center once the cell is done.
+		TArray<int32> Leaders;
+		TArray<FVector> LeaderCenters;
+		Leaders.SetNumUninitialized(NumPoints);
+		LeaderCenters.SetNumUninitialized(NumPoints);
+		TArray<TArray<int32>> CellReps;
+		CellReps.SetNum(NumCells);
+
+		ParallelFor(
+			NumCells, [&](const int32 CellIndex)
+			{
+				TArray<int32>& LocalReps = CellReps[CellIndex];
+				TArray<FVector, TInlineAllocator<8>> LocalAccum;
+				TArray<int32, TInlineAllocator<8>> LocalCounts;
+
+				for (int32 s = CellStarts[CellIndex]; s < CellStarts[CellIndex + 1]; s++)
+				{
+					const int32 i = Sorted[s].Index;
+					PCGExMath::FClosestPosition Closest(Locations[i]);
+
+					for (int32 r = 0; r < LocalReps.Num(); r++)
+					{
+						if (IsMatch(i, LocalReps[r]))
+						{
+							Closest.Update(LocalAccum[r] / static_cast<double>(LocalCounts[r]), r);
+						}
+					}
+
+					if (Closest.bValid)
+					{
+						LocalAccum[Closest.Index] += Locations[i];
+						LocalCounts[Closest.Index]++;
+						Leaders[i] = LocalReps[Closest.Index];
+					}
+					else
+					{
+						LocalReps.Add(i);
+						LocalAccum.Add(Locations[i]);
+						LocalCounts.Add(1);
+						Leaders[i] = i;
+					}
+				}
+
+				for (int32 r = 0; r < LocalReps.Num(); r++)
+				{
+					LeaderCenters[LocalReps[r]] = LocalAccum[r] / static_cast<double>(LocalCounts[r]);
+				}
+			}, NumCells < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+		// Pass 2 -- each rep tests the earlier reps of its 26 neighbor cells, as it would have on insertion
+		TArray<TArray<TPair<int32, int32>>> CellMatches;
+		CellMatches.SetNum(NumCells);
+
+		ParallelFor(
+			NumCells, [&](const int32 CellIndex)
+			{
+				const FIntVector Cell = UnpackCell(Sorted[CellStarts[CellIndex]].Key);
+
+				for (int32 X = Cell.X - 1; X <= Cell.X + 1; X++)
+				{
+					for (int32 Y = Cell.Y - 1; Y <= Cell.Y + 1; Y++)
+					{
+						for (int32 Z = Cell.Z - 1; Z <= Cell.Z + 1; Z++)
+						{
+							if ((X == Cell.X && Y == Cell.Y && Z == Cell.Z) ||
+								X < 0 || Y < 0 || Z < 0 || X > MaxCellCoord || Y > MaxCellCoord || Z > MaxCellCoord)
+							{
+								continue;
+							}
+
+							const int32* Neighbor = CellLookup.Find(PackCell(X, Y, Z));
+							if (!Neighbor)
+							{
+								continue;
+							}
+
+							for (const int32 Rep : CellReps[CellIndex])
+							{
+								for (const int32 Other : CellReps[*Neighbor])
+								{
+									if (Other < Rep && IsMatch(Rep, Other))
+									{
+										CellMatches[CellIndex].Emplace(Rep, Other);
+									}
+								}
+							}
+						}
+					}
+				}
+			}, NumCells < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+		// Pass 3 -- index-ordered absorption, as FindOrInsert would have seen it: a rep whose earlier matches
+		// all got absorbed founds its own, otherwise it joins the closest surviving one. Absorbed reps absorb
+		// nothing further and reps never chain, so matches don't propagate transitively.
+		TArray<TPair<int32, int32>> Matches;
+		for (const TArray<TPair<int32, int32>>& Local : CellMatches)
+		{
+			Matches.Append(Local);
+		}
+		CellMatches.Empty();
+
+		Matches.Sort(
+			[](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+			{
+				return A.Key == B.Key ? A.Value < B.Value : A.Key < B.Key;
+			});
+
+		TArray<int32> Absorbed;
+		Absorbed.Init(INDEX_NONE, NumPoints);
+
+		for (int32 m = 0; m < Matches.Num();)
+		{
+			const int32 Rep = Matches[m].Key;
+			PCGExMath::FClosestPosition Closest(Locations[Rep]);
+
+			for (; m < Matches.Num() && Matches[m].Key == Rep; m++)
+			{
+				// Earlier reps are already settled
+				const int32 Other = Matches[m].Value;
+				if (Absorbed[Other] == INDEX_NONE)
+				{
+					Closest.Update(LeaderCenters[Other], Other);
+				}
+			}
+
+			if (Closest.bValid)
+			{
+				Absorbed[Rep] = Closest.Index;
+			}
+		}
+
+		// A surviving rep is the first point of everything it ends up with, so numbering survivors in array
+		// order numbers reps by first appearance
+		TArray<int32> LeaderToRep;
+		LeaderToRep.Init(INDEX_NONE, NumPoints);
+		int32 NumReps = 0;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			const int32 Leader = Absorbed[Leaders[i]] == INDEX_NONE ? Leaders[i] : Absorbed[Leaders[i]];
+			if (LeaderToRep[Leader] == INDEX_NONE)
+			{
+				LeaderToRep[Leader] = NumReps++;
+			}
+			OutRepIndices[i] = LeaderToRep[Leader];
+		}
+
+		Reps.SetNum(NumReps);
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			FRep& Rep = Reps[OutRepIndices[i]];
+			if (Rep.FuseCount == 0)
+			{
+				Rep.Point = Points[i];
+				Rep.RepIndex = OutRepIndices[i];
+			}
+			Rep.Accumulate(Locations[i]);
+		}
+	}
 }
@@ -145,6 +145,11 @@ EPCGExFuseMethod FPCGExFuseDetails::GetEffectiveMethod() const
 	return FuseMethod;
 }
 
+bool FPCGExFuseDetails::UseParallelOctree() const
+{
+	return bParallelOctree && GetEffectiveMethod() == EPCGExFuseMethod::Octree;
+}
+
 uint64 FPCGExFuseDetails::GetGridKey(const FVector& Location, const int32 PointIndex) const
 {
 	return PCGEx::SH3(Location + VoxelGridOffset, PCGEx::SafeTolerance(ToleranceGetter->Read(PointIndex)));
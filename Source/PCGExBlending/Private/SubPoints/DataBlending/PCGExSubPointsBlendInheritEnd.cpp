@@ -11,14 +11,10 @@
 
 void FPCGExSubPointsBlendInheritEnd::BlendSubPoints(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, PCGExData::FScope& Scope, const PCGExPaths::FPathMetrics& Metrics) const
 {
-	TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
+	TArray<double> Weights;
+	Weights.Init(1, Scope.Count);
 
-	PCGEX_SCOPE_LOOP(Index)
-	{
-		//FVector Location = OutTransform[Index].GetLocation();
-		MetadataBlender->Blend(From.Index, To.Index, Index, 1);
-		//OutTransform[Index].SetLocation(Location);
-	}
+	BlendScope(From, To, Scope, Weights);
 }
 
 TSharedPtr<FPCGExSubPointsBlendOperation> UPCGExSubPointsBlendInheritEnd::CreateOperation() const
@@ -12,14 +12,10 @@
 
 void FPCGExSubPointsBlendInheritStart::BlendSubPoints(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, PCGExData::FScope& Scope, const PCGExPaths::FPathMetrics& Metrics) const
 {
-	TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-	PCGEX_SCOPE_LOOP(Index)
-	{
-		//FVector Location = OutTransform[Index].GetLocation();
-		MetadataBlender->Blend(From.Index, To.Index, Index, 0);
-		//OutTransform[Index].SetLocation(Location);
-	}
+	TArray<double> Weights;
+	Weights.Init(0, Scope.Count);
+
+	BlendScope(From, To, Scope, Weights);
 }
 
 TSharedPtr<FPCGExSubPointsBlendOperation> UPCGExSubPointsBlendInheritStart::CreateOperation() const
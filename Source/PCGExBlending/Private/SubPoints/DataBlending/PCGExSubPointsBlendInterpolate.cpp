@@ -19,41 +19,38 @@ void FPCGExSubPointsBlendInterpolate::BlendSubPoints(const PCGExData::FConstPoin
 		SafeBlendOver = EPCGExBlendOver::Index;
 	}
 
+	TArray<double> Weights;
+	Weights.SetNumUninitialized(Scope.Count);
+
 	if (SafeBlendOver == EPCGExBlendOver::Distance)
 	{
 		PCGExPaths::FPathMetrics PathMetrics = PCGExPaths::FPathMetrics(From.GetLocation());
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
+		TConstPCGValueRange<FTransform> InTransform = Scope.Data->GetConstTransformValueRange();
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Metrics.GetTime(PathMetrics.Add(Location)));
-			//OutTransform[Index].SetLocation(Location);
+			Weights[Index - Scope.Start] = Metrics.GetTime(PathMetrics.Add(InTransform[Index].GetLocation()));
 		}
 	}
 	else if (SafeBlendOver == EPCGExBlendOver::Index)
 	{
 		const double Divider = Scope.Count;
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			//FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Index / Divider);
-			//OutTransform[Index].SetLocation(Location);
+			Weights[Index - Scope.Start] = Index / Divider;
 		}
 	}
 	else if (SafeBlendOver == EPCGExBlendOver::Fixed)
 	{
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			//FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Lerp);
-			//OutTransform[Index].SetLocation(Location);
-		}
+		Weights.Init(Lerp, Scope.Count);
+	}
+	else
+	{
+		return;
 	}
+
+	BlendScope(From, To, Scope, Weights);
 }
 
 void UPCGExSubPointsBlendInterpolate::CopySettingsFrom(const UPCGExInstancedFactory* Other)
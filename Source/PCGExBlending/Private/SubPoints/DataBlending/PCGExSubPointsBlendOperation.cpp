@@ -67,6 +67,53 @@ void FPCGExSubPointsBlendOperation::BlendSubPoints(PCGExData::FScope& Scope, con
 	BlendSubPoints(Scope.CFirst(), Scope.CLast(), Scope, Metrics);
 }
 
+void FPCGExSubPointsBlendOperation::BlendScope(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FScope& Scope, TConstArrayView<double> Weights) const
+{
+	check(Weights.Num() == Scope.Count)
+
+	TArray<int32> FromIndices;
+	TArray<int32> ToIndices;
+	TArray<int32> TargetIndices;
+	FromIndices.Init(From.Index, Scope.Count);
+	ToIndices.Init(To.Index, Scope.Count);
+	TargetIndices.SetNumUninitialized(Scope.Count);
+
+	PCGEX_SCOPE_LOOP(Index)
+	{
+		TargetIndices[Index - Scope.Start] = Index;
+	}
+
+	// When the scope contains its own endpoints, writing them changes what every later point reads.
+	// Those are blended on their own, in order, and only the runs in between go through the range path.
+	int32 RunStart = 0;
+	auto FlushRun = [&](const int32 RunEnd)
+	{
+		if (const int32 RunCount = RunEnd - RunStart; RunCount > 0)
+		{
+			MetadataBlender->BlendRange(
+				TConstArrayView<int32>(FromIndices).Slice(RunStart, RunCount),
+				TConstArrayView<int32>(ToIndices).Slice(RunStart, RunCount),
+				TConstArrayView<int32>(TargetIndices).Slice(RunStart, RunCount),
+				Weights.Slice(RunStart, RunCount));
+		}
+	};
+
+	PCGEX_SCOPE_LOOP(Index)
+	{
+		if (Index != From.Index && Index != To.Index)
+		{
+			continue;
+		}
+
+		const int32 i = Index - Scope.Start;
+		FlushRun(i);
+		MetadataBlender->Blend(From.Index, To.Index, Index, Weights[i]);
+		RunStart = i + 1;
+	}
+
+	FlushRun(Scope.Count);
+}
+
 UPCGExSubPointsBlendInstancedFactory::UPCGExSubPointsBlendInstancedFactory(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
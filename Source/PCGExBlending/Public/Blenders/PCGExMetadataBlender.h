@@ -40,6 +40,9 @@ namespace PCGExBlending
 		virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double Weight) const override;
 		virtual void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const int32 TargetIndex, const double Weight) const override;
 
+		virtual void BlendRange(TConstArrayView<int32> SourceIndices, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const override;
+		virtual void BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const override;
+
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const override;
 
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override;
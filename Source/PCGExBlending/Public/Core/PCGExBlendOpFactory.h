@@ -195,6 +195,7 @@ public:
 	virtual void BlendAutoWeight(const int32 SourceIndex, const int32 TargetIndex);
 	virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight);
 	virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double InWeight);
+	virtual void BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> InWeights);
 
 	virtual void BlendScope(const PCGExMT::FScope& Scope);
 	virtual void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask);
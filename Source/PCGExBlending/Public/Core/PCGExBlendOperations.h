@@ -26,6 +26,9 @@ namespace PCGExBlending
 	// Finalize: Acc = Finalize(Acc, TotalWeight, Count)
 	using FFinalizeFn = void (*)(void* Accumulator, double TotalWeight, int32 Count);
 
+	// Range blend over densely packed values: Out[i] = Blend(A[i], B[i], Weights[i])
+	using FBlendRangeFn = void (*)(const void* A, const void* B, const double* Weights, void* Out, int32 Count);
+
 	//
 	// IBlendOperation - Type-erased interface for blend operations
 	//
@@ -43,6 +46,7 @@ namespace PCGExBlending
 		FBlendFn BlendFunc = nullptr;
 		FBlendFn AccumulateFunc = nullptr;
 		FFinalizeFn FinalizeFunc = nullptr;
+		FBlendRangeFn BlendRangeFunc = nullptr;
 
 	public:
 		IBlendOperation(EPCGExABBlendingType InMode, bool bInResetForMulti);
@@ -56,6 +60,32 @@ namespace PCGExBlending
 			BlendFunc(A, B, Weight, Out);
 		}
 
+		// Range blend over Count densely packed values (stride GetValueSize()).
+		// Typed ops run a flat per-type kernel; everything else falls back to one Blend per element.
+		virtual void BlendRange(const void* A, const void* B, const double* Weights, void* Out, const int32 Count) const
+		{
+			if (BlendRangeFunc)
+			{
+				BlendRangeFunc(A, B, Weights, Out, Count);
+				return;
+			}
+
+			const int32 Stride = GetValueSize();
+			const uint8* InA = static_cast<const uint8*>(A);
+			const uint8* InB = static_cast<const uint8*>(B);
+			uint8* OutC = static_cast<uint8*>(Out);
+			for (int32 i = 0; i < Count; i++)
+			{
+				Blend(InA + i * Stride, InB + i * Stride, Weights[i], OutC + i * Stride);
+			}
+		}
+
+		// Whether BlendRange has a typed kernel (packed buffers can be handed over as raw memory)
+		FORCEINLINE bool SupportsRange() const
+		{
+			return BlendRangeFunc != nullptr;
+		}
+
 		// Multi-blend operations for accumulation patterns
 		virtual void BeginMulti(void* Accumulator, const void* InitialValue, PCGEx::FOpStats& OutTracker) const
 		{
@@ -328,6 +358,85 @@ namespace PCGExBlending
 			}
 		}
 
+		// Typed span kernel. The element function is a template argument, so it inlines into a flat
+		// loop over T that the compiler can vectorize for scalar and vector lanes.
+		template <typename T, FBlendFn Fn>
+		void BlendRange(const void* A, const void* B, const double* Weights, void* Out, const int32 Count)
+		{
+			const T* RESTRICT InA = static_cast<const T*>(A);
+			const T* RESTRICT InB = static_cast<const T*>(B);
+			T* RESTRICT OutC = static_cast<T*>(Out);
+
+			for (int32 i = 0; i < Count; i++)
+			{
+				Fn(InA + i, InB + i, Weights[i], OutC + i);
+			}
+		}
+
+		// Get range blend function pointer by mode (mirrors GetBlendFunction)
+		template <typename T>
+		FBlendRangeFn GetBlendRangeFunction(const EPCGExABBlendingType Mode)
+		{
+			switch (Mode)
+			{
+			case EPCGExABBlendingType::Add:
+				return &BlendRange<T, &Add<T>>;
+			case EPCGExABBlendingType::Subtract:
+				return &BlendRange<T, &Sub<T>>;
+			case EPCGExABBlendingType::Multiply:
+				return &BlendRange<T, &Mult<T>>;
+			case EPCGExABBlendingType::Divide:
+				return &BlendRange<T, &Divide<T>>;
+			case EPCGExABBlendingType::Lerp:
+				return &BlendRange<T, &Lerp<T>>;
+			case EPCGExABBlendingType::Min:
+				return &BlendRange<T, &Min<T>>;
+			case EPCGExABBlendingType::Max:
+				return &BlendRange<T, &Max<T>>;
+			case EPCGExABBlendingType::Average:
+				return &BlendRange<T, &Average<T>>;
+			case EPCGExABBlendingType::Weight:
+				return &BlendRange<T, &Weight<T>>;
+			case EPCGExABBlendingType::WeightedAdd:
+				return &BlendRange<T, &WeightedAdd<T>>;
+			case EPCGExABBlendingType::WeightedSubtract:
+				return &BlendRange<T, &WeightedSub<T>>;
+			case EPCGExABBlendingType::CopyTarget:
+				return &BlendRange<T, &CopyA<T>>;
+			case EPCGExABBlendingType::CopySource:
+				return &BlendRange<T, &CopyB<T>>;
+			case EPCGExABBlendingType::UnsignedMin:
+				return &BlendRange<T, &UnsignedMin<T>>;
+			case EPCGExABBlendingType::UnsignedMax:
+				return &BlendRange<T, &UnsignedMax<T>>;
+			case EPCGExABBlendingType::AbsoluteMin:
+				return &BlendRange<T, &AbsoluteMin<T>>;
+			case EPCGExABBlendingType::AbsoluteMax:
+				return &BlendRange<T, &AbsoluteMax<T>>;
+			case EPCGExABBlendingType::Hash:
+				return &BlendRange<T, &NaiveHash<T>>;
+			case EPCGExABBlendingType::UnsignedHash:
+				return &BlendRange<T, &UnsignedHash<T>>;
+			case EPCGExABBlendingType::Mod:
+				return &BlendRange<T, &ModSimple<T>>;
+			case EPCGExABBlendingType::ModCW:
+				return &BlendRange<T, &ModComplex<T>>;
+			case EPCGExABBlendingType::WeightNormalize:
+				return &BlendRange<T, &Weight<T>>; // TBD
+			case EPCGExABBlendingType::GeometricMean:
+				return &BlendRange<T, &Weight<T>>; // TBD
+			case EPCGExABBlendingType::HarmonicMean:
+				return &BlendRange<T, &Weight<T>>; // TBD
+			case EPCGExABBlendingType::RMS:
+				return &BlendRange<T, &Weight<T>>; // TBD
+			case EPCGExABBlendingType::Step:
+				return &BlendRange<T, &Weight<T>>; // TBD
+			case EPCGExABBlendingType::None:
+			default:
+				return &BlendRange<T, &None<T>>;
+			}
+		}
+
 		// Get accumulate blend function pointer by mode
 		template <typename T>
 		FBlendFn GetAccumulateFunction(const EPCGExABBlendingType Mode)
@@ -440,6 +549,12 @@ namespace PCGExBlending
 			BlendFunc = BlendFunctions::GetBlendFunction<T>(InMode);
 			AccumulateFunc = BlendFunctions::GetAccumulateFunction<T>(InMode);
 			FinalizeFunc = BlendFunctions::GetFinalizeFunction<T>(InMode);
+
+			// Packed scratch is raw memory, so only trivially copyable types get a span kernel
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				BlendRangeFunc = BlendFunctions::GetBlendRangeFunction<T>(InMode);
+			}
 		}
 
 		//~ Begin IBlendOperation interface
@@ -87,6 +87,9 @@ namespace PCGExBlending
 		virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight) const override;
 		virtual void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const int32 TargetIndex, const double InWeight) const override;
 
+		virtual void BlendRange(TConstArrayView<int32> SourceIndices, TConstArrayView<int32> TargetIndices, TConstArrayView<double> InWeights) const override;
+		virtual void BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> InWeights) const override;
+
 		void BlendAutoWeight(const PCGExMT::FScope& Scope) const;
 		void BlendAutoWeight(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask) const;
 
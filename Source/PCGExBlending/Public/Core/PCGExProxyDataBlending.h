@@ -78,6 +78,23 @@ namespace PCGExBlending
 		// Target = SourceA|SourceB
 		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight) const = 0;
 
+		// Target[i] = Source[i]|Target[i]
+		virtual void BlendRange(TConstArrayView<int32> SourceIndices, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const
+		{
+			BlendRange(SourceIndices, TargetIndices, TargetIndices, Weights);
+		}
+
+		// Target[i] = SourceA[i]|SourceB[i]
+		// Span entry point so implementations can blend attribute-major instead of point-major.
+		// A target must not be read as a source by another entry of the same call.
+		virtual void BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const
+		{
+			for (int32 i = 0; i < TargetIndices.Num(); i++)
+			{
+				Blend(SourceIndicesA[i], SourceIndicesB[i], TargetIndices[i], Weights[i]);
+			}
+		}
+
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual void MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double Weight, TArray<PCGEx::FOpStats>& Tracker) const = 0;
 		virtual void EndMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Tracker) const = 0;
@@ -107,6 +124,14 @@ namespace PCGExBlending
 		{
 		}
 
+		virtual void BlendRange(TConstArrayView<int32> SourceIndices, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const override
+		{
+		}
+
+		virtual void BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const override
+		{
+		}
+
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override
 		{
 		}
@@ -243,6 +268,11 @@ namespace PCGExBlending
 		// Target = SourceA|SourceB
 		void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight) const;
 
+		// Target[i] = SourceA[i]|SourceB[i]
+		// Gathers A/B into packed chunks, runs the operation's typed span kernel and scatters into C.
+		// Falls back to per-element Blend for types without one (containers, strings, copy-only).
+		void BlendRange(TConstArrayView<int32> SourceIndicesA, TConstArrayView<int32> SourceIndicesB, TConstArrayView<int32> TargetIndices, TConstArrayView<double> Weights) const;
+
 		// 1:1 Range blending
 		void BlendScope(const PCGExMT::FScope& Scope, const double Weight) const;
 		void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const;
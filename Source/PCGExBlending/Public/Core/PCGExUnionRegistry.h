@@ -21,6 +21,9 @@ namespace PCGExData
 	//   - tolerance check uses each rep's *original* Point (stable)
 	//   - closest-rep tie-break uses each rep's *running* Center (drifts as points accumulate)
 	//   - on match, the matching rep's running mean is updated
+	//
+	// FuseParallel is the batch alternative: same matching rules, applied per tolerance-sized cell
+	// in parallel, then reconciled across cell borders. See its comment for how results differ.
 	class PCGEXBLENDING_API FUnionRegistry
 	{
 	public:
@@ -58,6 +61,18 @@ namespace PCGExData
 		// running Center and returns its RepIndex. On miss, inserts a new rep and returns its index.
 		int32 FindOrInsert(const FConstPoint& Point, const FPCGExFuseDetails& FuseDetails);
 
+		// Fuses a whole batch at once, as if each point were FindOrInsert-ed in array order, and fills
+		// OutRepIndices[i] with the RepIndex of Points[i]. Reps are numbered by first appearance, so the
+		// Builder contract is unchanged. Registry must be empty, and is query-less afterward (Num/Get only).
+		//
+		// Points are hashed into cells at least as large as the widest tolerance reach. Each cell runs the
+		// sequential rules over its own points, in array order, in parallel with the others. Reps are then
+		// reconciled across adjacent cells in array order: a rep within tolerance of an earlier surviving rep
+		// is absorbed into the closest one, and absorbs nothing itself -- never transitively. Output depends
+		// only on point order, never on thread count; it may differ from FindOrInsert near cell borders, where
+		// the members of an absorbed rep follow it rather than picking their own rep.
+		void FuseParallel(TConstArrayView<FConstPoint> Points, const FPCGExFuseDetails& FuseDetails, TArray<int32>& OutRepIndices);
+
 		FORCEINLINE int32 Num() const
 		{
 			return Reps.Num();
@@ -109,11 +109,16 @@ struct PCGEXBLENDING_API FPCGExFuseDetails : public FPCGExSourceFuseDetails
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="FuseMethod == EPCGExFuseMethod::Voxel", EditConditionHides))
 	FVector VoxelGridOffset = FVector::ZeroVector;
 
+	/** Fuse on all cores: tolerance-sized cells are fused independently, then merged across their borders. Deterministic, but may group points differently than sequential fusing near cell borders. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay, meta=(PCG_Overridable, EditCondition="FuseMethod == EPCGExFuseMethod::Octree", EditConditionHides))
+	bool bParallelOctree = false;
+
 	const PCGExMath::IDistances* Distances;
 
 	virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InDataFacade) override;
 
 	EPCGExFuseMethod GetEffectiveMethod() const;
+	bool UseParallelOctree() const;
 
 	uint64 GetGridKey(const FVector& Location, const int32 PointIndex) const;
 	FBox GetOctreeBox(const FVector& Location, const int32 PointIndex) const;
@@ -41,6 +41,9 @@ public:
 	virtual void BlendSubPoints(PCGExData::FScope& Scope, const PCGExPaths::FPathMetrics& Metrics) const;
 
 protected:
+	// Blends From|To into every point of the scope, one weight per point, through the range blend path.
+	void BlendScope(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FScope& Scope, TConstArrayView<double> Weights) const;
+
 	FPCGExBlendingDetails BlendingDetails;
 	TSharedPtr<PCGExBlending::FMetadataBlender> MetadataBlender;
 };
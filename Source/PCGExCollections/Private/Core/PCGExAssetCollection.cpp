@@ -112,6 +112,25 @@ namespace PCGExAssetCollection
 		return WeightSum;
 	}
 
+	// Hash-based roll for alias picking: a uniform slot in [0, NumSlots) and an independent 32-bit coin.
+	// Integer-only (two murmur3 finalizers and a multiply-shift), so batches of seeds vectorize.
+	static FORCEINLINE void AliasRoll(const uint32 Seed, const int32 NumSlots, uint32& OutSlot, uint32& OutCoin)
+	{
+		auto Mix = [](uint32 H)
+		{
+			H ^= H >> 16;
+			H *= 0x85EBCA6B;
+			H ^= H >> 13;
+			H *= 0xC2B2AE35;
+			H ^= H >> 16;
+			return H;
+		};
+
+		const uint32 A = Mix(Seed);
+		OutCoin = Mix(A ^ 0x9E3779B9);
+		OutSlot = static_cast<uint32>((static_cast<uint64>(A) * static_cast<uint32>(NumSlots)) >> 32);
+	}
+
 #pragma region FEntryIdBank
 
 	void FEntryIdBank::Deposit(const uint32 InExactKey, const uint32 InLooseKey, const int32 InEntryId)
@@ -322,10 +341,50 @@ namespace PCGExAssetCollection
 		{
 			return -1;
 		}
-		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		// Weights is a sorted cumulative array after Compile -- first bucket > Threshold.
-		const int32 Pick = Algo::UpperBound(Weights, Threshold);
-		return Indices[Order[FMath::Min(Pick, Order.Num() - 1)]];
+
+		uint32 Slot = 0;
+		uint32 Coin = 0;
+		AliasRoll(static_cast<uint32>(Seed), Order.Num(), Slot, Coin);
+		return Indices[Order[Coin < AliasThresholds[Slot] ? Slot : AliasSlots[Slot]]];
+	}
+
+	void FCategory::GetPicksRandomWeighted(TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const
+	{
+		check(Seeds.Num() == OutPicks.Num());
+
+		if (Order.IsEmpty())
+		{
+			for (int32& Pick : OutPicks)
+			{
+				Pick = -1;
+			}
+			return;
+		}
+
+		const int32 NumSlots = Order.Num();
+		const uint32* Thresholds = AliasThresholds.GetData();
+		const int32* Aliases = AliasSlots.GetData();
+
+		// Blocks keep the hash pass free of table lookups so it stays a straight vectorizable loop
+		constexpr int32 BlockSize = 256;
+		uint32 Slots[BlockSize];
+		uint32 Coins[BlockSize];
+
+		for (int32 Start = 0; Start < Seeds.Num(); Start += BlockSize)
+		{
+			const int32 Count = FMath::Min(BlockSize, Seeds.Num() - Start);
+
+			for (int32 i = 0; i < Count; i++)
+			{
+				AliasRoll(static_cast<uint32>(Seeds[Start + i]), NumSlots, Slots[i], Coins[i]);
+			}
+
+			for (int32 i = 0; i < Count; i++)
+			{
+				const uint32 Slot = Slots[i];
+				OutPicks[Start + i] = Indices[Order[Coins[i] < Thresholds[Slot] ? Slot : Aliases[Slot]]];
+			}
+		}
 	}
 
 	void FCategory::Reserve(int32 InNum)
@@ -354,6 +413,70 @@ namespace PCGExAssetCollection
 	{
 		Shrink();
 		WeightSum = CompileWeightedOrder(Weights, Order);
+		BuildAliasTable();
+	}
+
+	void FCategory::BuildAliasTable()
+	{
+		const int32 NumSlots = Order.Num();
+		AliasThresholds.SetNumUninitialized(NumSlots);
+		AliasSlots.SetNumUninitialized(NumSlots);
+
+		if (NumSlots == 0)
+		{
+			return;
+		}
+
+		// Slot probabilities scaled so the average is 1; Weights is cumulative at this point
+		TArray<double> Scaled;
+		Scaled.SetNumUninitialized(NumSlots);
+
+		TArray<int32> Small;
+		TArray<int32> Large;
+		Small.Reserve(NumSlots);
+		Large.Reserve(NumSlots);
+
+		int32 Previous = 0;
+		for (int32 i = 0; i < NumSlots; i++)
+		{
+			Scaled[i] = static_cast<double>(Weights[i] - Previous) * NumSlots / WeightSum;
+			Previous = Weights[i];
+			(Scaled[i] < 1 ? Small : Large).Add(i);
+		}
+
+		auto ToThreshold = [](const double P)
+		{
+			return P >= 1 ? MAX_uint32 : static_cast<uint32>(P * 4294967296.0);
+		};
+
+		while (!Small.IsEmpty() && !Large.IsEmpty())
+		{
+			const int32 Less = Small.Pop(EAllowShrinking::No);
+			const int32 More = Large.Last();
+
+			AliasThresholds[Less] = ToThreshold(Scaled[Less]);
+			AliasSlots[Less] = More;
+
+			Scaled[More] = (Scaled[More] + Scaled[Less]) - 1;
+			if (Scaled[More] < 1)
+			{
+				Large.Pop(EAllowShrinking::No);
+				Small.Add(More);
+			}
+		}
+
+		// Whatever remains is full, give or take rounding
+		for (const int32 i : Large)
+		{
+			AliasThresholds[i] = MAX_uint32;
+			AliasSlots[i] = i;
+		}
+
+		for (const int32 i : Small)
+		{
+			AliasThresholds[i] = MAX_uint32;
+			AliasSlots[i] = i;
+		}
 	}
 
 #pragma endregion
@@ -1061,6 +1061,33 @@ namespace PCGExAssetStaging
 		// their scratch freely. Null when no active selector op uses scratch.
 		const TSharedPtr<PCGExCollections::FSourceScratches> PickScratches = Source->CreateScratches(Scope.Count);
 
+		// Single source without category routing: roll the whole scope through the picker's batch kernel up-front.
+		// Filtered-out points get rolled too; that's cheaper than compacting the scope.
+		PCGExCollections::FSelectorHelper* BulkHelper = nullptr;
+		TArray<int32> BulkSeeds;
+		TArray<int32> BulkPicks;
+
+		if (Source->IsSingleSource())
+		{
+			PCGExCollections::FMicroSelectorHelper* BulkMicroHelper = nullptr;
+			if (Source->TryGetHelpers(Scope.Start, BulkHelper, BulkMicroHelper) && BulkHelper->CanPickBulk())
+			{
+				BulkSeeds.SetNumUninitialized(Scope.Count);
+				BulkPicks.SetNumUninitialized(Scope.Count);
+
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					BulkSeeds[Index - Scope.Start] = PCGExRandomHelpers::GetSeed(Seeds[Index], BulkHelper->Details.SeedComponents, BulkHelper->Details.LocalSeed, Settings, Component);
+				}
+
+				BulkHelper->PickBulk(Scope.Start, BulkSeeds, BulkPicks, PickScratches ? PickScratches->GetFor(BulkHelper) : nullptr);
+			}
+			else
+			{
+				BulkHelper = nullptr;
+			}
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			PCGExCollections::FSelectorHelper* Helper = nullptr;
@@ -1072,9 +1099,19 @@ namespace PCGExAssetStaging
 				continue;
 			}
 
-			const int32 Seed = PCGExRandomHelpers::GetSeed(Seeds[Index], Helper->Details.SeedComponents, Helper->Details.LocalSeed, Settings, Component);
+			int32 Seed = 0;
+			FPCGExEntryAccessResult Result;
 
-			FPCGExEntryAccessResult Result = Helper->GetEntry(Index, Seed, bFlattenSubCollections, PickScratches ? PickScratches->GetFor(Helper) : nullptr);
+			if (Helper == BulkHelper)
+			{
+				Seed = BulkSeeds[Index - Scope.Start];
+				Result = Helper->ResolvePick(BulkPicks[Index - Scope.Start], Seed, bFlattenSubCollections);
+			}
+			else
+			{
+				Seed = PCGExRandomHelpers::GetSeed(Seeds[Index], Helper->Details.SeedComponents, Helper->Details.LocalSeed, Settings, Component);
+				Result = Helper->GetEntry(Index, Seed, bFlattenSubCollections, PickScratches ? PickScratches->GetFor(Helper) : nullptr);
+			}
 
 			if (!Result.IsValid()
 				|| !Result.Entry->Staging.Bounds.IsValid
@@ -417,7 +417,17 @@ namespace PCGExCollections
 
 		FPCGExPickerScratchBase* Scratch = Scratches ? Scratches->GetSlot(CategorySlot) : nullptr;
 
-		const int32 Raw = Op->Pick(PointIndex, Seed, Scratch);
+		return ResolvePick(Op->Pick(PointIndex, Seed, Scratch), Seed, bFlattenSubCollections, CategorySlot);
+	}
+
+	void FSelectorHelper::PickBulk(int32 FirstPointIndex, TConstArrayView<int32> Seeds, TArrayView<int32> OutRaw, const FSelectorScratches* Scratches) const
+	{
+		check(CanPickBulk());
+		MainPickerOp->PickBulk(FirstPointIndex, Seeds, OutRaw, Scratches ? Scratches->GetSlot(CategorySlot_Main) : nullptr);
+	}
+
+	FPCGExEntryAccessResult FSelectorHelper::ResolvePick(int32 Raw, int32 Seed, const bool bFlattenSubCollections, int32 CategorySlot) const
+	{
 		FPCGExEntryAccessResult Result = Collection->GetEntryRaw(Raw);
 		if (Result && (!bFlattenSubCollections && Result.Entry->HasValidSubCollection()))
 		{
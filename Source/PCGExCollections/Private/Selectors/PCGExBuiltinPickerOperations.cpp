@@ -16,6 +16,12 @@ int32 FPCGExEntryWeightedRandomPickerOp::Pick(int32 PointIndex, int32 Seed, FPCG
 	return Target->GetPickRandomWeighted(Seed);
 }
 
+void FPCGExEntryWeightedRandomPickerOp::PickBulk(int32 FirstPointIndex, TConstArrayView<int32> Seeds, TArrayView<int32> OutRaw, FPCGExPickerScratchBase* Scratch) const
+{
+	checkSlow(Target && !Target->IsEmpty());
+	Target->GetPicksRandomWeighted(Seeds, OutRaw);
+}
+
 int32 FPCGExEntryWeightedRandomPickerOp::PickFiltered(int32 PointIndex, int32 Seed, const FPCGExPickAvailability& InAvailability, FPCGExPickerScratchBase* Scratch) const
 {
 	checkSlow(Target && !Target->IsEmpty());
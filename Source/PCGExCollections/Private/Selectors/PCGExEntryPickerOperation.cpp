@@ -51,3 +51,11 @@ int32 FPCGExEntryPickerOperation::PickFiltered(int32 PointIndex, int32 Seed, con
 
 	return -1;
 }
+
+void FPCGExEntryPickerOperation::PickBulk(int32 FirstPointIndex, TConstArrayView<int32> Seeds, TArrayView<int32> OutRaw, FPCGExPickerScratchBase* Scratch) const
+{
+	for (int32 i = 0; i < Seeds.Num(); i++)
+	{
+		OutRaw[i] = Pick(FirstPointIndex + i, Seeds[i], Scratch);
+	}
+}
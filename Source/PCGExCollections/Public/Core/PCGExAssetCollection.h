@@ -612,7 +612,7 @@ namespace PCGExAssetCollection
 		FName Name = NAME_None;
 
 		// Sum over Weights, which hold Weight+1 per entry -- i.e. Sum(Weight) + Num(). This is the
-		// domain GetPickRandomWeighted rolls in, NOT a sum of authored weights. For normalization
+		// domain the alias table is built over, NOT a sum of authored weights. For normalization
 		// (a value meant to sum to 1 across the pool) use RawWeightSum.
 		double WeightSum = 0;
 
@@ -624,6 +624,11 @@ namespace PCGExAssetCollection
 		TArray<int32> Order;
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
 
+		// Vose alias table over Order slots, built by Compile. A weighted roll draws a slot uniformly,
+		// keeps it when its coin falls under AliasThresholds[Slot], and takes AliasSlots[Slot] otherwise.
+		TArray<uint32> AliasThresholds;
+		TArray<int32> AliasSlots;
+
 		FCategory() = default;
 
 		explicit FCategory(FName InName)
@@ -649,12 +654,20 @@ namespace PCGExAssetCollection
 		int32 GetPickWeightAscending(int32 Index) const;
 		int32 GetPickWeightDescending(int32 Index) const;
 		int32 GetPickRandom(int32 Seed) const;
+
+		/** O(1) weighted pick through the alias table, driven by a hash of Seed. */
 		int32 GetPickRandomWeighted(int32 Seed) const;
 
+		/** Bulk GetPickRandomWeighted: OutPicks[i] receives the pick for Seeds[i]. Both views must have the same size. */
+		void GetPicksRandomWeighted(TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const;
+
 		void Reserve(int32 InNum);
 		void Shrink();
 		void RegisterEntry(int32 Index, const FPCGExAssetCollectionEntry* InEntry);
 		void Compile();
+
+	protected:
+		void BuildAliasTable();
 	};
 
 	/**
@@ -311,6 +311,24 @@ namespace PCGExCollections
 		 */
 		FPCGExEntryAccessResult GetEntry(int32 PointIndex, int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags, const bool bFlattenSubCollections = false, const FSelectorScratches* Scratches = nullptr) const;
 
+		// ========== Bulk picking ==========
+
+		/** True when every point routes to the main picker (no category routing) and that picker has a batch kernel. */
+		bool CanPickBulk() const
+		{
+			return !CategoryGetter && MainPickerOp && MainPickerOp->WantsBulkPick();
+		}
+
+		/**
+		 * Raw picks for a contiguous run of points through the main picker's batch kernel. Requires CanPickBulk().
+		 * OutRaw[i] is the pick for point FirstPointIndex + i rolled with Seeds[i]; ResolvePick turns it into the
+		 * entry GetEntry would have returned for that point.
+		 */
+		void PickBulk(int32 FirstPointIndex, TConstArrayView<int32> Seeds, TArrayView<int32> OutRaw, const FSelectorScratches* Scratches = nullptr) const;
+
+		/** Resolve a raw pick from the pool behind CategorySlot, recursing into subcollections like GetEntry does. */
+		FPCGExEntryAccessResult ResolvePick(int32 Raw, int32 Seed, const bool bFlattenSubCollections = false, int32 CategorySlot = CategorySlot_Main) const;
+
 		/** Get the underlying collection */
 		UPCGExAssetCollection* GetCollection() const
 		{
@@ -31,6 +31,8 @@ class FPCGExEntryWeightedRandomPickerOp : public FPCGExEntryPickerOperation
 {
 public:
 	virtual int32 Pick(int32 PointIndex, int32 Seed, FPCGExPickerScratchBase* Scratch = nullptr) const override;
+	virtual void PickBulk(int32 FirstPointIndex, TConstArrayView<int32> Seeds, TArrayView<int32> OutRaw, FPCGExPickerScratchBase* Scratch = nullptr) const override;
+	virtual bool WantsBulkPick() const override { return true; }
 	virtual int32 PickFiltered(int32 PointIndex, int32 Seed, const FPCGExPickAvailability& InAvailability, FPCGExPickerScratchBase* Scratch = nullptr) const override;
 };
 
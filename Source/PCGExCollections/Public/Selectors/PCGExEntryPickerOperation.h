@@ -114,6 +114,22 @@ public:
 	 */
 	virtual int32 Pick(int32 PointIndex, int32 Seed, FPCGExPickerScratchBase* Scratch = nullptr) const = 0;
 
+	/**
+	 * Pick for a contiguous run of points: OutRaw[i] receives the pick for point FirstPointIndex + i
+	 * rolled with Seeds[i]. Must match calling Pick() point by point, under the same contract.
+	 * Default does exactly that; ops with a batch kernel override it along with WantsBulkPick.
+	 */
+	virtual void PickBulk(int32 FirstPointIndex, TConstArrayView<int32> Seeds, TArrayView<int32> OutRaw, FPCGExPickerScratchBase* Scratch = nullptr) const;
+
+	/**
+	 * Whether consumers should route whole scopes through PickBulk. Only for stateless ops: a bulk
+	 * roll also covers points the consumer later skips, which would disturb scratch-driven picks.
+	 */
+	virtual bool WantsBulkPick() const
+	{
+		return false;
+	}
+
 	/**
 	 * Quota-aware pick: like Pick, but entries reported unavailable by InAvailability must not
 	 * be returned. Returns -1 when nothing available satisfies the selector's criteria.
@@ -5,6 +5,7 @@
 #include "Clusters/PCGExClusterCache.h"
 
 #include "Clusters/PCGExClusterCommon.h"
+#include "PCGExFlatIndex.h"
 #include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
@@ -49,6 +50,9 @@ namespace PCGExClusters
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
 
+		// Copied nodes keep their links verbatim, so the packed adjacency is valid either way.
+		FlatAdjacency = OriginalCluster->FlatAdjacency;
+
 		if (bCopyNodes)
 		{
 			const int32 NumNewNodes = OriginalCluster->Nodes->Num();
@@ -143,6 +147,8 @@ namespace PCGExClusters
 	{
 		NodeOctree.Reset();
 		EdgeOctree.Reset();
+		NodeFlatIndex.Reset();
+		EdgeFlatIndex.Reset();
 		BoundedEdges.Reset();
 		EdgeLengths.Reset();
 		MinEdgeLength = 0;
@@ -537,6 +543,45 @@ namespace PCGExClusters
 		return EdgeOctree;
 	}
 
+	TSharedPtr<PCGExSpatial::FFlatIndex> FCluster::GetNodeFlatIndex()
+	{
+		if (!NodeFlatIndex)
+		{
+			RebuildNodeFlatIndex();
+		}
+		return NodeFlatIndex;
+	}
+
+	TSharedPtr<PCGExSpatial::FFlatIndex> FCluster::GetEdgeFlatIndex()
+	{
+		if (!EdgeFlatIndex)
+		{
+			RebuildEdgeFlatIndex();
+		}
+		return EdgeFlatIndex;
+	}
+
+	TSharedPtr<FFlatAdjacency> FCluster::GetFlatAdjacency()
+	{
+		{
+			FReadScopeLock ReadLock(ClusterLock);
+			if (FlatAdjacency)
+			{
+				return FlatAdjacency;
+			}
+		}
+
+		FWriteScopeLock WriteLock(ClusterLock);
+		if (!FlatAdjacency)
+		{
+			const TSharedPtr<FFlatAdjacency> NewAdjacency = MakeShared<FFlatAdjacency>();
+			NewAdjacency->Build(*Nodes);
+			FlatAdjacency = NewAdjacency;
+		}
+
+		return FlatAdjacency;
+	}
+
 	void FCluster::RebuildNodeOctree()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeOctree);
@@ -584,23 +629,62 @@ namespace PCGExClusters
 		}
 	}
 
+	void FCluster::RebuildNodeFlatIndex()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeFlatIndex);
+
+		NodeFlatIndex = MakeShared<PCGExSpatial::FFlatIndex>();
+		NodeFlatIndex->BuildPoints(
+			Nodes->Num(), [&](const int32 Index, FVector& OutPosition)
+			{
+				OutPosition = GetPos(Index);
+				return true;
+			});
+	}
+
+	void FCluster::RebuildEdgeFlatIndex()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildEdgeFlatIndex);
+
+		EdgeFlatIndex = MakeShared<PCGExSpatial::FFlatIndex>();
+		EdgeFlatIndex->BuildBoxes(
+			Edges->Num(), [&](const int32 Index, FBox& OutBox)
+			{
+				const FEdge* Edge = EdgesDataPtr + Index;
+				const FVector A = VtxTransforms[Edge->Start].GetLocation();
+				const FVector B = VtxTransforms[Edge->End].GetLocation();
+				OutBox = FBox(A.ComponentMin(B), A.ComponentMax(B));
+				return true;
+			});
+	}
+
 	void FCluster::RebuildOctree(const EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild)
 	{
+		// The octree is always built: many callers query NodeOctree/EdgeOctree directly, often from parallel loops
+		// where a lazy GetNodeOctree/GetEdgeOctree build would race. The flat index only comes on top of it.
+		const bool bFlat = PCGExSpatial::UseFlatIndex();
+
 		switch (Mode)
 		{
 		case EPCGExClusterClosestSearchMode::Vtx:
-			if (NodeOctree && !bForceRebuild)
+			if (!NodeOctree || bForceRebuild)
 			{
-				return;
+				RebuildNodeOctree();
+			}
+			if (bFlat && (!NodeFlatIndex || bForceRebuild))
+			{
+				RebuildNodeFlatIndex();
 			}
-			RebuildNodeOctree();
 			break;
 		case EPCGExClusterClosestSearchMode::Edge:
-			if (EdgeOctree && !bForceRebuild)
+			if (!EdgeOctree || bForceRebuild)
 			{
-				return;
+				RebuildEdgeOctree();
+			}
+			if (bFlat && (!EdgeFlatIndex || bForceRebuild))
+			{
+				RebuildEdgeFlatIndex();
 			}
-			RebuildEdgeOctree();
 			break;
 		default: ;
 		}
@@ -642,7 +726,20 @@ namespace PCGExClusters
 
 		const TArray<FNode>& NodesRef = *Nodes;
 
-		if (NodeOctree)
+		if (NodeFlatIndex)
+		{
+			ClosestIndex = NodeFlatIndex->FindNearest(
+				Position, [&](const int32 Index)
+				{
+					const FNode& Node = NodesRef[Index];
+					if (MinNeighbors > 0 && Node.Num() < MinNeighbors)
+					{
+						return TNumericLimits<double>::Max();
+					}
+					return FVector::DistSquared(Position, GetPos(Node));
+				});
+		}
+		else if (NodeOctree)
 		{
 			auto ProcessCandidate = [&](const PCGExOctree::FItem& Item)
 			{
@@ -686,7 +783,19 @@ namespace PCGExClusters
 		double MaxDistance = TNumericLimits<double>::Max();
 		int32 ClosestIndex = -1;
 
-		if (EdgeOctree)
+		if (EdgeFlatIndex)
+		{
+			ClosestIndex = EdgeFlatIndex->FindNearest(
+				Position, [&](const int32 Index)
+				{
+					if (MinNeighbors > 0 && !EdgeHasMinNeighbors(Index, MinNeighbors))
+					{
+						return TNumericLimits<double>::Max();
+					}
+					return GetPointDistToEdgeSquared(Index, Position);
+				});
+		}
+		else if (EdgeOctree)
 		{
 			auto ProcessCandidate = [&](const PCGExOctree::FItem& Item)
 			{
@@ -0,0 +1,42 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterAdjacency.h"
+
+#include "Clusters/PCGExNode.h"
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExClusters
+{
+	void FFlatAdjacency::Build(const TArray<FNode>& InNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FFlatAdjacency::Build);
+
+		const int32 NumNodes = InNodes.Num();
+		const FNode* NodesData = InNodes.GetData();
+
+		// Prefix sum is a single linear pass over degrees; cheap enough to stay sequential.
+		Offsets.SetNumUninitialized(NumNodes + 1);
+		int32* OffsetsData = Offsets.GetData();
+
+		int32 Total = 0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			OffsetsData[i] = Total;
+			Total += NodesData[i].Links.Num();
+		}
+		OffsetsData[NumNodes] = Total;
+
+		// Every slot is written exactly once by the copy below.
+		Links.SetNumUninitialized(Total);
+		PCGExGraphs::FLink* LinksData = Links.GetData();
+
+		PCGExMT::ParallelOrSequential(
+			NumNodes,
+			[&](const int32 i)
+			{
+				const PCGExGraphs::NodeLinks& NodeLinks = NodesData[i].Links;
+				FMemory::Memcpy(LinksData + OffsetsData[i], NodeLinks.GetData(), NodeLinks.Num() * sizeof(PCGExGraphs::FLink));
+			});
+	}
+}
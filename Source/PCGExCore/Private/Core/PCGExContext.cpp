@@ -509,6 +509,11 @@ void FPCGExContext::OnComplete()
 		ElementHandle->CompleteWork(this);
 	}
 
+	if (TaskManager)
+	{
+		TaskManager->SubmitProfile();
+	}
+
 	PCGEX_TERMINATE_ASYNC
 
 	{
@@ -8,9 +8,11 @@
 #include "PCGExSettingsCacheBody.h"
 #include "PCGExSubSystem.h"
 #include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "UObject/GarbageCollection.h"
 #include "UObject/UObjectGlobals.h"
 #include "Core/PCGExContext.h"
+#include "Core/PCGExProfiling.h"
 #include "Core/PCGExSettings.h"
 #include "HAL/PlatformTime.h"
 #include "Misc/ScopeRWLock.h"
@@ -51,6 +53,40 @@ namespace PCGExMT
 		return OutSubRanges.Num();
 	}
 
+	int32 ScheduleLoopScopes(TArray<FScope>& OutSubRanges, const int32 NumIterations, const int32 DesiredBatchSize, const EScheduling Scheduling)
+	{
+		const int32 StaticChunk = FMath::Max(1, GetSanitizedBatchSize(NumIterations, DesiredBatchSize));
+
+		switch (Scheduling)
+		{
+		default:
+		case EScheduling::Static:
+			return SubLoopScopes(OutSubRanges, NumIterations, StaticChunk);
+
+		case EScheduling::WorkStealing:
+			// Four times finer than static so idle workers still find scopes to pull when costs are skewed
+			return SubLoopScopes(OutSubRanges, NumIterations, FMath::Max(1, StaticChunk / 4));
+
+		case EScheduling::Guided:
+			{
+				// Each scope takes a share of what's left: ~1/(2*workers) of the remainder, down to a quarter of the static size
+				const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+				const int32 MinChunk = FMath::Max(1, StaticChunk / 4);
+
+				OutSubRanges.Empty();
+				int32 Start = 0;
+				while (Start < NumIterations)
+				{
+					const int32 Remaining = NumIterations - Start;
+					const int32 Count = FMath::Min(Remaining, FMath::Max(MinChunk, FMath::DivideAndRoundUp(Remaining, NumWorkers * 2)));
+					OutSubRanges.Emplace(Start, Count, OutSubRanges.Num());
+					Start += Count;
+				}
+				return OutSubRanges.Num();
+			}
+		}
+	}
+
 	// IAsyncHandle
 	IAsyncHandle::~IAsyncHandle()
 	{
@@ -442,6 +478,15 @@ namespace PCGExMT
 		// Clear registry to free memory
 		ClearRegistry();
 
+		if (ProfileStats)
+		{
+			if (Manager && Manager->Profile)
+			{
+				Manager->Profile->EndGroup(*ProfileStats);
+			}
+			ProfileStats.Reset();
+		}
+
 		if (!bWasCancelled && OnCompleteCallback)
 		{
 			FCompletionCallback LocalCallback = MoveTemp(OnCompleteCallback);
@@ -494,6 +539,13 @@ namespace PCGExMT
 		  , ContextHandle(InContext->GetWeakSelfHandle())
 	{
 		WorkHandle = Context->GetWorkHandle();
+
+		if (PCGExProfiling::IsEnabled())
+		{
+			Profile = MakeShared<PCGExProfiling::FContextProfile>();
+			Profile->NodeName = GetNameSafe(Context->GetInputSettings<UPCGExSettings>());
+			Profile->SourceName = GetPathNameSafe(Context->GetComponent());
+		}
 	}
 
 	FTaskManager::~FTaskManager()
@@ -540,6 +592,10 @@ namespace PCGExMT
 			if (TryTransitionState(EAsyncHandleState::Idle, EAsyncHandleState::Running))
 			{
 				PCGEX_MANAGER_LOG(LogTemp, Warning, TEXT("FTaskManager::Start"));
+				if (Profile)
+				{
+					ProfileStats = Profile->BeginGroup(GroupName.ToString());
+				}
 				return true;
 			}
 		}
@@ -634,7 +690,16 @@ namespace PCGExMT
 		NewGroup->HandleIdx = Idx * -1;
 
 		PCGEX_SHARED_THIS_DECL
-		if (NewGroup->SetGroup(InParentHandle ? InParentHandle : ThisPtr))
+		const TSharedPtr<IAsyncHandleGroup> ParentHandle = InParentHandle ? InParentHandle : ThisPtr;
+
+		if (Profile)
+		{
+			// Path mirrors the group hierarchy so nested groups stay distinguishable in the dump
+			const TSharedPtr<PCGExProfiling::FGroupStats> ParentStats = ParentHandle->ProfileStats;
+			NewGroup->ProfileStats = Profile->BeginGroup(ParentStats ? ParentStats->Path / InName.ToString() : InName.ToString());
+		}
+
+		if (NewGroup->SetGroup(ParentHandle))
 		{
 			NewGroup->Start();
 			return NewGroup;
@@ -680,6 +745,11 @@ namespace PCGExMT
 			InTask->SetGroup(ThisPtr);
 		}
 
+		if (Profile)
+		{
+			InTask->QueuedCycles = FPlatformTime::Cycles64();
+		}
+
 		UE::Tasks::Launch(*InTask->DEBUG_HandleId(), [WeakManager = TWeakPtr<FTaskManager>(SharedThis(this)), Task = InTask, PinTracker = Context->GetAsyncPinTracker()]()
 		{
 #define PCGEX_CANCEL_TASK_INTERNAL Task->Cancel(); Task->Complete(); return;
@@ -709,7 +779,20 @@ namespace PCGExMT
 
 				if (Task->Start())
 				{
-					Task->ExecuteTask(Manager);
+					{
+						// Scope must close before Complete(), which may end the group and release its stats
+						TSharedPtr<PCGExProfiling::FGroupStats> Stats;
+						if (Task->QueuedCycles)
+						{
+							if (const TSharedPtr<IAsyncHandleGroup> Parent = Task->Group.Pin())
+							{
+								Stats = Parent->ProfileStats;
+							}
+						}
+
+						PCGExProfiling::FTaskScope ProfileScope(Stats.Get(), Task->QueuedCycles);
+						Task->ExecuteTask(Manager);
+					}
 					Task->Complete();
 				}
 			}
@@ -724,6 +807,15 @@ namespace PCGExMT
 		// Clear registries
 		ClearRegistry();
 
+		if (ProfileStats)
+		{
+			if (Profile)
+			{
+				Profile->EndGroup(*ProfileStats);
+			}
+			ProfileStats.Reset();
+		}
+
 		// For the manager, we DON'T call parent notification (there is no parent)
 		// We call OnEndCallback directly, which notifies the context
 
@@ -742,6 +834,17 @@ namespace PCGExMT
 		}
 	}
 
+	void FTaskManager::SubmitProfile()
+	{
+		if (!Profile)
+		{
+			return;
+		}
+
+		PCGExProfiling::Submit(Profile);
+		Profile.Reset();
+	}
+
 	void FTaskManager::ClearRegistry(const bool bCancel)
 	{
 		bool Expected = false;
@@ -851,7 +954,7 @@ namespace PCGExMT
 			// (e.g. FSanitizeRangeTask in PCGExRefineEdges) that still need the async path.
 
 			TArray<FScope> Loops;
-			const int32 NumScopes = SubLoopScopes(Loops, NumIterations, SanitizedChunk);
+			const int32 NumScopes = ScheduleLoopScopes(Loops, NumIterations, ChunkSize, Scheduling);
 
 			{
 				FRegistrationGuard Guard(SharedThis(this));
@@ -867,23 +970,28 @@ namespace PCGExMT
 				// Started==Completed invariant holds when the guard destructor fires.
 				StartedCount.fetch_add(NumScopes, std::memory_order_acq_rel);
 
+				// Scopes are not queued individually; wait is measured from dispatch to each scope's start
+				const uint64 DispatchCycles = ProfileStats ? FPlatformTime::Cycles64() : 0;
+
 				if (NumScopes == 1)
 				{
+					PCGExProfiling::FTaskScope ProfileScope(ProfileStats.Get(), DispatchCycles);
 					ExecScopeIteration(Loops[0], bPreparationOnly);
 				}
 				else
 				{
-					PCGExMT::ParallelOrSequential(
-						NumScopes,
-						[&](const int32 i)
+					ExecuteScopes(
+						Loops,
+						[&](const FScope& Scope)
 						{
 							// Honor cancellation per-scope, same as FScopeIterationTask::ExecuteTask does.
 							if (!IsAvailable())
 							{
 								return;
 							}
-							ExecScopeIteration(Loops[i], bPreparationOnly);
-						}, /*Threshold=*/2, EParallelForFlags::Unbalanced);
+							PCGExProfiling::FTaskScope ProfileScope(ProfileStats.Get(), DispatchCycles);
+							ExecScopeIteration(Scope, bPreparationOnly);
+						}, Scheduling, GroupName);
 				}
 
 				CompletedCount.fetch_add(NumScopes, std::memory_order_acq_rel);
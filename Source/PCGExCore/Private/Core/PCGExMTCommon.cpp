@@ -2,8 +2,25 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Core/PCGExMTCommon.h"
+
+#include <atomic>
+
+#include "PCGExLog.h"
 #include "Async/ParallelFor.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+
+namespace PCGExMTCVars
+{
+	TAutoConsoleVariable<bool> CVarReportTailIdle(
+		TEXT("pcgex.MT.ReportTailIdle"),
+		false,
+		TEXT("Logs, for every scheduled PCGEx loop, the time worker threads spent idle waiting on the loop's last scopes."),
+		ECVF_Default);
+}
 
 namespace PCGExMT
 {
@@ -85,5 +102,94 @@ namespace PCGExMT
 		}
 	}
 
+	namespace
+	{
+		/** Last finish time per participating thread; only used when reporting. */
+		struct FTailIdleTracker
+		{
+			FCriticalSection Lock;
+			TMap<uint32, double> LastFinish;
+
+			void Record()
+			{
+				const double Now = FPlatformTime::Seconds();
+				const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+				FScopeLock ScopeLock(&Lock);
+				LastFinish.FindOrAdd(ThreadId) = Now;
+			}
+
+			void Report(const FName LoopName, const EScheduling Scheduling, const int32 NumScopes, const double StartTime)
+			{
+				double End = StartTime;
+				for (const TPair<uint32, double>& Pair : LastFinish) { End = FMath::Max(End, Pair.Value); }
+
+				double TailIdle = 0;
+				for (const TPair<uint32, double>& Pair : LastFinish) { TailIdle += End - Pair.Value; }
+
+				const double Wall = End - StartTime;
+				const int32 NumThreads = LastFinish.Num();
+				const double Ratio = (Wall > 0 && NumThreads > 0) ? TailIdle / (Wall * NumThreads) : 0;
+
+				static const TCHAR* SchedulingNames[] = {TEXT("Static"), TEXT("Guided"), TEXT("WorkStealing")};
+				UE_LOG(LogPCGEx, Log, TEXT("[%s] %s | %d scopes on %d threads | %.3fms wall | %.3fms tail idle (%.1f%%)"),
+				       *LoopName.ToString(), SchedulingNames[static_cast<uint8>(Scheduling)], NumScopes, NumThreads,
+				       Wall * 1000.0, TailIdle * 1000.0, Ratio * 100.0);
+			}
+		};
+	}
+
+	void ExecuteScopes(const TArray<FScope>& Scopes, const FScopedLoopBody& Body, const EScheduling Scheduling, const FName LoopName)
+	{
+		const int32 NumScopes = Scopes.Num();
+		if (NumScopes == 0)
+		{
+			return;
+		}
+
+		if (NumScopes == 1)
+		{
+			Body(Scopes[0]);
+			return;
+		}
+
+		TUniquePtr<FTailIdleTracker> Tracker;
+		if (PCGExMTCVars::CVarReportTailIdle.GetValueOnAnyThread())
+		{
+			Tracker = MakeUnique<FTailIdleTracker>();
+		}
+
+		const double StartTime = Tracker ? FPlatformTime::Seconds() : 0;
+
+		if (Scheduling == EScheduling::Static)
+		{
+			ParallelFor(NumScopes, [&](const int32 i)
+			{
+				Body(Scopes[i]);
+				if (Tracker) { Tracker->Record(); }
+			}, EParallelForFlags::Unbalanced);
+		}
+		else
+		{
+			// One puller per worker (plus the calling thread); scopes go out strictly in order
+			const int32 NumPullers = FMath::Min(NumScopes, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()) + 1);
+			std::atomic<int32> Cursor{0};
+
+			ParallelFor(NumPullers, [&](int32)
+			{
+				int32 i;
+				while ((i = Cursor.fetch_add(1, std::memory_order_relaxed)) < NumScopes)
+				{
+					Body(Scopes[i]);
+				}
+				if (Tracker) { Tracker->Record(); }
+			}, EParallelForFlags::Unbalanced);
+		}
+
+		if (Tracker)
+		{
+			Tracker->Report(LoopName, Scheduling, NumScopes, StartTime);
+		}
+	}
+
 #pragma endregion
 }
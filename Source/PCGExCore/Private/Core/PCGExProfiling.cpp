@@ -0,0 +1,356 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExProfiling.h"
+
+#include "PCGExLog.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace PCGExProfilingCVars
+{
+	TAutoConsoleVariable<bool> CVarEnabled(
+		TEXT("pcgex.Profile.Enabled"),
+		false,
+		TEXT("Records per-group and per-phase timings for every PCGEx node executed afterward. Dump with pcgex.Profile.Dump."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarMaxProfiles(
+		TEXT("pcgex.Profile.MaxProfiles"),
+		4096,
+		TEXT("Number of submitted node profiles kept before the oldest ones are dropped."),
+		ECVF_Default);
+}
+
+namespace PCGExProfiling
+{
+	namespace Internal
+	{
+		FCriticalSection SubmittedLock;
+		TArray<TSharedPtr<FContextProfile>> Submitted;
+
+		double CyclesToMs(const uint64 InCycles)
+		{
+			return FPlatformTime::ToMilliseconds64(InCycles);
+		}
+
+		void AtomicMax(std::atomic<int32>& Target, const int32 Value)
+		{
+			int32 Current = Target.load(std::memory_order_relaxed);
+			while (Value > Current && !Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		void AtomicMax(std::atomic<uint64>& Target, const uint64 Value)
+		{
+			uint64 Current = Target.load(std::memory_order_relaxed);
+			while (Value > Current && !Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		FString EscapeJson(const FString& InString)
+		{
+			FString Out = InString.Replace(TEXT("\\"), TEXT("\\\\"));
+			Out.ReplaceInline(TEXT("\""), TEXT("\\\""));
+			return Out;
+		}
+
+		FString EscapeCsv(const FString& InString)
+		{
+			if (!InString.Contains(TEXT(",")) && !InString.Contains(TEXT("\"")))
+			{
+				return InString;
+			}
+			return FString::Printf(TEXT("\"%s\""), *InString.Replace(TEXT("\""), TEXT("\"\"")));
+		}
+
+		TArray<TSharedPtr<FContextProfile>> GetSubmitted()
+		{
+			FScopeLock Lock(&SubmittedLock);
+			return Submitted;
+		}
+	}
+
+	bool IsEnabled()
+	{
+		return PCGExProfilingCVars::CVarEnabled.GetValueOnAnyThread();
+	}
+
+#pragma region FGroupStats
+
+	FGroupStats::FGroupStats(const FString& InPath)
+		: Path(InPath), StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	uint64 FGroupStats::EnterTask(const uint64 InQueuedCycles)
+	{
+		const uint64 Now = FPlatformTime::Cycles64();
+
+		NumTasks.fetch_add(1, std::memory_order_relaxed);
+		Internal::AtomicMax(PeakConcurrency, NumRunning.fetch_add(1, std::memory_order_relaxed) + 1);
+
+		if (InQueuedCycles && Now > InQueuedCycles)
+		{
+			const uint64 Wait = Now - InQueuedCycles;
+			WaitCycles.fetch_add(Wait, std::memory_order_relaxed);
+			Internal::AtomicMax(MaxWaitCycles, Wait);
+		}
+
+		return Now;
+	}
+
+	void FGroupStats::ExitTask(const uint64 InStartCycles)
+	{
+		BusyCycles.fetch_add(FPlatformTime::Cycles64() - InStartCycles, std::memory_order_relaxed);
+		NumRunning.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+#pragma endregion
+
+#pragma region FContextProfile
+
+	FContextProfile::FContextProfile()
+		: StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	FRecord& FContextProfile::FindOrAddRecordUnsafe(const FString& InPath)
+	{
+		if (const int32* Index = RecordIndices.Find(InPath))
+		{
+			return Records[*Index];
+		}
+
+		RecordIndices.Add(InPath, Records.Num());
+		FRecord& NewRecord = Records.Emplace_GetRef();
+		NewRecord.Path = InPath;
+		return NewRecord;
+	}
+
+	TSharedPtr<FGroupStats> FContextProfile::BeginGroup(const FString& InPath) const
+	{
+		return MakeShared<FGroupStats>(InPath);
+	}
+
+	void FContextProfile::EndGroup(const FGroupStats& InStats)
+	{
+		const double WallTime = Internal::CyclesToMs(FPlatformTime::Cycles64() - InStats.StartCycles);
+
+		FScopeLock Lock(&RecordsLock);
+		FRecord& Record = FindOrAddRecordUnsafe(InStats.Path);
+		Record.NumRuns++;
+		Record.NumTasks += InStats.NumTasks.load(std::memory_order_relaxed);
+		Record.PeakConcurrency = FMath::Max(Record.PeakConcurrency, InStats.PeakConcurrency.load(std::memory_order_relaxed));
+		Record.WallTime += WallTime;
+		Record.BusyTime += Internal::CyclesToMs(InStats.BusyCycles.load(std::memory_order_relaxed));
+		Record.WaitTime += Internal::CyclesToMs(InStats.WaitCycles.load(std::memory_order_relaxed));
+		Record.MaxWaitTime = FMath::Max(Record.MaxWaitTime, Internal::CyclesToMs(InStats.MaxWaitCycles.load(std::memory_order_relaxed)));
+	}
+
+	void FContextProfile::AddPhase(const FString& InPath, const double InSeconds)
+	{
+		const double Ms = InSeconds * 1000.0;
+
+		FScopeLock Lock(&RecordsLock);
+		FRecord& Record = FindOrAddRecordUnsafe(InPath);
+		Record.NumRuns++;
+		Record.NumTasks++;
+		Record.PeakConcurrency = FMath::Max(Record.PeakConcurrency, 1);
+		Record.WallTime += Ms;
+		Record.BusyTime += Ms;
+	}
+
+	void FContextProfile::Finalize()
+	{
+		TotalTime = Internal::CyclesToMs(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	TArray<FRecord> FContextProfile::GetRecords() const
+	{
+		FScopeLock Lock(&RecordsLock);
+		return Records;
+	}
+
+#pragma endregion
+
+#pragma region FPhaseScope
+
+	FPhaseScope::FPhaseScope(const TSharedPtr<FContextProfile>& InProfile, const TCHAR* InPath)
+		: Profile(InProfile), Path(InPath)
+	{
+		if (Profile)
+		{
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	FPhaseScope::~FPhaseScope()
+	{
+		if (Profile)
+		{
+			Profile->AddPhase(Path, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+		}
+	}
+
+#pragma endregion
+
+#pragma region FPendingPhase
+
+	FPendingPhase::~FPendingPhase()
+	{
+		End();
+	}
+
+	void FPendingPhase::Begin(const TSharedPtr<FContextProfile>& InProfile, const TCHAR* InPath)
+	{
+		End();
+
+		if (!InProfile)
+		{
+			return;
+		}
+
+		Profile = InProfile;
+		Path = InPath;
+		StartCycles = FPlatformTime::Cycles64();
+	}
+
+	void FPendingPhase::End()
+	{
+		if (!Profile)
+		{
+			return;
+		}
+
+		Profile->AddPhase(Path, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+		Profile.Reset();
+		Path = nullptr;
+	}
+
+#pragma endregion
+
+#pragma region Registry
+
+	void Submit(const TSharedPtr<FContextProfile>& InProfile)
+	{
+		if (!InProfile)
+		{
+			return;
+		}
+
+		InProfile->Finalize();
+
+		const int32 MaxProfiles = FMath::Max(1, PCGExProfilingCVars::CVarMaxProfiles.GetValueOnAnyThread());
+
+		FScopeLock Lock(&Internal::SubmittedLock);
+		Internal::Submitted.Add(InProfile);
+		if (Internal::Submitted.Num() > MaxProfiles)
+		{
+			Internal::Submitted.RemoveAt(0, Internal::Submitted.Num() - MaxProfiles);
+		}
+	}
+
+	void ResetSubmitted()
+	{
+		FScopeLock Lock(&Internal::SubmittedLock);
+		Internal::Submitted.Empty();
+	}
+
+	FString ToJson()
+	{
+		const TArray<TSharedPtr<FContextProfile>> Profiles = Internal::GetSubmitted();
+
+		FString Out = TEXT("{\n\t\"profiles\": [");
+		for (int32 p = 0; p < Profiles.Num(); p++)
+		{
+			const FContextProfile& Profile = *Profiles[p];
+
+			Out += p ? TEXT(",\n\t\t{") : TEXT("\n\t\t{");
+			Out += FString::Printf(
+				TEXT("\n\t\t\t\"node\": \"%s\",\n\t\t\t\"source\": \"%s\",\n\t\t\t\"totalMs\": %.4f,\n\t\t\t\"groups\": ["),
+				*Internal::EscapeJson(Profile.NodeName), *Internal::EscapeJson(Profile.SourceName), Profile.TotalTime);
+
+			const TArray<FRecord> Records = Profile.GetRecords();
+			for (int32 r = 0; r < Records.Num(); r++)
+			{
+				const FRecord& Record = Records[r];
+				Out += FString::Printf(
+					TEXT("%s\n\t\t\t\t{\"path\": \"%s\", \"runs\": %d, \"tasks\": %d, \"peakConcurrency\": %d, \"wallMs\": %.4f, \"busyMs\": %.4f, \"waitMs\": %.4f, \"maxWaitMs\": %.4f}"),
+					r ? TEXT(",") : TEXT(""), *Internal::EscapeJson(Record.Path), Record.NumRuns, Record.NumTasks, Record.PeakConcurrency,
+					Record.WallTime, Record.BusyTime, Record.WaitTime, Record.MaxWaitTime);
+			}
+
+			Out += Records.IsEmpty() ? TEXT("]\n\t\t}") : TEXT("\n\t\t\t]\n\t\t}");
+		}
+		Out += Profiles.IsEmpty() ? TEXT("]\n}\n") : TEXT("\n\t]\n}\n");
+
+		return Out;
+	}
+
+	FString ToCsv()
+	{
+		const TArray<TSharedPtr<FContextProfile>> Profiles = Internal::GetSubmitted();
+
+		FString Out = TEXT("Node,Source,TotalMs,Path,Runs,Tasks,PeakConcurrency,WallMs,BusyMs,WaitMs,MaxWaitMs\n");
+		for (const TSharedPtr<FContextProfile>& Profile : Profiles)
+		{
+			const FString Prefix = FString::Printf(TEXT("%s,%s,%.4f"), *Internal::EscapeCsv(Profile->NodeName), *Internal::EscapeCsv(Profile->SourceName), Profile->TotalTime);
+			for (const FRecord& Record : Profile->GetRecords())
+			{
+				Out += FString::Printf(
+					TEXT("%s,%s,%d,%d,%d,%.4f,%.4f,%.4f,%.4f\n"),
+					*Prefix, *Internal::EscapeCsv(Record.Path), Record.NumRuns, Record.NumTasks, Record.PeakConcurrency,
+					Record.WallTime, Record.BusyTime, Record.WaitTime, Record.MaxWaitTime);
+			}
+		}
+
+		return Out;
+	}
+
+#pragma endregion
+
+#pragma region Console Commands
+
+	// Usable headless through -ExecCmds, e.g. -ExecCmds="pcgex.Profile.Enabled 1" then "pcgex.Profile.Dump csv Out.csv"
+	static FAutoConsoleCommand CommandDumpProfile(
+		TEXT("pcgex.Profile.Dump"),
+		TEXT("Writes every submitted PCGEx node profile. Args: [json|csv] [FilePath]. Without a path, writes to the profiling directory."),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				const bool bCsv = Args.Num() > 0 && Args[0].Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+
+				FString FilePath = Args.Num() > 1 ? Args[1] : FString();
+				if (FilePath.IsEmpty())
+				{
+					FilePath = FPaths::ProfilingDir() / TEXT("PCGEx") / FString::Printf(TEXT("PCGExProfile-%s.%s"), *FDateTime::Now().ToString(), bCsv ? TEXT("csv") : TEXT("json"));
+				}
+
+				if (FFileHelper::SaveStringToFile(bCsv ? ToCsv() : ToJson(), *FilePath))
+				{
+					UE_LOG(LogPCGEx, Display, TEXT("PCGEx profile written to %s"), *FilePath);
+				}
+				else
+				{
+					UE_LOG(LogPCGEx, Error, TEXT("Failed to write PCGEx profile to %s"), *FilePath);
+				}
+			}));
+
+	static FAutoConsoleCommand CommandResetProfile(
+		TEXT("pcgex.Profile.Reset"),
+		TEXT("Drops every submitted PCGEx node profile."),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				ResetSubmitted();
+			}));
+
+#pragma endregion
+}
@@ -108,6 +108,18 @@ namespace PCGExData
 		*(OutValues->GetData() + Index) = Value;
 	}
 
+	template <typename T>
+	const T* TArrayBuffer<T>::GetReadData() const
+	{
+		return InValues ? InValues->GetData() : nullptr;
+	}
+
+	template <typename T>
+	T* TArrayBuffer<T>::GetWriteData()
+	{
+		return OutValues ? OutValues->GetData() : nullptr;
+	}
+
 	template <typename T>
 	PCGExValueHash TArrayBuffer<T>::ReadValueHash(const int32 Index)
 	{
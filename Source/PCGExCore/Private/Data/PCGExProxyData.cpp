@@ -248,6 +248,28 @@ namespace PCGExData
 		// Default: no-op. Override in property proxies.
 	}
 
+	void IBufferProxy::GetVoids(TConstArrayView<int32> Indices, void* OutValues) const
+	{
+		const int32 Stride = GetValueSize();
+		uint8* Out = static_cast<uint8*>(OutValues);
+		for (const int32 Index : Indices)
+		{
+			GetVoid(Index, Out);
+			Out += Stride;
+		}
+	}
+
+	void IBufferProxy::SetVoids(TConstArrayView<int32> Indices, const void* InValues) const
+	{
+		const int32 Stride = GetValueSize();
+		const uint8* In = static_cast<const uint8*>(InValues);
+		for (const int32 Index : Indices)
+		{
+			SetVoid(Index, In);
+			In += Stride;
+		}
+	}
+
 	PCGExTypes::FScopedTypedValue IBufferProxy::CreateScopedWorkingValue() const
 	{
 		// Property-backed buffers deep-copy the property's own representation into this storage --
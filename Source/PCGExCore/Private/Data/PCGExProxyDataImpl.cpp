@@ -145,6 +145,48 @@ namespace PCGExData
 		}
 	}
 
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::GetVoids(TConstArrayView<int32> Indices, void* OutValues) const
+	{
+		check(Buffer);
+
+		const T_REAL* RealValues = (bWantsSubSelection || RealType != WorkingType) ? nullptr : Buffer->GetReadData();
+		if (!RealValues)
+		{
+			IBufferProxy::GetVoids(Indices, OutValues);
+			return;
+		}
+
+		// Same type, flat storage - plain typed gather
+		T_REAL* Out = static_cast<T_REAL*>(OutValues);
+		const int32 Num = Indices.Num();
+		for (int32 i = 0; i < Num; i++)
+		{
+			Out[i] = RealValues[Indices[i]];
+		}
+	}
+
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::SetVoids(TConstArrayView<int32> Indices, const void* InValues) const
+	{
+		check(Buffer);
+
+		T_REAL* RealValues = (bWantsSubSelection || RealType != WorkingType) ? nullptr : Buffer->GetWriteData();
+		if (!RealValues)
+		{
+			IBufferProxy::SetVoids(Indices, InValues);
+			return;
+		}
+
+		// Same type, flat storage - plain typed scatter
+		const T_REAL* In = static_cast<const T_REAL*>(InValues);
+		const int32 Num = Indices.Num();
+		for (int32 i = 0; i < Num; i++)
+		{
+			RealValues[Indices[i]] = In[i];
+		}
+	}
+
 	template <typename T_REAL>
 	TSharedPtr<IBuffer> TAttributeBufferProxy<T_REAL>::GetBuffer() const
 	{
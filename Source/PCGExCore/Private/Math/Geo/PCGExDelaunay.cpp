@@ -14,6 +14,8 @@
 #include "Math/Geo/PCGExPrimtives.h"
 #include "CompGeom/ExactPredicates.h"
 #include "ThirdParty/Delaunator/include/delaunator.hpp"
+#include "PCGExFlatIndex.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExMath::Geo
 {
@@ -64,6 +66,246 @@ namespace PCGExMath::Geo
 		}
 	}
 
+	namespace DelaunayInternal
+	{
+		// Strips smaller than this aren't worth a task; their seams would outweigh the gain.
+		constexpr int32 MinPointsPerStrip = 32768;
+		constexpr int32 NumBins = 1 << 16;
+
+		void EnsureExactPredicates()
+		{
+			// delaunator now routes its predicates through UE's exact predicates (see delaunator.hpp),
+			// which require a one-time GlobalInit() before use. GeometryAlgorithms' module startup already
+			// calls it; this guarded call makes the dependency explicit and is a thread-safe no-op after
+			// the first invocation (C++ guarantees once-only init of a function-local static).
+			static const bool bExactPredicatesReady = []()
+			{
+				UE::Geometry::ExactPredicates::GlobalInit();
+				return true;
+			}();
+			(void)bExactPredicatesReady;
+		}
+
+		bool WantsPartition(const int32 NumPositions)
+		{
+			const int32 MinPoints = PCGEX_CORE_SETTINGS.ParallelDelaunayMinPoints;
+			return MinPoints > 0 && NumPositions >= MinPoints && NumPositions >= MinPointsPerStrip * 2;
+		}
+
+		/**
+		 * Vertical strips over the input X range. Points are binned along X and strips are runs of bins holding
+		 * roughly the same number of points, so Lo/Hi are bin edges and every point of a strip lies within them.
+		 */
+		struct FStrips
+		{
+			const double* Coords = nullptr;
+			double MinX = 0;
+			double InvBinWidth = 0;
+			double Slack = 0;
+
+			TArray<int32> BinToStrip;
+			TArray<double> Lo;
+			TArray<double> Hi;
+
+			FORCEINLINE int32 Num() const
+			{
+				return Lo.Num();
+			}
+
+			FORCEINLINE int32 GetBin(const double X) const
+			{
+				const double Bin = (X - MinX) * InvBinWidth;
+				return Bin <= 0 ? 0 : Bin >= NumBins - 1 ? NumBins - 1 : static_cast<int32>(Bin);
+			}
+
+			FORCEINLINE int32 GetStrip(const double X) const
+			{
+				return BinToStrip[GetBin(X)];
+			}
+
+			/** Circumcircle of A, B, C. Vertices are read in index order so every triangulation yields the exact same values. */
+			bool GetCircle(int32 A, int32 B, int32 C, double& OutX, double& OutY, double& OutRadius) const
+			{
+				if (A > B) { Swap(A, B); }
+				if (B > C) { Swap(B, C); }
+				if (A > B) { Swap(A, B); }
+
+				const double AX = Coords[A * 2];
+				const double AY = Coords[A * 2 + 1];
+				const std::pair<double, double> Center = delaunator::circumcenter(AX, AY, Coords[B * 2], Coords[B * 2 + 1], Coords[C * 2], Coords[C * 2 + 1]);
+
+				OutX = Center.first;
+				OutY = Center.second;
+				OutRadius = FMath::Sqrt((OutX - AX) * (OutX - AX) + (OutY - AY) * (OutY - AY));
+
+				return FMath::IsFinite(OutX) && FMath::IsFinite(OutY) && FMath::IsFinite(OutRadius);
+			}
+
+			/**
+			 * True when the circumdisk of A, B, C lies strictly inside a single strip. No point of another strip can be
+			 * in it, so a triangle that is Delaunay within its strip and passes this test is Delaunay globally.
+			 */
+			bool IsFinal(const int32 A, const int32 B, const int32 C) const
+			{
+				double X, Y, Radius;
+				if (!GetCircle(A, B, C, X, Y, Radius))
+				{
+					return false;
+				}
+
+				const int32 Strip = GetStrip(X);
+				const double Margin = Slack + Radius * 1e-9;
+				return X - Radius > Lo[Strip] + Margin && X + Radius < Hi[Strip] - Margin;
+			}
+		};
+
+		/** Triangles a strip got right on its own, plus the vertices the seam pass must re-triangulate. */
+		struct FStripResult
+		{
+			TArray<int32> Triangles;      // Global vtx indices, 3 per final triangle, Delaunator winding
+			TArray<int32> Links;          // Per half-edge, the final triangle across it within the strip, or -1
+			TArray<int32> SeamVertices;
+		};
+
+		void TriangulateStrip(const FStrips& Strips, const TArray<int32>& Vertices, FStripResult& OutResult)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::TriangulateStrip);
+
+			const int32 NumLocal = Vertices.Num();
+			if (NumLocal < 3)
+			{
+				OutResult.SeamVertices = Vertices;
+				return;
+			}
+
+			std::vector<double> LocalCoords(NumLocal * 2);
+			for (int32 i = 0; i < NumLocal; i++)
+			{
+				LocalCoords[i * 2] = Strips.Coords[Vertices[i] * 2];
+				LocalCoords[i * 2 + 1] = Strips.Coords[Vertices[i] * 2 + 1];
+			}
+
+			const delaunator::Delaunator D(LocalCoords);
+			if (D.runtime_error || D.triangles.empty())
+			{
+				// Collinear or otherwise degenerate strip: hand every point to the seam pass
+				OutResult.SeamVertices = Vertices;
+				return;
+			}
+
+			const int32 NumHalfedges = static_cast<int32>(D.triangles.size());
+			const int32 NumTriangles = NumHalfedges / 3;
+			const std::size_t* Triangles = D.triangles.data();
+			const std::size_t* Halfedges = D.halfedges.data();
+
+			TArray<int32> LocalToFinal;
+			LocalToFinal.SetNumUninitialized(NumTriangles);
+
+			TBitArray<> IsSeam;
+			IsSeam.Init(false, NumLocal);
+
+			int32 NumFinal = 0;
+			for (int32 t = 0; t < NumTriangles; t++)
+			{
+				const int32 Base = t * 3;
+				if (Strips.IsFinal(Vertices[Triangles[Base]], Vertices[Triangles[Base + 1]], Vertices[Triangles[Base + 2]]))
+				{
+					LocalToFinal[t] = NumFinal++;
+					continue;
+				}
+
+				LocalToFinal[t] = -1;
+				for (int32 k = 0; k < 3; k++)
+				{
+					IsSeam[Triangles[Base + k]] = true;
+				}
+			}
+
+			// Hull half-edges chain around the local hull; their start vertices cover it.
+			// Those points may connect to other strips, so they join the seam.
+			for (int32 e = 0; e < NumHalfedges; e++)
+			{
+				if (Halfedges[e] == delaunator::INVALID_INDEX)
+				{
+					IsSeam[Triangles[e]] = true;
+				}
+			}
+
+			OutResult.Triangles.SetNumUninitialized(NumFinal * 3);
+			OutResult.Links.SetNumUninitialized(NumFinal * 3);
+
+			for (int32 t = 0; t < NumTriangles; t++)
+			{
+				const int32 Final = LocalToFinal[t];
+				if (Final == -1)
+				{
+					continue;
+				}
+
+				for (int32 k = 0; k < 3; k++)
+				{
+					const std::size_t e = t * 3 + k;
+					const std::size_t Opposite = Halfedges[e];
+					OutResult.Triangles[Final * 3 + k] = Vertices[Triangles[e]];
+					OutResult.Links[Final * 3 + k] = Opposite == delaunator::INVALID_INDEX ? -1 : LocalToFinal[Opposite / 3];
+				}
+			}
+
+			OutResult.SeamVertices.Reserve(NumLocal - NumFinal / 2);
+			for (TConstSetBitIterator<> It(IsSeam); It; ++It)
+			{
+				OutResult.SeamVertices.Add(Vertices[It.GetIndex()]);
+			}
+		}
+
+		/** Longest edge of every site, sorted and deduplicated. */
+		template <typename SiteType>
+		void GetLongestEdges(const TArray<SiteType>& Sites, const TArrayView<FVector>& Positions, TArray<uint64>& OutEdges)
+		{
+			const int32 NumSites = Sites.Num();
+			OutEdges.SetNumUninitialized(NumSites);
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				GetLongestEdge(Positions, Sites[i].Vtx, OutEdges[i]);
+				)
+
+			OutEdges.Sort();
+
+			int32 WriteIndex = 0;
+			for (int32 i = 0; i < NumSites; i++)
+			{
+				if (WriteIndex == 0 || OutEdges[WriteIndex - 1] != OutEdges[i])
+				{
+					OutEdges[WriteIndex++] = OutEdges[i];
+				}
+			}
+			OutEdges.SetNum(WriteIndex);
+		}
+
+		/** Removes every entry of Sorted from Edges; both must be sorted. Single merge pass. */
+		void RemoveSorted(TArray<uint64>& Edges, const TArray<uint64>& Sorted)
+		{
+			int32 WriteIndex = 0;
+			int32 r = 0;
+			for (int32 i = 0; i < Edges.Num(); i++)
+			{
+				const uint64 Edge = Edges[i];
+				while (r < Sorted.Num() && Sorted[r] < Edge)
+				{
+					r++;
+				}
+
+				if (r < Sorted.Num() && Sorted[r] == Edge)
+				{
+					continue;
+				}
+
+				Edges[WriteIndex++] = Edge;
+			}
+			Edges.SetNum(WriteIndex);
+		}
+	}
+
 	TDelaunay2::~TDelaunay2()
 	{
 		Clear();
@@ -91,6 +333,12 @@ namespace PCGExMath::Geo
 		{
 			std::vector<double> Coords(Positions.Num() * 2);
 			ProjectionDetails.Project(Positions, Coords);
+
+			if (DelaunayInternal::WantsPartition(Positions.Num()) && ProcessPartitioned(Coords, bComputeDelaunayEdges, bComputeHull))
+			{
+				return true;
+			}
+
 			return ProcessDelaunator(Coords, bComputeDelaunayEdges, bComputeHull);
 		}
 
@@ -119,6 +367,12 @@ namespace PCGExMath::Geo
 				Coords[ii] = P.X;
 				Coords[ii + 1] = P.Y;
 				)
+
+			if (DelaunayInternal::WantsPartition(NumPositions) && ProcessPartitioned(Coords, bComputeDelaunayEdges, bComputeHull))
+			{
+				return true;
+			}
+
 			return ProcessDelaunator(Coords, bComputeDelaunayEdges, bComputeHull);
 		}
 
@@ -133,16 +387,7 @@ namespace PCGExMath::Geo
 
 	bool TDelaunay2::ProcessDelaunator(const std::vector<double>& Coords, const bool bComputeDelaunayEdges, const bool bComputeHull)
 	{
-		// delaunator now routes its predicates through UE's exact predicates (see delaunator.hpp),
-		// which require a one-time GlobalInit() before use. GeometryAlgorithms' module startup already
-		// calls it; this guarded call makes the dependency explicit and is a thread-safe no-op after
-		// the first invocation (C++ guarantees once-only init of a function-local static).
-		static const bool bExactPredicatesReady = []()
-		{
-			UE::Geometry::ExactPredicates::GlobalInit();
-			return true;
-		}();
-		(void)bExactPredicatesReady;
+		DelaunayInternal::EnsureExactPredicates();
 
 		// NOTE: delaunator keeps a reference to Coords; it must stay alive for the
 		// lifetime of the triangulation object.
@@ -202,200 +447,617 @@ namespace PCGExMath::Geo
 				)
 		}
 
-		if (bComputeDelaunayEdges || bComputeHull)
+		Triangulation.Reset();
+		BuildEdgesAndHull(static_cast<int32>(Coords.size() / 2), bComputeDelaunayEdges, bComputeHull);
+
+		IsValid = true;
+		return IsValid;
+	}
+
+	bool TDelaunay2::ProcessPartitioned(const std::vector<double>& Coords, const bool bComputeDelaunayEdges, const bool bComputeHull)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TDelaunay2::ProcessPartitioned);
+
+		// Strips are triangulated on their own. A strip triangle whose circumdisk stays strictly inside the strip
+		// is final (see FStrips::IsFinal). Any other global triangle only has vertices that touch a non-final strip
+		// triangle or lie on a strip hull -- a vertex surrounded by final triangles already has its whole global fan.
+		// Those seam vertices are triangulated once more, and the non-final seam triangles that have no input point
+		// strictly inside their circumcircle complete the triangulation.
+
+		DelaunayInternal::EnsureExactPredicates();
+
+		const int32 NumPoints = static_cast<int32>(Coords.size() / 2);
+		const int32 NumStrips = FMath::Min(NumPoints / DelaunayInternal::MinPointsPerStrip, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() * 2));
+		if (NumStrips < 2)
 		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::BuildEdgesAndHull);
+			return false;
+		}
 
-			std::size_t NumHullEdges = 0;
-			for (std::size_t e = 0; e < NumHalfedges; e++)
-			{
-				if (Halfedges[e] == delaunator::INVALID_INDEX)
-				{
-					NumHullEdges++;
-				}
-			}
+		DelaunayInternal::FStrips Strips;
+		Strips.Coords = Coords.data();
 
-			if (bComputeDelaunayEdges)
+		TArray<TArray<int32>> StripVertices;
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::Partition);
+
+			double MinX = TNumericLimits<double>::Max();
+			double MaxX = TNumericLimits<double>::Lowest();
+			for (int32 i = 0; i < NumPoints; i++)
 			{
-				// Interior edges are shared by two halfedges, hull edges by one.
-				DelaunayEdges.Reserve(static_cast<int32>((NumHalfedges - NumHullEdges) / 2 + NumHullEdges));
+				MinX = FMath::Min(MinX, Coords[i * 2]);
+				MaxX = FMath::Max(MaxX, Coords[i * 2]);
 			}
-			if (bComputeHull)
+
+			const double Range = MaxX - MinX;
+			if (!(Range > 0) || !FMath::IsFinite(Range))
 			{
-				DelaunayHull.Reserve(static_cast<int32>(NumHullEdges));
+				return false;
 			}
 
-			// Each undirected edge is visited exactly once: hull halfedges have no twin,
-			// interior pairs are claimed by the smaller halfedge index. No dedup required.
-			for (std::size_t e = 0; e < NumHalfedges; e++)
+			Strips.MinX = MinX;
+			Strips.InvBinWidth = DelaunayInternal::NumBins / Range;
+			Strips.Slack = Range * 1e-9;
+
+			TArray<int32> Histogram;
+			Histogram.Init(0, DelaunayInternal::NumBins);
+			for (int32 i = 0; i < NumPoints; i++)
 			{
-				const std::size_t Opposite = Halfedges[e];
-				const bool bHullEdge = Opposite == delaunator::INVALID_INDEX;
+				Histogram[Strips.GetBin(Coords[i * 2])]++;
+			}
 
-				if (!bHullEdge && Opposite < e)
-				{
-					continue;
-				}
+			// Cut after the bin that crosses each strip's share; never leave trailing strips empty
+			const double BinWidth = Range / DelaunayInternal::NumBins;
+			const int32 Share = FMath::DivideAndRoundUp(NumPoints, NumStrips);
 
-				const std::size_t Next = (e % 3 == 2) ? e - 2 : e + 1;
-				const int32 A = static_cast<int32>(Triangles[e]);
-				const int32 B = static_cast<int32>(Triangles[Next]);
+			Strips.BinToStrip.SetNumUninitialized(DelaunayInternal::NumBins);
+			Strips.Lo.Add(TNumericLimits<double>::Lowest());
 
-				if (bComputeDelaunayEdges)
-				{
-					DelaunayEdges.Add(PCGEx::H64U(A, B));
-				}
+			int32 Count = 0;
+			for (int32 b = 0; b < DelaunayInternal::NumBins; b++)
+			{
+				Strips.BinToStrip[b] = Strips.Num() - 1;
+				Count += Histogram[b];
 
-				if (bHullEdge && bComputeHull)
+				if (Count >= Share * Strips.Num() && Count < NumPoints && Strips.Num() < NumStrips)
 				{
-					DelaunayHull.Add(A);
-					DelaunayHull.Add(B);
+					const double Edge = MinX + (b + 1) * BinWidth;
+					Strips.Hi.Add(Edge);
+					Strips.Lo.Add(Edge);
 				}
 			}
-		}
 
-		IsValid = true;
-		return IsValid;
-	}
+			Strips.Hi.Add(TNumericLimits<double>::Max());
 
-	bool TDelaunay2::ProcessFallback(const TArray<FVector2D>& ProjectedPositions, const bool bComputeDelaunayEdges, const bool bComputeHull)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(TDelaunay2::ProcessFallback);
+			StripVertices.SetNum(Strips.Num());
+			TArray<int32> StripCounts;
+			StripCounts.Init(0, Strips.Num());
+			for (int32 b = 0; b < DelaunayInternal::NumBins; b++)
+			{
+				StripCounts[Strips.BinToStrip[b]] += Histogram[b];
+			}
 
-		UE::Geometry::FDelaunay2 Delaunay2;
-		if (!Delaunay2.Triangulate(ProjectedPositions))
-		{
-			return false;
+			for (int32 s = 0; s < Strips.Num(); s++)
+			{
+				StripVertices[s].Reserve(StripCounts[s]);
+			}
+
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				StripVertices[Strips.GetStrip(Coords[i * 2])].Add(i);
+			}
 		}
 
-		TArray<UE::Geometry::FIndex3i> Triangles = Delaunay2.GetTriangles();
-		const int32 NumTriangles = Triangles.Num();
+		const int32 NumActualStrips = Strips.Num();
+		TArray<DelaunayInternal::FStripResult> Results;
+		Results.SetNum(NumActualStrips);
 
-		if (!NumTriangles)
-		{
-			return false;
-		}
+		ParallelFor(
+			NumActualStrips, [&](const int32 s)
+			{
+				DelaunayInternal::TriangulateStrip(Strips, StripVertices[s], Results[s]);
+				StripVertices[s].Empty();
+			}, EParallelForFlags::Unbalanced);
 
-		// The engine triangulation does not expose adjacency, so it is rebuilt by matching
-		// shared edges between triangles. First occurrence of an edge records the owning
-		// site in EdgeMap; the second occurrence links the two owning sites as neighbors.
-		// Edges left unmatched once all sites are processed lie on the convex hull.
-		TMap<uint64, int32> EdgeMap;
-		TSet<uint64> SeenEdges;
+		StripVertices.Empty();
 
-		const int32 NumSites = NumTriangles;
-		SeenEdges.Reserve(NumSites * 2);
-		Sites.Reserve(NumSites);
-		EdgeMap.Reserve(NumSites);
+		// Seam re-triangulation
+
+		TArray<int32> SeamVertices;
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumActualStrips + 1);
 
-		auto PushEdge = [&](FDelaunaySite2& Site, const uint64 Edge)
 		{
-			bool bIsAlreadySet = false;
-			SeenEdges.Add(Edge, &bIsAlreadySet);
-			if (bIsAlreadySet)
+			int32 NumSeamVertices = 0;
+			int32 NumFinal = 0;
+			for (int32 s = 0; s < NumActualStrips; s++)
 			{
-				if (int32 Idx = -1;
-					EdgeMap.RemoveAndCopyValue(Edge, Idx))
-				{
-					FDelaunaySite2& OtherSite = Sites[Idx];
-					OtherSite.PushAdjacency(Site.Id);
-					Site.PushAdjacency(OtherSite.Id);
-				}
+				Offsets[s] = NumFinal;
+				NumFinal += Results[s].Triangles.Num() / 3;
+				NumSeamVertices += Results[s].SeamVertices.Num();
 			}
-			else
+			Offsets[NumActualStrips] = NumFinal;
+
+			SeamVertices.Reserve(NumSeamVertices);
+			for (DelaunayInternal::FStripResult& Result : Results)
 			{
-				EdgeMap.Add(Edge, Site.Id);
+				SeamVertices.Append(Result.SeamVertices);
+				Result.SeamVertices.Empty();
 			}
-		};
-
-		int32 s = 0;
-		for (const UE::Geometry::FIndex3i& T : Triangles)
-		{
-			FDelaunaySite2& Site = Sites.Emplace_GetRef(T.A, T.B, T.C, s++);
-			PushEdge(Site, Site.AB());
-			PushEdge(Site, Site.BC());
-			PushEdge(Site, Site.AC());
 		}
 
-		if (bComputeHull)
+		const int32 NumSeamVertices = SeamVertices.Num();
+		if (NumSeamVertices < 3)
 		{
-			// Edges still in EdgeMap were never matched to a second triangle: hull edges.
-			DelaunayHull.Reserve(EdgeMap.Num());
-			for (const TPair<uint64, int32>& HullEdge : EdgeMap)
-			{
-				DelaunayHull.Add(static_cast<int32>(PCGEx::H64A(HullEdge.Key)));
-				DelaunayHull.Add(static_cast<int32>(PCGEx::H64B(HullEdge.Key)));
-			}
+			return false;
 		}
 
-		if (bComputeDelaunayEdges)
+		std::vector<double> SeamCoords(NumSeamVertices * 2);
+		for (int32 i = 0; i < NumSeamVertices; i++)
 		{
-			DelaunayEdges = MoveTemp(SeenEdges);
+			SeamCoords[i * 2] = Coords[SeamVertices[i] * 2];
+			SeamCoords[i * 2 + 1] = Coords[SeamVertices[i] * 2 + 1];
 		}
 
-		IsValid = true;
-		return IsValid;
-	}
+		TUniquePtr<delaunator::Delaunator> SeamTriangulation;
 
-	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions)
-	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::TriangulateSeams);
+			SeamTriangulation = MakeUnique<delaunator::Delaunator>(SeamCoords);
 		}
-	}
 
-	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
-	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
+		const delaunator::Delaunator& SD = *SeamTriangulation;
+		if (SD.runtime_error || SD.triangles.empty())
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
+			return false;
 		}
-	}
-
-	void TDelaunay2::GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
 
-	{
-		// Flood-fill from SiteIndex through adjacent sites connected by edges in EdgeConnectors.
-		// This groups Delaunay triangles into merged "super-cells" (e.g. for Urquhart graph construction),
-		// collecting the set of connector edges traversed (OutUEdges) and the merged site indices.
-		TArray<int32> Stack;
+		const int32 NumSeamTriangles = static_cast<int32>(SD.triangles.size() / 3);
+		const std::size_t* SeamTriangles = SD.triangles.data();
+		const std::size_t* SeamHalfedges = SD.halfedges.data();
 
-		VisitedSites[SiteIndex] = false;
-		Stack.Add(SiteIndex);
+		// Seam triangles are Delaunay among seam vertices; the rest of the points are checked through a flat index
+		TArray<int32> SeamToFinal;
+		SeamToFinal.SetNumUninitialized(NumSeamTriangles);
 
-		while (!Stack.IsEmpty())
 		{
-			const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::FilterSeams);
 
-			if (VisitedSites[NextIndex])
+			TBitArray<> InSeam;
+			InSeam.Init(false, NumPoints);
+			for (const int32 V : SeamVertices)
 			{
-				continue;
+				InSeam[V] = true;
 			}
 
-			OutMerged.Add(NextIndex);
-			VisitedSites[NextIndex] = true;
+			PCGExSpatial::FFlatIndex Others;
+			Others.BuildPoints(
+				NumPoints, [&](const int32 i, FVector& OutPosition)
+				{
+					if (InSeam[i])
+					{
+						return false;
+					}
+					OutPosition = FVector(Coords[i * 2], Coords[i * 2 + 1], 0);
+					return true;
+				});
 
-			const FDelaunaySite2* Site = (Sites.GetData() + NextIndex);
+			PCGEX_PARALLEL_FOR(
+				NumSeamTriangles,
+				SeamToFinal[i] = -1;
 
-			for (int i = 0; i < 3; i++)
-			{
-				const int32 OtherIndex = Site->Neighbors[i];
-				if (OtherIndex == -1 || VisitedSites[OtherIndex])
+				const int32 Base = i * 3;
+				const int32 A = SeamVertices[SeamTriangles[Base]];
+				const int32 B = SeamVertices[SeamTriangles[Base + 1]];
+				const int32 C = SeamVertices[SeamTriangles[Base + 2]];
+
+				if (Strips.IsFinal(A, B, C))
 				{
-					continue;
+					// Already emitted by its strip
+					return;
 				}
-				const FDelaunaySite2* NeighborSite = Sites.GetData() + OtherIndex;
-				if (const uint64 SharedEdge = Site->GetSharedEdge(NeighborSite);
-					EdgeConnectors.Contains(SharedEdge))
+
+				double X, Y, Radius;
+				FVector Center;
+				if (Strips.GetCircle(A, B, C, X, Y, Radius))
 				{
-					OutUEdges.Add(SharedEdge);
-					Stack.Add(OtherIndex);
+					Center = FVector(X, Y, 0);
+					Radius = Radius * (1 + 1e-9) + Strips.Slack;
+				}
+				else
+				{
+					// Near-collinear sliver; test everything
+					const FBox Bounds = Others.GetBounds();
+					Center = Bounds.GetCenter();
+					Radius = Bounds.GetExtent().Size() + 1;
+				}
+
+				const double AX = Coords[A * 2];
+				const double AY = Coords[A * 2 + 1];
+				const double BX = Coords[B * 2];
+				const double BY = Coords[B * 2 + 1];
+				const double CX = Coords[C * 2];
+				const double CY = Coords[C * 2 + 1];
+
+				const bool bEmpty = Others.FindFirstElementInSphere(
+					Center, Radius, [&](const int32 P)
+					{
+						// A, B, C in Delaunator winding, as its legalization expects
+						return !delaunator::in_circle(AX, AY, BX, BY, CX, CY, Coords[P * 2], Coords[P * 2 + 1]);
+					});
+
+				if (bEmpty)
+				{
+					SeamToFinal[i] = 0;
+				}
+				)
+		}
+
+		int32 NumSites = Offsets[NumActualStrips];
+		const int32 SeamOffset = NumSites;
+		for (int32 i = 0; i < NumSeamTriangles; i++)
+		{
+			if (SeamToFinal[i] != -1)
+			{
+				SeamToFinal[i] = NumSites++;
+			}
+		}
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::BuildSites);
+
+			Sites.SetNumUninitialized(NumSites);
+
+			ParallelFor(
+				NumActualStrips, [&](const int32 s)
+				{
+					DelaunayInternal::FStripResult& Result = Results[s];
+					const int32 Offset = Offsets[s];
+					const int32 NumStripSites = Result.Triangles.Num() / 3;
+
+					for (int32 t = 0; t < NumStripSites; t++)
+					{
+						FDelaunaySite2& Site = Sites[Offset + t];
+						Site.Id = Offset + t;
+						for (int32 k = 0; k < 3; k++)
+						{
+							const int32 Link = Result.Links[t * 3 + k];
+							Site.Vtx[k] = Result.Triangles[t * 3 + k];
+							Site.Neighbors[k] = Link == -1 ? -1 : Offset + Link;
+						}
+					}
+
+					Result.Triangles.Empty();
+					Result.Links.Empty();
+				}, EParallelForFlags::Unbalanced);
+
+			PCGEX_PARALLEL_FOR(
+				NumSeamTriangles,
+				const int32 Final = SeamToFinal[i];
+				if (Final == -1)
+				{
+					return;
+				}
+
+				FDelaunaySite2& Site = Sites[Final];
+				Site.Id = Final;
+				for (int32 k = 0; k < 3; k++)
+				{
+					const std::size_t e = i * 3 + k;
+					const std::size_t Opposite = SeamHalfedges[e];
+					Site.Vtx[k] = SeamVertices[SeamTriangles[e]];
+					Site.Neighbors[k] = Opposite == delaunator::INVALID_INDEX ? -1 : SeamToFinal[Opposite / 3];
+				}
+				)
+		}
+
+		Results.Empty();
+		SeamTriangulation.Reset();
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::Stitch);
+
+			// Half-edges with no neighbor yet either face the other side of a seam or lie on the hull.
+			// Matching them by undirected key links the former; whatever remains unmatched is hull.
+			TArray<PCGEx::FIndexKey> Open;
+			Open.Reserve(NumSeamVertices * 3);
+
+			for (int32 i = 0; i < NumSites; i++)
+			{
+				const FDelaunaySite2& Site = Sites[i];
+				for (int32 k = 0; k < 3; k++)
+				{
+					if (Site.Neighbors[k] == -1)
+					{
+						Open.Emplace(i * 3 + k, PCGEx::H64U(Site.Vtx[k], Site.Vtx[(k + 1) % 3]));
+					}
+				}
+			}
+
+			PCGExSortingHelpers::RadixSort(Open);
+
+			int32 NumHullEdges = 0;
+			for (int32 i = 0; i < Open.Num();)
+			{
+				int32 j = i + 1;
+				while (j < Open.Num() && Open[j].Key == Open[i].Key)
+				{
+					j++;
+				}
+
+				if (j - i == 1)
+				{
+					NumHullEdges++;
+				}
+				else if (j - i == 2)
+				{
+					const int32 First = Open[i].Index;
+					const int32 Second = Open[i + 1].Index;
+					Sites[First / 3].Neighbors[First % 3] = Second / 3;
+					Sites[Second / 3].Neighbors[Second % 3] = First / 3;
+				}
+				else
+				{
+					// Overlapping triangles; only possible when cocircular points were split differently across a seam
+					Clear();
+					return false;
+				}
+
+				i = j;
+			}
+
+			// A triangulation of V points with H hull edges has exactly 2V - H - 2 triangles. Anything else means the
+			// stitched pieces left a hole or overlap (again, degenerate input) -- let the single pass handle it.
+			TBitArray<> Used;
+			Used.Init(false, NumPoints);
+			for (const FDelaunaySite2& Site : Sites)
+			{
+				Used[Site.Vtx[0]] = true;
+				Used[Site.Vtx[1]] = true;
+				Used[Site.Vtx[2]] = true;
+			}
+
+			if (NumSites != 2 * Used.CountSetBits() - NumHullEdges - 2)
+			{
+				Clear();
+				return false;
+			}
+
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				FDelaunaySite2& Site = Sites[i];
+				Site.bOnHull = Site.Neighbors[0] == -1 || Site.Neighbors[1] == -1 || Site.Neighbors[2] == -1;
+				)
+		}
+
+		BuildEdgesAndHull(NumPoints, bComputeDelaunayEdges, bComputeHull);
+
+		IsValid = true;
+		return IsValid;
+	}
+
+	void TDelaunay2::BuildEdgesAndHull(const int32 NumVertices, const bool bComputeDelaunayEdges, const bool bComputeHull)
+	{
+		if (!bComputeDelaunayEdges && !bComputeHull)
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::BuildEdgesAndHull);
+
+		const int32 NumSites = Sites.Num();
+
+		if (bComputeHull)
+		{
+			for (const FDelaunaySite2& Site : Sites)
+			{
+				if (!Site.bOnHull)
+				{
+					continue;
+				}
+
+				for (int32 k = 0; k < 3; k++)
+				{
+					if (Site.Neighbors[k] == -1)
+					{
+						DelaunayHull.Add(Site.Vtx[k]);
+						DelaunayHull.Add(Site.Vtx[(k + 1) % 3]);
+					}
+				}
+			}
+		}
+
+		if (!bComputeDelaunayEdges)
+		{
+			return;
+		}
+
+		// Each undirected edge is emitted once: by its only site on the hull, otherwise by the lower site id.
+		// H64U keys sort by their larger vertex first, so a counting sort on that vertex followed by a
+		// tiny sort within each bucket yields the fully sorted array without a global comparison sort.
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumVertices + 1);
+
+		PCGEX_PARALLEL_FOR(
+			NumSites,
+			const FDelaunaySite2& Site = Sites[i];
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (Site.Neighbors[k] == -1 || Site.Neighbors[k] > i)
+				{
+					FPlatformAtomics::InterlockedIncrement(&Offsets[FMath::Max(Site.Vtx[k], Site.Vtx[(k + 1) % 3]) + 1]);
+				}
+			}
+			)
+
+		for (int32 v = 0; v < NumVertices; v++)
+		{
+			Offsets[v + 1] += Offsets[v];
+		}
+
+		DelaunayEdges.SetNumUninitialized(Offsets[NumVertices]);
+
+		TArray<int32> Cursors(Offsets.GetData(), NumVertices);
+
+		PCGEX_PARALLEL_FOR(
+			NumSites,
+			const FDelaunaySite2& Site = Sites[i];
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (Site.Neighbors[k] == -1 || Site.Neighbors[k] > i)
+				{
+					const int32 A = Site.Vtx[k];
+					const int32 B = Site.Vtx[(k + 1) % 3];
+					const int32 Slot = FPlatformAtomics::InterlockedIncrement(&Cursors[FMath::Max(A, B)]) - 1;
+					DelaunayEdges[Slot] = PCGEx::H64U(A, B);
+				}
+			}
+			)
+
+		PCGEX_PARALLEL_FOR(
+			NumVertices,
+			const int32 Start = Offsets[i];
+			const int32 Count = Offsets[i + 1] - Start;
+			if (Count > 1)
+			{
+				MakeArrayView(DelaunayEdges.GetData() + Start, Count).Sort();
+			}
+			)
+	}
+
+	bool TDelaunay2::ProcessFallback(const TArray<FVector2D>& ProjectedPositions, const bool bComputeDelaunayEdges, const bool bComputeHull)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TDelaunay2::ProcessFallback);
+
+		UE::Geometry::FDelaunay2 Delaunay2;
+		if (!Delaunay2.Triangulate(ProjectedPositions))
+		{
+			return false;
+		}
+
+		TArray<UE::Geometry::FIndex3i> Triangles = Delaunay2.GetTriangles();
+		const int32 NumTriangles = Triangles.Num();
+
+		if (!NumTriangles)
+		{
+			return false;
+		}
+
+		// The engine triangulation does not expose adjacency, so it is rebuilt by matching
+		// shared edges between triangles. First occurrence of an edge records the owning
+		// site in EdgeMap; the second occurrence links the two owning sites as neighbors.
+		// Edges left unmatched once all sites are processed lie on the convex hull.
+		TMap<uint64, int32> EdgeMap;
+		TSet<uint64> SeenEdges;
+
+		const int32 NumSites = NumTriangles;
+		SeenEdges.Reserve(NumSites * 2);
+		Sites.Reserve(NumSites);
+		EdgeMap.Reserve(NumSites);
+
+		auto PushEdge = [&](FDelaunaySite2& Site, const uint64 Edge)
+		{
+			bool bIsAlreadySet = false;
+			SeenEdges.Add(Edge, &bIsAlreadySet);
+			if (bIsAlreadySet)
+			{
+				if (int32 Idx = -1;
+					EdgeMap.RemoveAndCopyValue(Edge, Idx))
+				{
+					FDelaunaySite2& OtherSite = Sites[Idx];
+					OtherSite.PushAdjacency(Site.Id);
+					Site.PushAdjacency(OtherSite.Id);
+				}
+			}
+			else
+			{
+				EdgeMap.Add(Edge, Site.Id);
+			}
+		};
+
+		int32 s = 0;
+		for (const UE::Geometry::FIndex3i& T : Triangles)
+		{
+			FDelaunaySite2& Site = Sites.Emplace_GetRef(T.A, T.B, T.C, s++);
+			PushEdge(Site, Site.AB());
+			PushEdge(Site, Site.BC());
+			PushEdge(Site, Site.AC());
+		}
+
+		if (bComputeHull)
+		{
+			// Edges still in EdgeMap were never matched to a second triangle: hull edges.
+			DelaunayHull.Reserve(EdgeMap.Num());
+			for (const TPair<uint64, int32>& HullEdge : EdgeMap)
+			{
+				DelaunayHull.Add(static_cast<int32>(PCGEx::H64A(HullEdge.Key)));
+				DelaunayHull.Add(static_cast<int32>(PCGEx::H64B(HullEdge.Key)));
+			}
+		}
+
+		if (bComputeDelaunayEdges)
+		{
+			DelaunayEdges = SeenEdges.Array();
+			DelaunayEdges.Sort();
+		}
+
+		IsValid = true;
+		return IsValid;
+	}
+
+	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	{
+		TArray<uint64> LongestEdges;
+		DelaunayInternal::GetLongestEdges(Sites, Positions, LongestEdges);
+		DelaunayInternal::RemoveSorted(DelaunayEdges, LongestEdges);
+	}
+
+	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	{
+		TArray<uint64> SortedLongestEdges;
+		DelaunayInternal::GetLongestEdges(Sites, Positions, SortedLongestEdges);
+		DelaunayInternal::RemoveSorted(DelaunayEdges, SortedLongestEdges);
+		LongestEdges.Append(SortedLongestEdges);
+	}
+
+	void TDelaunay2::GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
+
+	{
+		// Flood-fill from SiteIndex through adjacent sites connected by edges in EdgeConnectors.
+		// This groups Delaunay triangles into merged "super-cells" (e.g. for Urquhart graph construction),
+		// collecting the set of connector edges traversed (OutUEdges) and the merged site indices.
+		TArray<int32> Stack;
+
+		VisitedSites[SiteIndex] = false;
+		Stack.Add(SiteIndex);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
+
+			if (VisitedSites[NextIndex])
+			{
+				continue;
+			}
+
+			OutMerged.Add(NextIndex);
+			VisitedSites[NextIndex] = true;
+
+			const FDelaunaySite2* Site = (Sites.GetData() + NextIndex);
+
+			for (int i = 0; i < 3; i++)
+			{
+				const int32 OtherIndex = Site->Neighbors[i];
+				if (OtherIndex == -1 || VisitedSites[OtherIndex])
+				{
+					continue;
+				}
+				const FDelaunaySite2* NeighborSite = Sites.GetData() + OtherIndex;
+				if (const uint64 SharedEdge = Site->GetSharedEdge(NeighborSite);
+					EdgeConnectors.Contains(SharedEdge))
+				{
+					OutUEdges.Add(SharedEdge);
+					Stack.Add(OtherIndex);
 				}
 			}
 		}
@@ -403,23 +1065,411 @@ namespace PCGExMath::Geo
 		VisitedSites[SiteIndex] = true;
 	}
 
-	FDelaunaySite3::FDelaunaySite3(const FIntVector4& InVtx, const int32 InId)
-		: Id(InId)
-	{
-		for (int i = 0; i < 4; i++)
+	FDelaunaySite3::FDelaunaySite3(const FIntVector4& InVtx, const int32 InId)
+		: Id(InId)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			Vtx[i] = InVtx[i];
+			Neighbors[i] = -1;
+		}
+
+		Algo::Sort(Vtx);
+	}
+
+	namespace DelaunayInternal
+	{
+		// Tiles aim for this many core points; much smaller and the halo would dominate their work.
+		constexpr int32 PointsPerTile = 65536;
+		// Halo thickness in average point spacings. Tetrahedra whose circumsphere leaks past it go through the seam pass.
+		constexpr double HaloSpacings = 4;
+
+		/** Vertex -> incident tetrahedra, CSR layout. Bucket order is unspecified. */
+		template <typename GetVtxFunc>
+		void BuildIncidence(const int32 NumVertices, const int32 NumTets, GetVtxFunc&& GetVtx, TArray<int32>& OutOffsets, TArray<int32>& OutIncident, const EParallelForFlags Flags)
+		{
+			OutOffsets.Init(0, NumVertices + 1);
+			ParallelFor(
+				NumTets, [&](const int32 i)
+				{
+					const int32* Vtx = GetVtx(i);
+					for (int32 j = 0; j < 4; j++)
+					{
+						FPlatformAtomics::InterlockedIncrement(&OutOffsets[Vtx[j] + 1]);
+					}
+				}, Flags);
+
+			for (int32 v = 0; v < NumVertices; v++)
+			{
+				OutOffsets[v + 1] += OutOffsets[v];
+			}
+
+			OutIncident.SetNumUninitialized(NumTets * 4);
+			TArray<int32> Cursors(OutOffsets.GetData(), NumVertices);
+
+			ParallelFor(
+				NumTets, [&](const int32 i)
+				{
+					const int32* Vtx = GetVtx(i);
+					for (int32 j = 0; j < 4; j++)
+					{
+						OutIncident[FPlatformAtomics::InterlockedIncrement(&Cursors[Vtx[j]]) - 1] = i;
+					}
+				}, Flags);
+		}
+
+		/**
+		 * Unique edges of tetrahedra, sorted. Vertex v's bucket holds its neighbors below v, and since H64U puts
+		 * the larger vertex in the high word, concatenating the locally sorted buckets yields a sorted array.
+		 */
+		template <typename GetVtxFunc>
+		void BuildEdges(const int32 NumVertices, GetVtxFunc&& GetVtx, const TArray<int32>& Offsets, const TArray<int32>& Incident, TArray<uint64>& OutEdges, const EParallelForFlags Flags)
+		{
+			auto GatherLower = [&](const int32 v, TArray<int32, TInlineAllocator<64>>& OutLower)
+			{
+				for (int32 k = Offsets[v]; k < Offsets[v + 1]; k++)
+				{
+					const int32* Vtx = GetVtx(Incident[k]);
+					for (int32 j = 0; j < 4 && Vtx[j] < v; j++)
+					{
+						OutLower.Add(Vtx[j]);
+					}
+				}
+
+				OutLower.Sort();
+
+				int32 WriteIndex = 0;
+				for (int32 i = 0; i < OutLower.Num(); i++)
+				{
+					if (WriteIndex == 0 || OutLower[WriteIndex - 1] != OutLower[i])
+					{
+						OutLower[WriteIndex++] = OutLower[i];
+					}
+				}
+				OutLower.SetNum(WriteIndex, EAllowShrinking::No);
+			};
+
+			TArray<int32> EdgeOffsets;
+			EdgeOffsets.Init(0, NumVertices + 1);
+
+			ParallelFor(
+				NumVertices, [&](const int32 v)
+				{
+					TArray<int32, TInlineAllocator<64>> Lower;
+					GatherLower(v, Lower);
+					EdgeOffsets[v + 1] = Lower.Num();
+				}, Flags);
+
+			for (int32 v = 0; v < NumVertices; v++)
+			{
+				EdgeOffsets[v + 1] += EdgeOffsets[v];
+			}
+
+			OutEdges.SetNumUninitialized(EdgeOffsets[NumVertices]);
+
+			ParallelFor(
+				NumVertices, [&](const int32 v)
+				{
+					TArray<int32, TInlineAllocator<64>> Lower;
+					GatherLower(v, Lower);
+					uint64* Out = OutEdges.GetData() + EdgeOffsets[v];
+					for (int32 i = 0; i < Lower.Num(); i++)
+					{
+						Out[i] = PCGEx::H64U(v, Lower[i]);
+					}
+				}, Flags);
+		}
+
+		/**
+		 * Face adjacency of tetrahedra with ascending vertices. Faces are matched from their smallest vertex, so every
+		 * bucket is independent. OutNeighbors[Tet * 4 + f] is the tetrahedron across face MTX[f], or -1 on the hull.
+		 * Returns the number of hull faces, or -1 if some face is shared by more than two tetrahedra.
+		 */
+		template <typename GetVtxFunc>
+		int32 MatchFaces(const int32 NumVertices, const int32 NumTets, GetVtxFunc&& GetVtx, const TArray<int32>& Offsets, const TArray<int32>& Incident, TArray<int32>& OutNeighbors, const EParallelForFlags Flags)
+		{
+			struct FHalfFace
+			{
+				int32 B;
+				int32 C;
+				int32 Index;
+			};
+
+			OutNeighbors.Init(-1, NumTets * 4);
+
+			int32 NumHullFaces = 0;
+			int32 bOverShared = 0;
+
+			ParallelFor(
+				NumVertices, [&](const int32 v)
+				{
+					TArray<FHalfFace, TInlineAllocator<64>> Faces;
+					for (int32 k = Offsets[v]; k < Offsets[v + 1]; k++)
+					{
+						const int32 Tet = Incident[k];
+						const int32* Vtx = GetVtx(Tet);
+						for (int32 f = 0; f < 4; f++)
+						{
+							if (Vtx[MTX[f][0]] == v)
+							{
+								Faces.Add({Vtx[MTX[f][1]], Vtx[MTX[f][2]], Tet * 4 + f});
+							}
+						}
+					}
+
+					Faces.Sort([](const FHalfFace& A, const FHalfFace& B) { return A.B != B.B ? A.B < B.B : A.C < B.C; });
+
+					int32 LocalHullFaces = 0;
+					for (int32 i = 0; i < Faces.Num();)
+					{
+						int32 j = i + 1;
+						while (j < Faces.Num() && Faces[j].B == Faces[i].B && Faces[j].C == Faces[i].C)
+						{
+							j++;
+						}
+
+						if (j - i == 1)
+						{
+							LocalHullFaces++;
+						}
+						else if (j - i == 2)
+						{
+							OutNeighbors[Faces[i].Index] = Faces[i + 1].Index / 4;
+							OutNeighbors[Faces[i + 1].Index] = Faces[i].Index / 4;
+						}
+						else
+						{
+							FPlatformAtomics::InterlockedExchange(&bOverShared, 1);
+						}
+
+						i = j;
+					}
+
+					if (LocalHullFaces)
+					{
+						FPlatformAtomics::InterlockedAdd(&NumHullFaces, LocalHullFaces);
+					}
+				}, Flags);
+
+			return bOverShared ? -1 : NumHullFaces;
+		}
+
+		/** True if P lies strictly inside the circumsphere of A, B, C, D. Compared against the centroid (always inside) so orientation doesn't matter. */
+		struct FInSphereTest
+		{
+			double PA[3];
+			double PB[3];
+			double PC[3];
+			double PD[3];
+			double Reference = 0;
+
+			FInSphereTest(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+				: PA{A.X, A.Y, A.Z}, PB{B.X, B.Y, B.Z}, PC{C.X, C.Y, C.Z}, PD{D.X, D.Y, D.Z}
+			{
+				const FVector Centroid = (A + B + C + D) * 0.25;
+				const double PE[3]{Centroid.X, Centroid.Y, Centroid.Z};
+				Reference = UE::Geometry::ExactPredicates::InSphere(PA, PB, PC, PD, PE);
+			}
+
+			bool IsInside(const FVector& P) const
+			{
+				const double PE[3]{P.X, P.Y, P.Z};
+				const double Test = UE::Geometry::ExactPredicates::InSphere(PA, PB, PC, PD, PE);
+				return Reference > 0 ? Test > 0 : Reference < 0 && Test < 0;
+			}
+		};
+
+		/**
+		 * Regular grid of tiles over the input bounds. A tile's core is its cell, open-ended on the outer faces of
+		 * the grid; its extended region grows the core by Halo on inner faces. Points beyond the bounds don't exist,
+		 * so open ends lose nothing.
+		 */
+		struct FTiles
+		{
+			FVector Origin = FVector::ZeroVector;
+			double CellSize = 0;
+			double Halo = 0;
+			double Slack = 0;
+			FIntVector Dims = FIntVector::ZeroValue;
+
+			TArray<bool> Failed;
+
+			FORCEINLINE int32 Num() const
+			{
+				return Dims.X * Dims.Y * Dims.Z;
+			}
+
+			FORCEINLINE int32 GetAxisCell(const double Value, const int32 Axis) const
+			{
+				const double Cell = (Value - Origin[Axis]) / CellSize;
+				return Cell <= 0 ? 0 : Cell >= Dims[Axis] - 1 ? Dims[Axis] - 1 : static_cast<int32>(Cell);
+			}
+
+			FORCEINLINE int32 GetIndex(const int32 X, const int32 Y, const int32 Z) const
+			{
+				return X + Dims.X * (Y + Dims.Y * Z);
+			}
+
+			FORCEINLINE int32 GetOwner(const FVector& Position) const
+			{
+				return GetIndex(GetAxisCell(Position.X, 0), GetAxisCell(Position.Y, 1), GetAxisCell(Position.Z, 2));
+			}
+
+			/** Whether the sphere lies strictly inside the extended region of the tile. */
+			bool IsContained(const int32 Index, const FSphere& Sphere) const
+			{
+				const int32 Cell[3] = {Index % Dims.X, (Index / Dims.X) % Dims.Y, Index / (Dims.X * Dims.Y)};
+				const double Reach = Sphere.W + Slack + Sphere.W * 1e-9;
+
+				for (int32 Axis = 0; Axis < 3; Axis++)
+				{
+					const double C = Sphere.Center[Axis];
+					if (Cell[Axis] > 0 && C - Reach <= Origin[Axis] + Cell[Axis] * CellSize - Halo)
+					{
+						return false;
+					}
+					if (Cell[Axis] < Dims[Axis] - 1 && C + Reach >= Origin[Axis] + (Cell[Axis] + 1) * CellSize + Halo)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			/** A tetrahedron is final when its owner tile succeeded and its circumsphere fits in that tile's extended region. */
+			bool IsFinal(const FSphere& Sphere) const
+			{
+				const int32 Owner = GetOwner(Sphere.Center);
+				return !Failed[Owner] && IsContained(Owner, Sphere);
+			}
+		};
+
+		/** Canonical circumsphere: vertices are ascending, so every tetrahedralization computes the exact same sphere. */
+		FORCEINLINE bool GetSphere(const TArrayView<FVector>& Positions, const int32 (&Vtx)[4], FSphere& OutSphere)
 		{
-			Vtx[i] = InVtx[i];
-			Faces[i] = 0;
+			return FindSphereFrom4Points(Positions, Vtx, OutSphere) && FMath::IsFinite(OutSphere.W) && !OutSphere.Center.ContainsNaN();
 		}
 
-		Algo::Sort(Vtx);
-	}
+		struct FTileResult
+		{
+			TArray<FIntVector4> Tets; // Owned, final; global, ascending vertices
+			TArray<int32> SeamVertices;
+		};
 
-	void FDelaunaySite3::ComputeFaces()
-	{
-		for (int i = 0; i < 4; i++)
+		void TetrahedralizeTile(const TArrayView<FVector>& Positions, FTiles& Tiles, const int32 TileIndex, const TArray<int32>& Vertices, FTileResult& OutResult)
 		{
-			Faces[i] = PCGEx::UH3(Vtx[MTX[i][0]], Vtx[MTX[i][1]], Vtx[MTX[i][2]]);
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::TetrahedralizeTile);
+
+			// A failed tile can't vouch for any point of its extended region
+			auto Fail = [&]()
+			{
+				Tiles.Failed[TileIndex] = true;
+				OutResult.Tets.Empty();
+				OutResult.SeamVertices = Vertices;
+			};
+
+			const int32 NumLocal = Vertices.Num();
+			if (NumLocal < 4)
+			{
+				Fail();
+				return;
+			}
+
+			TArray<FIntVector4> Tets;
+
+			{
+				TArray<FVector> LocalPositions;
+				LocalPositions.SetNumUninitialized(NumLocal);
+				for (int32 i = 0; i < NumLocal; i++)
+				{
+					LocalPositions[i] = Positions[Vertices[i]];
+				}
+
+				UE::Geometry::FDelaunay3 Tetrahedralization;
+				if (!Tetrahedralization.Triangulate(LocalPositions))
+				{
+					Fail();
+					return;
+				}
+
+				Tets = Tetrahedralization.GetTetrahedra();
+			}
+
+			const int32 NumTets = Tets.Num();
+			if (!NumTets)
+			{
+				Fail();
+				return;
+			}
+
+			// Vertices are ascending global indices, so sorting local indices sorts global ones too
+			for (FIntVector4& Tet : Tets)
+			{
+				Algo::Sort(MakeArrayView(&Tet.X, 4));
+			}
+
+			auto GetVtx = [&](const int32 i) { return &Tets[i].X; };
+
+			TArray<int32> Offsets;
+			TArray<int32> Incident;
+			TArray<int32> Neighbors;
+			BuildIncidence(NumLocal, NumTets, GetVtx, Offsets, Incident, EParallelForFlags::ForceSingleThread);
+			if (MatchFaces(NumLocal, NumTets, GetVtx, Offsets, Incident, Neighbors, EParallelForFlags::ForceSingleThread) < 0)
+			{
+				Fail();
+				return;
+			}
+
+			Offsets.Empty();
+			Incident.Empty();
+
+			// Seam vertices: the star of any other vertex of the core is entirely made of tetrahedra whose sphere fits in
+			// this tile, which are globally Delaunay and final wherever they're owned -- so that star is already complete.
+			TBitArray<> IsSeam;
+			IsSeam.Init(false, NumLocal);
+
+			for (int32 t = 0; t < NumTets; t++)
+			{
+				const FIntVector4& Tet = Tets[t];
+				const int32 Vtx[4] = {Vertices[Tet.X], Vertices[Tet.Y], Vertices[Tet.Z], Vertices[Tet.W]};
+
+				FSphere Sphere;
+				const bool bContained = GetSphere(Positions, Vtx, Sphere) && Tiles.IsContained(TileIndex, Sphere);
+
+				if (!bContained)
+				{
+					for (int32 j = 0; j < 4; j++)
+					{
+						IsSeam[Tet[j]] = true;
+					}
+				}
+				else if (Tiles.GetOwner(Sphere.Center) == TileIndex)
+				{
+					OutResult.Tets.Emplace(Vtx[0], Vtx[1], Vtx[2], Vtx[3]);
+				}
+
+				// Local hull vertices have an incomplete star
+				for (int32 f = 0; f < 4; f++)
+				{
+					if (Neighbors[t * 4 + f] == -1)
+					{
+						for (int32 j = 0; j < 3; j++)
+						{
+							IsSeam[Tet[MTX[f][j]]] = true;
+						}
+					}
+				}
+			}
+
+			for (TConstSetBitIterator<> It(IsSeam); It; ++It)
+			{
+				const int32 Vertex = Vertices[It.GetIndex()];
+				if (Tiles.GetOwner(Positions[Vertex]) == TileIndex)
+				{
+					OutResult.SeamVertices.Add(Vertex);
+				}
+			}
 		}
 	}
 
@@ -437,24 +1487,417 @@ namespace PCGExMath::Geo
 		IsValid = false;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	bool TDelaunay3::ProcessInternal(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		Clear();
+		if (Positions.IsEmpty() || Positions.Num() <= 3)
+		{
+			return false;
+		}
+
+		if (DelaunayInternal::WantsPartition(Positions.Num()))
+		{
+			if (ProcessTiled(Positions, bComputeAdjacency, bComputeHull))
+			{
+				return true;
+			}
+
+			Clear();
+		}
+
+		TArray<FIntVector4> Tetrahedra;
+
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+
+			if (!Tetrahedralization.Triangulate(Positions))
+			{
+				return false;
+			}
+
+			Tetrahedra = Tetrahedralization.GetTetrahedra();
 		}
+
+		IsValid = true;
+
+		const int32 NumSites = Tetrahedra.Num();
+		Sites.SetNumUninitialized(NumSites);
+		PCGEX_PARALLEL_FOR(
+			NumSites,
+			Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
+			)
+
+		Tetrahedra.Empty();
+
+		BuildTopology(Positions.Num(), bComputeAdjacency, bComputeHull, false);
+
+		return IsValid;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	bool TDelaunay3::ProcessTiled(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TDelaunay3::ProcessTiled);
+
+		// Each tile tetrahedralizes its core plus a halo. A tetrahedron whose circumsphere fits in the tile's extended
+		// region is globally Delaunay; it is kept by the tile whose core holds its circumcenter. Points near tetrahedra
+		// whose sphere escapes their tile, or on a tile's hull, are tetrahedralized once more, and the non-final seam
+		// tetrahedra with no input point strictly inside their circumsphere complete the result.
+
+		const int32 NumPoints = Positions.Num();
+
+		DelaunayInternal::FTiles Tiles;
+
+		{
+			const FBox Bounds(Positions.GetData(), Positions.Num());
+			const FVector Size = Bounds.GetSize();
+			const double Volume = Size.X * Size.Y * Size.Z;
+			if (!(Volume > 0) || !FMath::IsFinite(Volume))
+			{
+				return false;
+			}
+
+			const int32 TargetTiles = FMath::Max(1, NumPoints / DelaunayInternal::PointsPerTile);
+			const double Spacing = FMath::Pow(Volume / NumPoints, 1.0 / 3.0);
+
+			Tiles.Origin = Bounds.Min;
+			Tiles.CellSize = FMath::Pow(Volume / TargetTiles, 1.0 / 3.0);
+			Tiles.Halo = FMath::Min(Spacing * DelaunayInternal::HaloSpacings, Tiles.CellSize);
+			Tiles.Slack = Size.GetMax() * 1e-9;
+
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				Tiles.Dims[Axis] = FMath::Clamp(FMath::CeilToInt32(Size[Axis] / Tiles.CellSize), 1, 1024);
+			}
+
+			// Flat or skinny inputs would explode into near-empty tiles; leave them to the single pass
+			if (Tiles.Num() < 2 || Tiles.Num() > TargetTiles * 8)
+			{
+				return false;
+			}
+
+			Tiles.Failed.Init(false, Tiles.Num());
+		}
+
+		const int32 NumTiles = Tiles.Num();
+
+		// Points go to every tile whose extended region holds them; lists stay ascending
+		TArray<TArray<int32>> TileVertices;
+		TileVertices.SetNum(NumTiles);
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::Partition);
+
+			auto ForEachTile = [&](const FVector& P, auto&& Func)
+			{
+				const int32 MinX = Tiles.GetAxisCell(P.X - Tiles.Halo, 0);
+				const int32 MaxX = Tiles.GetAxisCell(P.X + Tiles.Halo, 0);
+				const int32 MinY = Tiles.GetAxisCell(P.Y - Tiles.Halo, 1);
+				const int32 MaxY = Tiles.GetAxisCell(P.Y + Tiles.Halo, 1);
+				const int32 MinZ = Tiles.GetAxisCell(P.Z - Tiles.Halo, 2);
+				const int32 MaxZ = Tiles.GetAxisCell(P.Z + Tiles.Halo, 2);
+
+				for (int32 Z = MinZ; Z <= MaxZ; Z++)
+				{
+					for (int32 Y = MinY; Y <= MaxY; Y++)
+					{
+						for (int32 X = MinX; X <= MaxX; X++)
+						{
+							Func(Tiles.GetIndex(X, Y, Z));
+						}
+					}
+				}
+			};
+
+			TArray<int32> Counts;
+			Counts.Init(0, NumTiles);
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				ForEachTile(Positions[i], [&](const int32 Tile) { Counts[Tile]++; });
+			}
+
+			for (int32 t = 0; t < NumTiles; t++)
+			{
+				TileVertices[t].Reserve(Counts[t]);
+			}
+
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				ForEachTile(Positions[i], [&](const int32 Tile) { TileVertices[Tile].Add(i); });
+			}
+		}
+
+		TArray<DelaunayInternal::FTileResult> Results;
+		Results.SetNum(NumTiles);
+
+		ParallelFor(
+			NumTiles, [&](const int32 t)
+			{
+				DelaunayInternal::TetrahedralizeTile(Positions, Tiles, t, TileVertices[t], Results[t]);
+				TileVertices[t].Empty();
+			}, EParallelForFlags::Unbalanced);
+
+		TileVertices.Empty();
+
+		// Seam re-tetrahedralization
+
+		TBitArray<> InSeam;
+		InSeam.Init(false, NumPoints);
+		for (DelaunayInternal::FTileResult& Result : Results)
+		{
+			for (const int32 V : Result.SeamVertices)
+			{
+				InSeam[V] = true;
+			}
+			Result.SeamVertices.Empty();
+		}
+
+		TArray<int32> SeamVertices;
+		SeamVertices.Reserve(InSeam.CountSetBits());
+		for (TConstSetBitIterator<> It(InSeam); It; ++It)
+		{
+			SeamVertices.Add(It.GetIndex());
+		}
+
+		const int32 NumSeamVertices = SeamVertices.Num();
+
+		TArray<FIntVector4> SeamTets;
+		if (NumSeamVertices >= 4)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::TetrahedralizeSeams);
+
+			TArray<FVector> SeamPositions;
+			SeamPositions.SetNumUninitialized(NumSeamVertices);
+			for (int32 i = 0; i < NumSeamVertices; i++)
+			{
+				SeamPositions[i] = Positions[SeamVertices[i]];
+			}
+
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+			if (!Tetrahedralization.Triangulate(SeamPositions))
+			{
+				return false;
+			}
+
+			SeamTets = Tetrahedralization.GetTetrahedra();
+		}
+
+		const int32 NumSeamTets = SeamTets.Num();
+
+		TArray<int8> KeepSeam;
+		KeepSeam.Init(0, NumSeamTets);
+
+		if (NumSeamTets)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::FilterSeams);
+
+			// Seam tetrahedra are Delaunay among seam vertices; the rest of the points are checked through a flat index
+			PCGExSpatial::FFlatIndex Others;
+			Others.BuildPoints(
+				NumPoints, [&](const int32 i, FVector& OutPosition)
+				{
+					if (InSeam[i])
+					{
+						return false;
+					}
+					OutPosition = Positions[i];
+					return true;
+				});
+
+			PCGEX_PARALLEL_FOR(
+				NumSeamTets,
+				FIntVector4& Tet = SeamTets[i];
+				for (int32 j = 0; j < 4; j++)
+				{
+					Tet[j] = SeamVertices[Tet[j]];
+				}
+				Algo::Sort(MakeArrayView(&Tet.X, 4));
+
+				const int32 Vtx[4] = {Tet.X, Tet.Y, Tet.Z, Tet.W};
+
+				FSphere Sphere;
+				if (DelaunayInternal::GetSphere(Positions, Vtx, Sphere))
+				{
+					if (Tiles.IsFinal(Sphere))
+					{
+						// Already kept by its owner tile
+						return;
+					}
+
+					Sphere.W = Sphere.W * (1 + 1e-9) + Tiles.Slack;
+				}
+				else
+				{
+					// Near-flat sliver; test everything
+					const FBox Bounds = Others.GetBounds();
+					Sphere = FSphere(Bounds.GetCenter(), Bounds.GetExtent().Size() + 1);
+				}
+
+				const DelaunayInternal::FInSphereTest InSphere(Positions[Vtx[0]], Positions[Vtx[1]], Positions[Vtx[2]], Positions[Vtx[3]]);
+				const bool bEmpty = Others.FindFirstElementInSphere(
+					Sphere.Center, Sphere.W, [&](const int32 P)
+					{
+						return !InSphere.IsInside(Positions[P]);
+					});
+
+				KeepSeam[i] = bEmpty ? 1 : 0;
+				)
+		}
+
+		InSeam.Empty();
+
+		// Assemble
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumTiles + 1);
+
+		int32 NumSites = 0;
+		for (int32 t = 0; t < NumTiles; t++)
+		{
+			Offsets[t] = NumSites;
+			NumSites += Results[t].Tets.Num();
+		}
+		Offsets[NumTiles] = NumSites;
+
+		for (int32 i = 0; i < NumSeamTets; i++)
+		{
+			NumSites += KeepSeam[i];
+		}
+
+		Sites.SetNumUninitialized(NumSites);
+
+		ParallelFor(
+			NumTiles, [&](const int32 t)
+			{
+				TArray<FIntVector4>& Tets = Results[t].Tets;
+				const int32 Offset = Offsets[t];
+				for (int32 i = 0; i < Tets.Num(); i++)
+				{
+					Sites[Offset + i] = FDelaunaySite3(Tets[i], Offset + i);
+				}
+				Tets.Empty();
+			}, EParallelForFlags::Unbalanced);
+
+		{
+			int32 WriteIndex = Offsets[NumTiles];
+			for (int32 i = 0; i < NumSeamTets; i++)
+			{
+				if (KeepSeam[i])
+				{
+					Sites[WriteIndex] = FDelaunaySite3(SeamTets[i], WriteIndex);
+					WriteIndex++;
+				}
+			}
+		}
+
+		Results.Empty();
+		SeamTets.Empty();
+
+		if (!BuildTopology(NumPoints, bComputeAdjacency, bComputeHull, true))
+		{
+			// Only possible when cospherical points were split differently across tiles
+			Clear();
+			return false;
+		}
+
+		IsValid = true;
+		return IsValid;
+	}
+
+	bool TDelaunay3::BuildTopology(const int32 NumVertices, const bool bComputeAdjacency, const bool bComputeHull, const bool bValidate)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::BuildTopology);
+
+		const int32 NumSites = Sites.Num();
+		auto GetVtx = [&](const int32 i) { return Sites[i].Vtx; };
+
+		TArray<int32> Offsets;
+		TArray<int32> Incident;
+		DelaunayInternal::BuildIncidence(NumVertices, NumSites, GetVtx, Offsets, Incident, EParallelForFlags::None);
+		DelaunayInternal::BuildEdges(NumVertices, GetVtx, Offsets, Incident, DelaunayEdges, EParallelForFlags::None);
+
+		if (!bComputeAdjacency && !bComputeHull && !bValidate)
+		{
+			return true;
+		}
+
+		TArray<int32> Neighbors;
+		const int32 NumHullFaces = DelaunayInternal::MatchFaces(NumVertices, NumSites, GetVtx, Offsets, Incident, Neighbors, EParallelForFlags::None);
+
+		if (bValidate)
+		{
+			if (NumHullFaces < 0)
+			{
+				return false;
+			}
+
+			// A tetrahedralization of a convex region is a ball: V - E + F - T == 1. A hole or an overlap breaks it.
+			int64 NumUsed = 0;
+			for (int32 v = 0; v < NumVertices; v++)
+			{
+				NumUsed += Offsets[v + 1] > Offsets[v] ? 1 : 0;
+			}
+
+			const int64 NumFaces = (static_cast<int64>(NumSites) * 4 + NumHullFaces) / 2;
+			if (NumUsed - DelaunayEdges.Num() + NumFaces - NumSites != 1)
+			{
+				return false;
+			}
+		}
+
+		Offsets.Empty();
+		Incident.Empty();
+
+		PCGEX_PARALLEL_FOR(
+			NumSites,
+			FDelaunaySite3& Site = Sites[i];
+			Site.bOnHull = 0;
+			for (int32 f = 0; f < 4; f++)
+			{
+				Site.Neighbors[f] = Neighbors[i * 4 + f];
+				if (Site.Neighbors[f] == -1)
+				{
+					Site.bOnHull = 1;
+				}
+			}
+			)
+
+		if (bComputeHull)
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
+			for (const FDelaunaySite3& Site : Sites)
+			{
+				if (!Site.bOnHull)
+				{
+					continue;
+				}
+
+				for (int32 f = 0; f < 4; f++)
+				{
+					if (Site.Neighbors[f] == -1)
+					{
+						for (int32 j = 0; j < 3; j++)
+						{
+							DelaunayHull.Add(Site.Vtx[MTX[f][j]]);
+						}
+					}
+				}
+			}
 		}
+
+		return true;
+	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	{
+		TArray<uint64> LongestEdges;
+		DelaunayInternal::GetLongestEdges(Sites, Positions, LongestEdges);
+		DelaunayInternal::RemoveSorted(DelaunayEdges, LongestEdges);
+	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	{
+		TArray<uint64> SortedLongestEdges;
+		DelaunayInternal::GetLongestEdges(Sites, Positions, SortedLongestEdges);
+		DelaunayInternal::RemoveSorted(DelaunayEdges, SortedLongestEdges);
+		LongestEdges.Append(SortedLongestEdges);
 	}
 }
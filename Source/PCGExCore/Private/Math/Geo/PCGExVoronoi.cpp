@@ -260,18 +260,18 @@ namespace PCGExMath::Geo
 				GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
 			}
 
-			for (const TPair<uint32, uint64>& AdjacencyPair : Delaunay->Adjacency)
+			VoronoiEdges.Reserve(NumSites * 2);
+			for (const FDelaunaySite3& Site : Delaunay->Sites)
 			{
-				int32 A = -1;
-				int32 B = -1;
-				PCGEx::NH64(AdjacencyPair.Value, A, B);
-
-				if (A == -1 || B == -1)
+				for (int f = 0; f < 4; f++)
 				{
-					continue;
+					// Each face pair is claimed by its lower-id site; also filters out -1
+					const int32 AdjacentIdx = Site.Neighbors[f];
+					if (AdjacentIdx > Site.Id)
+					{
+						VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx));
+					}
 				}
-
-				VoronoiEdges.Add(PCGEx::H64U(A, B));
 			}
 		}
 
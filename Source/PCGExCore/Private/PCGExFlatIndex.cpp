@@ -0,0 +1,427 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExFlatIndex.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+namespace PCGExSpatial
+{
+	namespace
+	{
+		TAutoConsoleVariable<bool> CVarUseFlatIndex(
+			TEXT("pcgex.SpatialIndex.Flat"),
+			false,
+			TEXT("Build flat Morton-ordered spatial indices instead of octrees where both are supported (cluster closest-node lookups, probing)."),
+			ECVF_Default);
+
+		// Below this many items, parallel dispatch costs more than it saves
+		constexpr int32 ParallelThreshold = 4096;
+		constexpr int32 MinChunkSize = 16384;
+
+		constexpr int32 MortonBitsPerAxis = 10;
+		constexpr int32 RadixBits = 10;
+		constexpr int32 RadixBuckets = 1 << RadixBits;
+
+		FORCEINLINE uint32 SpreadBits(uint32 V)
+		{
+			// 10 bits -> every third bit of 30
+			V &= 0x3FF;
+			V = (V | (V << 16)) & 0x030000FF;
+			V = (V | (V << 8)) & 0x0300F00F;
+			V = (V | (V << 4)) & 0x030C30C3;
+			V = (V | (V << 2)) & 0x09249249;
+			return V;
+		}
+
+		int32 GetNumChunks(const int32 InNum)
+		{
+			if (InNum < ParallelThreshold)
+			{
+				return 1;
+			}
+			return FMath::Clamp(InNum / MinChunkSize, 1, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() * 2));
+		}
+
+		template <typename FuncType>
+		void ForEachChunk(const int32 InNum, const int32 NumChunks, FuncType&& Func)
+		{
+			const int32 ChunkSize = FMath::DivideAndRoundUp(InNum, NumChunks);
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					const int32 Start = Chunk * ChunkSize;
+					Func(Chunk, Start, FMath::Min(Start + ChunkSize, InNum));
+				}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+		}
+
+		/** Stable LSD radix sort on the Morton code stored in the upper 32 bits of each key. Chunk-parallel histograms and scatter. */
+		void RadixSortKeys(TArray<uint64>& Keys)
+		{
+			const int32 Num = Keys.Num();
+			const int32 NumChunks = GetNumChunks(Num);
+			const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+			TArray<uint64> Scratch;
+			Scratch.SetNumUninitialized(Num);
+
+			TArray<int32> Histograms;
+			Histograms.SetNumUninitialized(NumChunks * RadixBuckets);
+
+			uint64* Source = Keys.GetData();
+			uint64* Dest = Scratch.GetData();
+
+			for (int32 Shift = 32; Shift < 32 + MortonBitsPerAxis * 3; Shift += RadixBits)
+			{
+				ForEachChunk(
+					Num, NumChunks, [&](const int32 Chunk, const int32 Start, const int32 End)
+					{
+						int32* Histogram = Histograms.GetData() + Chunk * RadixBuckets;
+						FMemory::Memzero(Histogram, RadixBuckets * sizeof(int32));
+						for (int32 i = Start; i < End; i++)
+						{
+							Histogram[(Source[i] >> Shift) & (RadixBuckets - 1)]++;
+						}
+					});
+
+				// Exclusive prefix over (digit, chunk) so each chunk scatters its run of every digit in order
+				int32 Offset = 0;
+				for (int32 Digit = 0; Digit < RadixBuckets; Digit++)
+				{
+					for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+					{
+						int32& Count = Histograms[Chunk * RadixBuckets + Digit];
+						const int32 ChunkCount = Count;
+						Count = Offset;
+						Offset += ChunkCount;
+					}
+				}
+
+				ForEachChunk(
+					Num, NumChunks, [&](const int32 Chunk, const int32 Start, const int32 End)
+					{
+						int32* Cursors = Histograms.GetData() + Chunk * RadixBuckets;
+						for (int32 i = Start; i < End; i++)
+						{
+							Dest[Cursors[(Source[i] >> Shift) & (RadixBuckets - 1)]++] = Source[i];
+						}
+					});
+
+				Swap(Source, Dest);
+			}
+
+			// Odd number of passes leaves the result in Scratch
+			if (Source != Keys.GetData())
+			{
+				FMemory::Memcpy(Keys.GetData(), Source, Num * sizeof(uint64));
+			}
+		}
+	}
+
+	bool UseFlatIndex()
+	{
+		return CVarUseFlatIndex.GetValueOnAnyThread();
+	}
+
+	void FFlatIndex::BuildPoints(const int32 InNum, TFunctionRef<bool(int32, FVector&)> GetPosition)
+	{
+		Build(
+			InNum, false, [&](const int32 Index, FVector& OutCenter, FVector& OutExtent)
+			{
+				return GetPosition(Index, OutCenter);
+			});
+	}
+
+	void FFlatIndex::BuildBoxes(const int32 InNum, TFunctionRef<bool(int32, FBox&)> GetBox)
+	{
+		Build(
+			InNum, true, [&](const int32 Index, FVector& OutCenter, FVector& OutExtent)
+			{
+				FBox Box;
+				if (!GetBox(Index, Box))
+				{
+					return false;
+				}
+				Box.GetCenterAndExtents(OutCenter, OutExtent);
+				return true;
+			});
+	}
+
+	void FFlatIndex::Build(const int32 InNum, const bool bBoxes, TFunctionRef<bool(int32, FVector&, FVector&)> GetItem)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FFlatIndex::Build);
+
+		Indices.Reset();
+		Centers.Reset();
+		Extents.Reset();
+		Nodes.Reset();
+		LevelOffsets.Reset();
+		LevelCounts.Reset();
+
+		if (InNum <= 0)
+		{
+			return;
+		}
+
+		// Evaluate every candidate once, in parallel
+		TArray<FVector> RawCenters;
+		TArray<FVector> RawExtents;
+		TBitArray<> Valid;
+		RawCenters.SetNumUninitialized(InNum);
+		if (bBoxes)
+		{
+			RawExtents.SetNumUninitialized(InNum);
+		}
+		Valid.Init(false, InNum);
+
+		// Bits are written per chunk; chunk boundaries land on 32-bit words so chunks never share one
+		const int32 ChunkSize = Align(FMath::DivideAndRoundUp(InNum, GetNumChunks(InNum)), 32);
+		const int32 NumChunks = FMath::DivideAndRoundUp(InNum, ChunkSize);
+
+		// Per-chunk bounds of item centers, for Morton quantization
+		TArray<FBox> ChunkBounds;
+		ChunkBounds.Init(FBox(ForceInit), NumChunks);
+
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				const int32 Start = Chunk * ChunkSize;
+				const int32 End = FMath::Min(Start + ChunkSize, InNum);
+				FBox LocalBounds(ForceInit);
+
+				FVector Extent = FVector::ZeroVector;
+				for (int32 i = Start; i < End; i++)
+				{
+					if (GetItem(i, RawCenters[i], Extent))
+					{
+						Valid[i] = true;
+						LocalBounds += RawCenters[i];
+						if (bBoxes)
+						{
+							RawExtents[i] = Extent;
+						}
+					}
+				}
+
+				ChunkBounds[Chunk] = LocalBounds;
+			}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		FBox CenterBounds(ForceInit);
+		for (const FBox& Bounds : ChunkBounds)
+		{
+			CenterBounds += Bounds;
+		}
+
+		// Gather valid items as (Morton << 32 | Index) keys
+		TArray<uint64> Keys;
+		Keys.Reserve(InNum);
+		for (TConstSetBitIterator<> It(Valid); It; ++It)
+		{
+			Keys.Add(static_cast<uint64>(It.GetIndex()));
+		}
+
+		const int32 Num = Keys.Num();
+		if (Num == 0)
+		{
+			return;
+		}
+
+		const FVector Min = CenterBounds.Min;
+		const FVector Size = CenterBounds.GetSize();
+		constexpr double MaxCell = (1 << MortonBitsPerAxis) - 1;
+		const FVector Scale(
+			Size.X > UE_SMALL_NUMBER ? MaxCell / Size.X : 0,
+			Size.Y > UE_SMALL_NUMBER ? MaxCell / Size.Y : 0,
+			Size.Z > UE_SMALL_NUMBER ? MaxCell / Size.Z : 0);
+
+		ForEachChunk(
+			Num, GetNumChunks(Num), [&](const int32 Chunk, const int32 Start, const int32 End)
+			{
+				for (int32 i = Start; i < End; i++)
+				{
+					const FVector Cell = (RawCenters[static_cast<int32>(Keys[i])] - Min) * Scale;
+					const uint32 Code =
+						SpreadBits(static_cast<uint32>(Cell.X))
+						| (SpreadBits(static_cast<uint32>(Cell.Y)) << 1)
+						| (SpreadBits(static_cast<uint32>(Cell.Z)) << 2);
+					Keys[i] |= static_cast<uint64>(Code) << 32;
+				}
+			});
+
+		RadixSortKeys(Keys);
+
+		Indices.SetNumUninitialized(Num);
+		Centers.SetNumUninitialized(Num);
+		if (bBoxes)
+		{
+			Extents.SetNumUninitialized(Num);
+		}
+
+		ForEachChunk(
+			Num, GetNumChunks(Num), [&](const int32 Chunk, const int32 Start, const int32 End)
+			{
+				for (int32 i = Start; i < End; i++)
+				{
+					const int32 Index = static_cast<int32>(Keys[i] & 0xFFFFFFFF);
+					Indices[i] = Index;
+					Centers[i] = RawCenters[Index];
+					if (bBoxes)
+					{
+						Extents[i] = RawExtents[Index];
+					}
+				}
+			});
+
+		BuildTree();
+	}
+
+	void FFlatIndex::BuildTree()
+	{
+		const int32 NumLeaves = FMath::DivideAndRoundUp(Indices.Num(), LeafSize);
+
+		// Level sizes first, so Nodes is allocated once
+		int32 Count = NumLeaves;
+		int32 Total = 0;
+		while (true)
+		{
+			LevelOffsets.Add(Total);
+			LevelCounts.Add(Count);
+			Total += Count;
+			if (Count == 1)
+			{
+				break;
+			}
+			Count = FMath::DivideAndRoundUp(Count, 2);
+		}
+
+		Nodes.SetNumUninitialized(Total);
+
+		const bool bBoxes = HasBoxItems();
+		ForEachChunk(
+			NumLeaves, GetNumChunks(NumLeaves * LeafSize), [&](const int32 Chunk, const int32 Start, const int32 End)
+			{
+				for (int32 Leaf = Start; Leaf < End; Leaf++)
+				{
+					FVector LeafMin(TNumericLimits<double>::Max());
+					FVector LeafMax(TNumericLimits<double>::Lowest());
+
+					const int32 Last = FMath::Min((Leaf + 1) * LeafSize, Indices.Num());
+					for (int32 Slot = Leaf * LeafSize; Slot < Last; Slot++)
+					{
+						const FVector& C = Centers[Slot];
+						const FVector E = bBoxes ? Extents[Slot] : FVector::ZeroVector;
+						LeafMin = LeafMin.ComponentMin(C - E);
+						LeafMax = LeafMax.ComponentMax(C + E);
+					}
+
+					Nodes[Leaf] = FNodeBounds{LeafMin, LeafMax};
+				}
+			});
+
+		for (int32 Level = 1; Level < LevelCounts.Num(); Level++)
+		{
+			const int32 ChildOffset = LevelOffsets[Level - 1];
+			const int32 ChildCount = LevelCounts[Level - 1];
+			const int32 Offset = LevelOffsets[Level];
+
+			ForEachChunk(
+				LevelCounts[Level], GetNumChunks(LevelCounts[Level] * LeafSize), [&](const int32 Chunk, const int32 Start, const int32 End)
+				{
+					for (int32 Node = Start; Node < End; Node++)
+					{
+						const int32 A = Node * 2;
+						FNodeBounds Bounds = Nodes[ChildOffset + A];
+						if (A + 1 < ChildCount)
+						{
+							const FNodeBounds& Other = Nodes[ChildOffset + A + 1];
+							Bounds.Min = Bounds.Min.ComponentMin(Other.Min);
+							Bounds.Max = Bounds.Max.ComponentMax(Other.Max);
+						}
+						Nodes[Offset + Node] = Bounds;
+					}
+				});
+		}
+	}
+
+	FBox FFlatIndex::GetBounds() const
+	{
+		if (Nodes.IsEmpty())
+		{
+			return FBox(ForceInit);
+		}
+
+		const FNodeBounds& Root = Nodes[LevelOffsets.Last()];
+		return FBox(Root.Min, Root.Max);
+	}
+
+	int32 FFlatIndex::FindNearest(const FVector& InPosition, const double InMaxDistSquared) const
+	{
+		int32 Best = -1;
+		double BestDist = InMaxDistSquared;
+
+		ForEachNearestFirst(
+			InPosition,
+			[&]()
+			{
+				return BestDist;
+			},
+			[&](const int32 Slot)
+			{
+				const double Dist = ItemDistSquared(Slot, InPosition);
+				if (Dist < BestDist)
+				{
+					BestDist = Dist;
+					Best = Indices[Slot];
+				}
+			});
+
+		return Best;
+	}
+
+	void FFlatIndex::FindKNearest(const FVector& InPosition, const int32 K, TArray<int32>& OutIndices, const double InMaxDistSquared) const
+	{
+		OutIndices.Reset();
+		if (K <= 0)
+		{
+			return;
+		}
+
+		// Max-heap on distance holding the K best so far; its top bounds the search once full
+		TArray<TPair<double, int32>, TInlineAllocator<32>> Heap;
+		const auto HeapPredicate = [](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key > B.Key; };
+
+		ForEachNearestFirst(
+			InPosition,
+			[&]()
+			{
+				return Heap.Num() < K ? InMaxDistSquared : Heap.HeapTop().Key;
+			},
+			[&](const int32 Slot)
+			{
+				const double Dist = ItemDistSquared(Slot, InPosition);
+				if (Dist >= InMaxDistSquared)
+				{
+					return;
+				}
+
+				if (Heap.Num() < K)
+				{
+					Heap.HeapPush(TPair<double, int32>(Dist, Indices[Slot]), HeapPredicate);
+				}
+				else if (Dist < Heap.HeapTop().Key)
+				{
+					Heap.HeapPopDiscard(HeapPredicate, EAllowShrinking::No);
+					Heap.HeapPush(TPair<double, int32>(Dist, Indices[Slot]), HeapPredicate);
+				}
+			});
+
+		Heap.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; });
+
+		OutIndices.Reserve(Heap.Num());
+		for (const TPair<double, int32>& Entry : Heap)
+		{
+			OutIndices.Add(Entry.Value);
+		}
+	}
+}
@@ -3,6 +3,10 @@
 
 #include "Sorting/PCGExPointSorter.h"
 
+#include "PCGExH.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
@@ -13,6 +17,171 @@
 
 namespace PCGExSorting
 {
+	namespace SortingInternal
+	{
+		// Below this many indices, the comparison sort wins over building keys
+		constexpr int32 RadixMinElements = 2048;
+		constexpr int32 MinChunkSize = 16384;
+
+		constexpr int32 RadixBits = 11;
+		constexpr int32 RadixBuckets = 1 << RadixBits;
+
+		int32 GetNumChunks(const int32 InNum)
+		{
+			if (InNum < MinChunkSize * 2)
+			{
+				return 1;
+			}
+			return FMath::Clamp(InNum / MinChunkSize, 1, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() * 2));
+		}
+
+		/** Maps a double to bits that order like the value (-0.0 folds into 0), reversed when bFlip is set. */
+		FORCEINLINE uint64 ToOrderedBits(const double InValue, const bool bFlip)
+		{
+			const double Folded = InValue + 0.0;
+			uint64 Raw;
+			FMemory::Memcpy(&Raw, &Folded, sizeof(double));
+			const uint64 Code = (Raw & (1ULL << 63)) ? ~Raw : Raw | (1ULL << 63);
+			return bFlip ? MAX_uint64 - Code : Code;
+		}
+
+		/** Stable LSD radix sort over the low NumBits of each key. Chunk-parallel histograms and scatter. */
+		void RadixSort(TArray<PCGEx::FIndexKey>& Keys, const int32 NumBits)
+		{
+			const int32 Num = Keys.Num();
+			if (NumBits <= 0)
+			{
+				return;
+			}
+
+			const int32 NumChunks = GetNumChunks(Num);
+			const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+			const EParallelForFlags Flags = NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+			TArray<PCGEx::FIndexKey> Temp;
+			Temp.SetNumUninitialized(Num);
+
+			PCGEx::FIndexKey* Src = Keys.GetData();
+			PCGEx::FIndexKey* Dst = Temp.GetData();
+
+			TArray<int32> Offsets;
+			Offsets.SetNumUninitialized(NumChunks * RadixBuckets);
+
+			for (int32 Shift = 0; Shift < NumBits; Shift += RadixBits)
+			{
+				FMemory::Memzero(Offsets.GetData(), Offsets.Num() * sizeof(int32));
+
+				ParallelFor(
+					NumChunks, [&](const int32 Chunk)
+					{
+						int32* Counts = Offsets.GetData() + Chunk * RadixBuckets;
+						const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Num);
+						for (int32 i = Chunk * ChunkSize; i < End; i++)
+						{
+							Counts[(Src[i].Key >> Shift) & (RadixBuckets - 1)]++;
+						}
+					}, Flags);
+
+				// Bucket-major, chunk-minor prefix sum keeps the scatter stable
+				int32 Sum = 0;
+				for (int32 Bucket = 0; Bucket < RadixBuckets; Bucket++)
+				{
+					for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+					{
+						int32& Slot = Offsets[Chunk * RadixBuckets + Bucket];
+						const int32 Count = Slot;
+						Slot = Sum;
+						Sum += Count;
+					}
+				}
+
+				ParallelFor(
+					NumChunks, [&](const int32 Chunk)
+					{
+						int32* Cursor = Offsets.GetData() + Chunk * RadixBuckets;
+						const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Num);
+						for (int32 i = Chunk * ChunkSize; i < End; i++)
+						{
+							Dst[Cursor[(Src[i].Key >> Shift) & (RadixBuckets - 1)]++] = Src[i];
+						}
+					}, Flags);
+
+				Swap(Src, Dst);
+			}
+
+			if (Src != Keys.GetData())
+			{
+				FMemory::Memcpy(Keys.GetData(), Src, Num * sizeof(PCGEx::FIndexKey));
+			}
+		}
+
+		/** Stable sort: chunks are sorted in parallel, then merged pairwise, one parallel pass per doubling. */
+		template <typename PredicateType>
+		void StableSort(TArray<int32>& Data, PredicateType&& Predicate)
+		{
+			const int32 Num = Data.Num();
+			const int32 NumChunks = GetNumChunks(Num);
+
+			if (NumChunks == 1)
+			{
+				Algo::StableSort(Data, Predicate);
+				return;
+			}
+
+			const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					const int32 Start = Chunk * ChunkSize;
+					TArrayView<int32> View(Data.GetData() + Start, FMath::Min(ChunkSize, Num - Start));
+					Algo::StableSort(View, Predicate);
+				});
+
+			TArray<int32> Temp;
+			Temp.SetNumUninitialized(Num);
+
+			int32* Src = Data.GetData();
+			int32* Dst = Temp.GetData();
+
+			for (int32 Width = ChunkSize; Width < Num; Width *= 2)
+			{
+				ParallelFor(
+					FMath::DivideAndRoundUp(Num, Width * 2), [&](const int32 Pair)
+					{
+						const int32 Lo = Pair * Width * 2;
+						const int32 Mid = FMath::Min(Lo + Width, Num);
+						const int32 Hi = FMath::Min(Mid + Width, Num);
+
+						int32 L = Lo;
+						int32 R = Mid;
+						int32 Out = Lo;
+
+						// Take from the right run only when strictly smaller
+						while (L < Mid && R < Hi)
+						{
+							Dst[Out++] = Predicate(Src[R], Src[L]) ? Src[R++] : Src[L++];
+						}
+						while (L < Mid)
+						{
+							Dst[Out++] = Src[L++];
+						}
+						while (R < Hi)
+						{
+							Dst[Out++] = Src[R++];
+						}
+					});
+
+				Swap(Src, Dst);
+			}
+
+			if (Src != Data.GetData())
+			{
+				FMemory::Memcpy(Data.GetData(), Src, Num * sizeof(int32));
+			}
+		}
+	}
+
 	void FSorter::UpdateCachedState()
 	{
 		NumRules = RuleHandlers.Num();
@@ -491,5 +660,125 @@ namespace PCGExSorting
 		return Cache;
 	}
 
+	void FSortCache::Sort(TArray<int32>& InOutIndices) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSortCache::Sort);
+
+		const int32 Num = InOutIndices.Num();
+		if (Num < 2)
+		{
+			return;
+		}
+
+		if (Num >= SortingInternal::RadixMinElements)
+		{
+			if (TryRadixSort(InOutIndices))
+			{
+				return;
+			}
+		}
+
+		SortingInternal::StableSort(
+			InOutIndices, [&](const int32 A, const int32 B)
+			{
+				return Compare(A, B);
+			});
+	}
+
+	bool FSortCache::TryRadixSort(TArray<int32>& InOutIndices) const
+	{
+		struct FRuleKey
+		{
+			const FRuleCache* Rule = nullptr;
+			bool bFlip = false;
+			uint64 MinCode = 0;
+			uint64 MaxCode = 0;
+		};
+
+		TArray<FRuleKey, TInlineAllocator<8>> Keys;
+
+		for (const FRuleCache& Rule : Rules)
+		{
+			double Min = TNumericLimits<double>::Max();
+			double Max = TNumericLimits<double>::Lowest();
+			for (const double Value : Rule.Values)
+			{
+				if (FMath::IsNaN(Value))
+				{
+					return false;
+				}
+				Min = FMath::Min(Min, Value);
+				Max = FMath::Max(Max, Value);
+			}
+
+			// Every pair compares nearly equal; Compare always moves on to the next rule
+			if (Max - Min <= Rule.Tolerance)
+			{
+				continue;
+			}
+
+			FRuleKey& Key = Keys.AddDefaulted_GetRef();
+			Key.Rule = &Rule;
+			Key.bFlip = Rule.bInvertRule != bDescending;
+
+			// Codes are monotonic, so the extremes bound every key of the rule
+			const uint64 A = SortingInternal::ToOrderedBits(Min, Key.bFlip);
+			const uint64 B = SortingInternal::ToOrderedBits(Max, Key.bFlip);
+			Key.MinCode = FMath::Min(A, B);
+			Key.MaxCode = FMath::Max(A, B);
+		}
+
+		const int32 Num = InOutIndices.Num();
+
+		TArray<PCGEx::FIndexKey> SortKeys;
+		SortKeys.SetNumUninitialized(Num);
+		for (int32 i = 0; i < Num; i++)
+		{
+			SortKeys[i].Index = InOutIndices[i];
+		}
+
+		// One stable pass set per rule, least significant rule first, yields the same lexicographic order as Compare
+		for (int32 k = Keys.Num() - 1; k >= 0; k--)
+		{
+			const FRuleKey& Key = Keys[k];
+			const double* Values = Key.Rule->Values.GetData();
+			const uint64 MinCode = Key.MinCode;
+			const bool bFlip = Key.bFlip;
+
+			// Keys share every bit above the highest one that differs between the extremes; only sort below it
+			const int32 NumBits = FMath::FloorLog2_64(Key.MinCode ^ Key.MaxCode) + 1;
+
+			PCGEX_PARALLEL_FOR(
+				Num,
+				PCGEx::FIndexKey& SortKey = SortKeys[i];
+				SortKey.Key = SortingInternal::ToOrderedBits(Values[SortKey.Index], bFlip) - MinCode;
+			)
+
+			SortingInternal::RadixSort(SortKeys, NumBits);
+
+			// Compare's pairwise tolerance can't be keyed in general, but when no two distinct values are within
+			// tolerance of each other it degenerates to exact equality, which the pass above reproduces.
+			if (Key.Rule->Tolerance > 0)
+			{
+				const double Tolerance = Key.Rule->Tolerance;
+				for (int32 i = 1; i < Num; i++)
+				{
+					const double Delta = FMath::Abs(Values[SortKeys[i].Index] - Values[SortKeys[i - 1].Index]);
+					if (Delta > 0 && Delta <= Tolerance)
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		for (int32 i = 0; i < Num; i++)
+		{
+			InOutIndices[i] = SortKeys[i].Index;
+		}
+
+		return true;
+	}
+
 #pragma endregion
 }
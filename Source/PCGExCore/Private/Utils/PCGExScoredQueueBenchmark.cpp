@@ -0,0 +1,121 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExLog.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Utils/PCGExRadixQueue.h"
+#include "Utils/PCGExScoredQueue.h"
+
+#if !UE_BUILD_SHIPPING
+
+// Microbenchmark comparing the binary-heap and radix-heap queues on full Dijkstra sweeps over a synthetic
+// 4-connected lattice, with both uniform (integer) and random edge weights.
+namespace PCGExScoredQueueBenchmark
+{
+	struct FLattice
+	{
+		int32 Size = 0;
+		TArray<double> Weights; // Per node and direction (+X, -X, +Y, -Y); <0 marks a border
+
+		FLattice(const int32 InSize, const bool bUniform, const int32 InSeed)
+			: Size(InSize)
+		{
+			const FRandomStream Random(InSeed);
+			Weights.SetNumUninitialized(Size * Size * 4);
+			for (int32 i = 0; i < Size * Size; i++)
+			{
+				const int32 X = i % Size;
+				const int32 Y = i / Size;
+				const double W = bUniform ? 1 : Random.FRandRange(0.5, 4);
+				Weights[i * 4 + 0] = X + 1 < Size ? W : -1;
+				Weights[i * 4 + 1] = X > 0 ? W : -1;
+				Weights[i * 4 + 2] = Y + 1 < Size ? W : -1;
+				Weights[i * 4 + 3] = Y > 0 ? W : -1;
+			}
+		}
+	};
+
+	template <typename TQueue>
+	double Sweep(TQueue& Queue, const FLattice& Lattice, TBitArray<>& Visited, const int32 Seed)
+	{
+		const int32 Offsets[4] = {1, -1, Lattice.Size, -Lattice.Size};
+
+		Queue.Enqueue(Seed, 0);
+
+		double Checksum = 0;
+		int32 Current;
+		double Score;
+		while (Queue.Dequeue(Current, Score))
+		{
+			if (Visited[Current])
+			{
+				continue;
+			}
+			Visited[Current] = true;
+			Checksum += Score;
+
+			for (int32 d = 0; d < 4; d++)
+			{
+				const double W = Lattice.Weights[Current * 4 + d];
+				if (W < 0)
+				{
+					continue;
+				}
+
+				const int32 Neighbor = Current + Offsets[d];
+				if (!Visited[Neighbor])
+				{
+					Queue.Enqueue(Neighbor, Score + W);
+				}
+			}
+		}
+
+		return Checksum;
+	}
+
+	template <typename TQueue>
+	void Run(const TCHAR* InLabel, const FLattice& Lattice, const int32 NumRuns)
+	{
+		const int32 NumNodes = Lattice.Size * Lattice.Size;
+		const FRandomStream Random(NumRuns);
+
+		TQueue Queue(NumNodes);
+		TBitArray<> Visited;
+		Visited.Init(false, NumNodes);
+
+		double Checksum = 0;
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 r = 0; r < NumRuns; r++)
+		{
+			Checksum += Sweep(Queue, Lattice, Visited, Random.RandRange(0, NumNodes - 1));
+			Queue.Reset();
+			Visited.SetRange(0, NumNodes, false);
+		}
+		const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start);
+
+		UE_LOG(LogPCGEx, Display, TEXT("  %-12s %10.3f ms/sweep  (checksum %.3f)"), InLabel, Ms / NumRuns, Checksum);
+	}
+
+	static FAutoConsoleCommand CommandBenchScoredQueue(
+		TEXT("pcgex.Bench.ScoredQueue"),
+		TEXT("Compares the binary-heap and radix-heap queues on full Dijkstra sweeps over a lattice. Args: [GridSize=512] [Runs=8]."),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				const int32 GridSize = FMath::Max(2, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 512);
+				const int32 NumRuns = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 8);
+
+				for (const bool bUniform : {true, false})
+				{
+					const FLattice Lattice(GridSize, bUniform, 1337);
+					UE_LOG(LogPCGEx, Display, TEXT("Scored queue benchmark: %dx%d lattice, %s weights, %d sweeps"), GridSize, GridSize, bUniform ? TEXT("uniform") : TEXT("random"), NumRuns);
+
+					Run<PCGEx::FScoredQueue>(TEXT("BinaryHeap"), Lattice, NumRuns);
+					Run<PCGEx::FRadixQueue>(TEXT("RadixHeap"), Lattice, NumRuns);
+				}
+			}));
+}
+
+#endif
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExClusterAdjacency.h"
 #include "PCGExClusterCache.h"
 #include "PCGExClusterCommon.h"
 #include "PCGExEdge.h"
@@ -26,6 +27,11 @@ namespace PCGExMT
 	class FTaskManager;
 }
 
+namespace PCGExSpatial
+{
+	class FFlatIndex;
+}
+
 namespace PCGExData
 {
 	class FPointIO;
@@ -100,6 +106,13 @@ namespace PCGExClusters
 		TSharedPtr<PCGExOctree::FItemOctree> NodeOctree;
 		TSharedPtr<PCGExOctree::FItemOctree> EdgeOctree;
 
+		/** Flat alternatives to the octrees above; closest-node lookups prefer them when present. */
+		TSharedPtr<PCGExSpatial::FFlatIndex> NodeFlatIndex;
+		TSharedPtr<PCGExSpatial::FFlatIndex> EdgeFlatIndex;
+
+		/** Packed CSR copy of node links, built on demand by GetFlatAdjacency. */
+		TSharedPtr<FFlatAdjacency> FlatAdjacency;
+
 		/**
 		 * Get cached data by key, optionally validating context hash.
 		 * @param Key Cache key (e.g., "FaceEnumerator")
@@ -422,6 +435,19 @@ namespace PCGExClusters
 
 		void RebuildNodeOctree();
 		void RebuildEdgeOctree();
+
+		TSharedPtr<PCGExSpatial::FFlatIndex> GetNodeFlatIndex();
+		TSharedPtr<PCGExSpatial::FFlatIndex> GetEdgeFlatIndex();
+
+		/** Node positions as points. */
+		void RebuildNodeFlatIndex();
+		/** Edge segments as boxes. Does not need BoundedEdges. */
+		void RebuildEdgeFlatIndex();
+
+		/** Returns the flat adjacency, building it on first call. Thread-safe, but callers on hot paths
+		 * should grab it once during single-threaded prep and keep the raw pointer around. */
+		TSharedPtr<FFlatAdjacency> GetFlatAdjacency();
+		/** Builds the octree for Mode, plus the flat index FindClosestNode prefers when pcgex.SpatialIndex.Flat is set. */
 		void RebuildOctree(EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild = false);
 
 		void GatherNodesPointIndices(TArray<int32>& OutValidNodesPointIndices, const bool bValidity) const;
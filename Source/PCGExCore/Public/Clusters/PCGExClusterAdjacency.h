@@ -0,0 +1,48 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExLink.h"
+
+namespace PCGExClusters
+{
+	struct FNode;
+
+	/**
+	 * Compressed-sparse-row view of a cluster's adjacency.
+	 * Every node's links are packed back to back in a single array, in the same order as FNode::Links,
+	 * and Offsets[i]..Offsets[i+1] delimits node i's range. Built once from the node array; traversal-heavy
+	 * consumers (search, diffusion, centrality, relaxation) walk it instead of hopping across FNode instances.
+	 * Node links are immutable once a cluster is built, so the flat copy never goes stale.
+	 */
+	class PCGEXCORE_API FFlatAdjacency : public TSharedFromThis<FFlatAdjacency>
+	{
+	public:
+		FFlatAdjacency() = default;
+		~FFlatAdjacency() = default;
+
+		/** NumNodes + 1 entries; last entry is the total number of directed links. */
+		TArray<int32> Offsets;
+		TArray<PCGExGraphs::FLink> Links;
+
+		void Build(const TArray<FNode>& InNodes);
+
+		FORCEINLINE int32 NumNodes() const
+		{
+			return Offsets.Num() - 1;
+		}
+
+		FORCEINLINE int32 Num(const int32 NodeIndex) const
+		{
+			return Offsets[NodeIndex + 1] - Offsets[NodeIndex];
+		}
+
+		FORCEINLINE TConstArrayView<PCGExGraphs::FLink> GetLinks(const int32 NodeIndex) const
+		{
+			const int32 Start = Offsets[NodeIndex];
+			return TConstArrayView<PCGExGraphs::FLink>(Links.GetData() + Start, Offsets[NodeIndex + 1] - Start);
+		}
+	};
+}
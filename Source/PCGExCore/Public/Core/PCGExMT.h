@@ -24,6 +24,12 @@ namespace PCGEx
 
 struct FPCGContextHandle;
 enum class EPCGExAsyncPriority : uint8;
+
+namespace PCGExProfiling
+{
+	class FGroupStats;
+	class FContextProfile;
+}
 struct FPCGExContext;
 
 namespace PCGExMT
@@ -34,6 +40,14 @@ namespace PCGExMT
 	PCGEXCORE_API
 	int32 SubLoopScopes(TArray<FScope>& OutSubRanges, const int32 NumIterations, const int32 RangeSize);
 
+	/**
+	 * Splits NumIterations into scopes for the given scheduling mode.
+	 * Every scope exists up front with its LoopIndex, so per-scope storage prepared from the scope list keeps working.
+	 * @param DesiredBatchSize Requested scope size, sanitized the same way as GetSanitizedBatchSize
+	 */
+	PCGEXCORE_API
+	int32 ScheduleLoopScopes(TArray<FScope>& OutSubRanges, const int32 NumIterations, const int32 DesiredBatchSize, const EScheduling Scheduling);
+
 	enum class EAsyncHandleState : uint8
 	{
 		Idle    = 0,
@@ -166,6 +180,9 @@ namespace PCGExMT
 		std::atomic<int32> StartedCount{0};
 		std::atomic<int32> CompletedCount{0};
 
+		// Only set when the owning manager records a profile
+		TSharedPtr<PCGExProfiling::FGroupStats> ProfileStats;
+
 	public:
 		using FCreateLaunchablePredicate = std::function<TSharedPtr<FTask>(int32)>;
 
@@ -256,6 +273,8 @@ namespace PCGExMT
 		mutable FRWLock GroupsLock;
 		TArray<TSharedPtr<FTaskGroup>> Groups;
 
+		TSharedPtr<PCGExProfiling::FContextProfile> Profile;
+
 	public:
 		FEndCallback OnEndCallback;
 		UE::Tasks::ETaskPriority WorkPriority = UE::Tasks::ETaskPriority::Default;
@@ -286,6 +305,12 @@ namespace PCGExMT
 
 		void Reset();
 
+		/** Per-context profile, valid only if pcgex.Profile.Enabled was set when this manager was created. */
+		const TSharedPtr<PCGExProfiling::FContextProfile>& GetProfile() const { return Profile; }
+
+		/** Hands the recorded profile over to the global registry; the manager stops recording afterward. */
+		void SubmitProfile();
+
 	protected:
 		virtual bool CanScheduleWork() override;
 		virtual void LaunchInternal(const TSharedPtr<FTask>& InTask) override;
@@ -314,6 +339,9 @@ namespace PCGExMT
 		using FSubLoopStartCallback = std::function<void(const FScope&)>;
 		FSubLoopStartCallback OnSubLoopStartCallback;
 
+		/** Scope split and dispatch used by StartIterations / StartSubLoops when not single-threaded */
+		EScheduling Scheduling = EScheduling::Static;
+
 		explicit FTaskGroup(const FName InName);
 
 		template <typename T, typename... Args>
@@ -401,6 +429,9 @@ namespace PCGExMT
 		virtual void ExecuteTask(const TSharedPtr<FTaskManager>& TaskManager) = 0;
 
 	protected:
+		// Stamped on launch when profiling, to measure how long the task sat in the scheduler queue
+		uint64 QueuedCycles = 0;
+
 		void Launch(const TSharedPtr<FTask>& InTask, const bool bIsExpected = false) const;
 	};
 
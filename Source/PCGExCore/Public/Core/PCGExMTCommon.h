@@ -102,6 +102,24 @@ namespace PCGExMT
 			return TArrayView<const T>(InArray.GetData() + Start, Count);
 		}
 	};
+
+	/** How a loop is split into scopes and how workers pick them up. */
+	enum class EScheduling : uint8
+	{
+		Static       = 0, // Even scopes sized by GetSanitizedBatchSize. Best when per-item cost is uniform.
+		Guided       = 1, // Scopes shrink as the loop drains: big ones first to amortize setup, small ones to even out the tail.
+		WorkStealing = 2, // Fine even scopes pulled in order from a shared cursor by whichever worker is idle.
+	};
+
+	/**
+	 * Runs Body once per scope, in parallel, dispatched according to Scheduling.
+	 * Static keeps the plain unbalanced ParallelFor; Guided and WorkStealing have one task per worker
+	 * pulling scopes in order, so the smallest scopes are the last ones handed out.
+	 * When pcgex.MT.ReportTailIdle is set, logs how long threads sat idle waiting for the last scope.
+	 * @param Scopes Scopes to run, typically from ScheduleLoopScopes with the same Scheduling
+	 * @param LoopName Label used in the tail-idle report
+	 */
+	PCGEXCORE_API void ExecuteScopes(const TArray<FScope>& Scopes, const FScopedLoopBody& Body, EScheduling Scheduling, FName LoopName = NAME_None);
 }
 
 #pragma region MT MACROS
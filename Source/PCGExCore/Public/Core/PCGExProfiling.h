@@ -0,0 +1,165 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-context execution profile.
+ * When pcgex.Profile.Enabled is set, each FTaskManager owns an FContextProfile. Every task group it creates records
+ * wall time, task count, launch-to-start wait and peak concurrency under a hierarchical path ("MANAGER/Group/SubGroup"),
+ * and batch processing records its phases (Process, CompleteWork, Write) from dispatch until their tasks drain.
+ * Finished profiles are submitted to a global registry when the context completes, and can be dumped with
+ * `pcgex.Profile.Dump [json|csv] [FilePath]`.
+ */
+namespace PCGExProfiling
+{
+	/** Whether task managers created from now on record a profile. Read once per manager, so toggling mid-execution is safe. */
+	PCGEXCORE_API bool IsEnabled();
+
+	/** Live counters for a single run of a group. Updated concurrently by its tasks, folded into the profile when the group ends. */
+	class PCGEXCORE_API FGroupStats
+	{
+	public:
+		FString Path;
+		uint64 StartCycles = 0;
+
+		std::atomic<int32> NumTasks{0};
+		std::atomic<int32> NumRunning{0};
+		std::atomic<int32> PeakConcurrency{0};
+		std::atomic<uint64> BusyCycles{0};
+		std::atomic<uint64> WaitCycles{0};
+		std::atomic<uint64> MaxWaitCycles{0};
+
+		explicit FGroupStats(const FString& InPath);
+
+		/** Marks a task as running; InQueuedCycles is when it was handed to the scheduler (0 = unknown). Returns the start stamp. */
+		uint64 EnterTask(const uint64 InQueuedCycles);
+		void ExitTask(const uint64 InStartCycles);
+	};
+
+	/** RAII wrapper around EnterTask / ExitTask. Null stats make it a no-op. */
+	struct FTaskScope
+	{
+		FGroupStats* Stats = nullptr;
+		uint64 StartCycles = 0;
+
+		FTaskScope(FGroupStats* InStats, const uint64 InQueuedCycles)
+			: Stats(InStats)
+		{
+			if (Stats)
+			{
+				StartCycles = Stats->EnterTask(InQueuedCycles);
+			}
+		}
+
+		~FTaskScope()
+		{
+			if (Stats)
+			{
+				Stats->ExitTask(StartCycles);
+			}
+		}
+
+		FTaskScope(const FTaskScope&) = delete;
+		FTaskScope& operator=(const FTaskScope&) = delete;
+	};
+
+	/** Aggregated entry for one path. Times are in milliseconds; a path that ran several times accumulates. */
+	struct PCGEXCORE_API FRecord
+	{
+		FString Path;
+		int32 NumRuns = 0;
+		int32 NumTasks = 0;
+		int32 PeakConcurrency = 0;
+		double WallTime = 0;
+		double BusyTime = 0;
+		double WaitTime = 0;
+		double MaxWaitTime = 0;
+	};
+
+	class PCGEXCORE_API FContextProfile : public TSharedFromThis<FContextProfile>
+	{
+	protected:
+		mutable FCriticalSection RecordsLock;
+		TArray<FRecord> Records;
+		TMap<FString, int32> RecordIndices;
+
+		FRecord& FindOrAddRecordUnsafe(const FString& InPath);
+
+	public:
+		FString NodeName;
+		FString SourceName;
+		uint64 StartCycles = 0;
+		double TotalTime = 0;
+
+		FContextProfile();
+
+		TSharedPtr<FGroupStats> BeginGroup(const FString& InPath) const;
+		void EndGroup(const FGroupStats& InStats);
+
+		/** Records a synchronous phase that ran on a single thread for InSeconds. */
+		void AddPhase(const FString& InPath, const double InSeconds);
+
+		/** Stamps total time since creation. Called once, right before submission. */
+		void Finalize();
+
+		TArray<FRecord> GetRecords() const;
+	};
+
+	/** RAII timer for a synchronous processor phase. Null profile makes it a no-op. */
+	struct PCGEXCORE_API FPhaseScope
+	{
+		TSharedPtr<FContextProfile> Profile;
+		const TCHAR* Path = nullptr;
+		uint64 StartCycles = 0;
+
+		FPhaseScope(const TSharedPtr<FContextProfile>& InProfile, const TCHAR* InPath);
+		~FPhaseScope();
+
+		FPhaseScope(const FPhaseScope&) = delete;
+		FPhaseScope& operator=(const FPhaseScope&) = delete;
+	};
+
+	/**
+	 * Timer for a phase whose work outlives the call that dispatches it, e.g. batch Process/CompleteWork/Write, which only
+	 * launch task groups. Begin when the work is dispatched, End once the owner has observed it drain. Null profile makes it a no-op.
+	 */
+	class PCGEXCORE_API FPendingPhase
+	{
+	public:
+		FPendingPhase() = default;
+		~FPendingPhase();
+
+		/** Opens a new phase, closing any phase still pending. */
+		void Begin(const TSharedPtr<FContextProfile>& InProfile, const TCHAR* InPath);
+		void End();
+
+		FPendingPhase(const FPendingPhase&) = delete;
+		FPendingPhase& operator=(const FPendingPhase&) = delete;
+
+	protected:
+		TSharedPtr<FContextProfile> Profile;
+		const TCHAR* Path = nullptr;
+		uint64 StartCycles = 0;
+	};
+
+	/** Hands a finished profile to the global registry. */
+	PCGEXCORE_API void Submit(const TSharedPtr<FContextProfile>& InProfile);
+
+	/** Drops every submitted profile. */
+	PCGEXCORE_API void ResetSubmitted();
+
+	PCGEXCORE_API FString ToJson();
+	PCGEXCORE_API FString ToCsv();
+}
+
+// Times the enclosing scope as a named phase of the manager's profile, if any.
+#define PCGEX_PROFILE_PHASE(_MANAGER, _NAME) const PCGExProfiling::FPhaseScope ProfilePhaseScope(_MANAGER ? _MANAGER->GetProfile() : nullptr, TEXT(_NAME));
+
+// Opens a named phase on an FPendingPhase; it stays open until PCGEX_PROFILE_PHASE_END, for work that completes asynchronously.
+#define PCGEX_PROFILE_PHASE_BEGIN(_PHASE, _MANAGER, _NAME) _PHASE.Begin(_MANAGER ? _MANAGER->GetProfile() : nullptr, TEXT(_NAME));
+#define PCGEX_PROFILE_PHASE_END(_PHASE) _PHASE.End();
@@ -58,6 +58,9 @@ namespace PCGExData
 		virtual void SetValue(const int32 Index, const T& Value) override;
 		virtual PCGExValueHash ReadValueHash(const int32 Index) override;
 
+		virtual const T* GetReadData() const override;
+		virtual T* GetWriteData() override;
+
 	protected:
 		virtual void ComputeValueHashes(const PCGExMT::FScope& Scope);
 
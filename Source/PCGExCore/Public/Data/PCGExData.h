@@ -278,6 +278,11 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		// Unsafe set value in output
 		virtual void SetValue(const int32 Index, const T& Value) = 0;
 
+		// Contiguous storage behind Read / SetValue, when the buffer has one; nullptr otherwise.
+		// Lets span consumers gather/scatter without a virtual call per element.
+		virtual const T* GetReadData() const { return nullptr; }
+		virtual T* GetWriteData() { return nullptr; }
+
 		virtual bool InitForRead(const EIOSide InSide = EIOSide::In, const bool bScoped = false) = 0;
 		virtual bool InitForBroadcast(const FPCGAttributePropertyInputSelector& InSelector, const bool bCaptureMinMax = false, const bool bScoped = false, const bool bQuiet = false) = 0;
 		virtual bool InitForWrite(const T& DefaultValue, bool bAllowInterpolation, EBufferInit Init = EBufferInit::Inherit) = 0;
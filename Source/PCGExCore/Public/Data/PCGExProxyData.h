@@ -215,6 +215,11 @@ namespace PCGExData
 			GetVoid(Index, OutValue);
 		}
 
+		// Gather/scatter over many indices into densely packed working-type values (stride GetValueSize()).
+		// Only meant for trivially copyable working types; defaults loop GetVoid/SetVoid.
+		virtual void GetVoids(TConstArrayView<int32> Indices, void* OutValues) const;
+		virtual void SetVoids(TConstArrayView<int32> Indices, const void* InValues) const;
+
 		// Hash computation
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const = 0;
 
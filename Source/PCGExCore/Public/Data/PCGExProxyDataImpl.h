@@ -69,6 +69,9 @@ namespace PCGExData
 		virtual void SetVoid(const int32 Index, const void* Value) const override;
 		virtual void GetCurrentVoid(const int32 Index, void* OutValue) const override;
 
+		virtual void GetVoids(TConstArrayView<int32> Indices, void* OutValues) const override;
+		virtual void SetVoids(TConstArrayView<int32> Indices, const void* InValues) const override;
+
 		virtual TSharedPtr<IBuffer> GetBuffer() const override;
 		virtual bool EnsureReadable() const override;
 
@@ -51,7 +51,8 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite2> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		/** Unique undirected vtx pairs (PCGEx::H64U), sorted ascending. */
+		TArray<uint64> DelaunayEdges;
 		TSet<int32> DelaunayHull;
 		bool IsValid = false;
 
@@ -66,11 +67,21 @@ namespace PCGExMath::Geo
 		bool ProcessDelaunator(const std::vector<double>& Coords, const bool bComputeDelaunayEdges, const bool bComputeHull);
 		bool ProcessFallback(const TArray<FVector2D>& ProjectedPositions, const bool bComputeDelaunayEdges, const bool bComputeHull);
 
+		/**
+		 * Splits the input into vertical strips triangulated concurrently, then re-triangulates the seams.
+		 * Returns false if stitching could not be completed, leaving the caller to run ProcessDelaunator instead.
+		 */
+		bool ProcessPartitioned(const std::vector<double>& Coords, const bool bComputeDelaunayEdges, const bool bComputeHull);
+
+		/** Builds DelaunayEdges/DelaunayHull from Sites, whose Neighbors[k] must be the site across edge Vtx[k]-Vtx[k+1]. */
+		void BuildEdgesAndHull(const int32 NumVertices, const bool bComputeDelaunayEdges, const bool bComputeHull);
+
 	public:
 		/**
 		 * Triangulate the given positions, projected onto a working plane.
 		 * Sites (triangles + adjacency + per-site hull flag) are always built.
-		 * @param bComputeDelaunayEdges Populate the DelaunayEdges set (unique undirected vtx pairs). Skip when only Sites/adjacency are needed.
+		 * Inputs of at least ParallelDelaunayMinPoints (core settings) are triangulated in parallel strips when Delaunator is enabled.
+		 * @param bComputeDelaunayEdges Populate DelaunayEdges (unique undirected vtx pairs, sorted). Skip when only Sites/adjacency are needed.
 		 * @param bComputeHull Populate the DelaunayHull vertex set.
 		 */
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const bool bComputeDelaunayEdges = true, const bool bComputeHull = true);
@@ -86,14 +97,12 @@ namespace PCGExMath::Geo
 
 	struct PCGEXCORE_API FDelaunaySite3
 	{
-		uint32 Faces[4];
-		int32 Vtx[4];
+		int32 Vtx[4];       // Ascending
+		int32 Neighbors[4]; // Site across face MTX[f], -1 on the hull
 		int32 Id = -1;
 		int8 bOnHull = 0;
 
 		explicit FDelaunaySite3(const FIntVector4& InVtx, const int32 InId = -1);
-
-		void ComputeFaces();
 	};
 
 	class PCGEXCORE_API TDelaunay3
@@ -101,9 +110,9 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite3> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		/** Unique undirected vtx pairs (PCGEx::H64U), sorted ascending. */
+		TArray<uint64> DelaunayEdges;
 		TSet<int32> DelaunayHull;
-		TMap<uint32, uint64> Adjacency;
 
 		bool IsValid = false;
 
@@ -116,139 +125,28 @@ namespace PCGExMath::Geo
 	protected:
 		void Clear();
 
+		bool ProcessInternal(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull);
+
+		/**
+		 * Tetrahedralizes overlapping tiles concurrently, keeping in each tile the tetrahedra it owns, then re-tetrahedralizes the seams.
+		 * Returns false if the result could not be completed, leaving the caller to run the single pass instead.
+		 */
+		bool ProcessTiled(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull);
+
+		/** Builds DelaunayEdges, and face adjacency/hull if requested, from Sites. With bValidate, returns false if Sites isn't a valid tetrahedralization. */
+		bool BuildTopology(const int32 NumVertices, const bool bComputeAdjacency, const bool bComputeHull, const bool bValidate);
+
 	public:
+		/**
+		 * Tetrahedralize the given positions.
+		 * Inputs of at least ParallelDelaunayMinPoints (core settings) are processed as parallel tiles.
+		 * @tparam bComputeAdjacency Fill each site's Neighbors.
+		 * @tparam bComputeHull Fill DelaunayHull and flag hull sites.
+		 */
 		template <bool bComputeAdjacency = false, bool bComputeHull = false>
 		bool Process(const TArrayView<FVector>& Positions)
 		{
-			Clear();
-			if (Positions.IsEmpty() || Positions.Num() <= 3)
-			{
-				return false;
-			}
-
-			UE::Geometry::FDelaunay3 Tetrahedralization;
-
-			if (!Tetrahedralization.Triangulate(Positions))
-			{
-				Clear();
-				return false;
-			}
-
-			IsValid = true;
-
-			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
-
-			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
-
-			TSet<uint32> FacesUsage;
-			if constexpr (bComputeAdjacency)
-			{
-				Adjacency.Reserve(NumSites * 4);
-			}
-			if constexpr (bComputeHull)
-			{
-				FacesUsage.Reserve(NumSites);
-			}
-
-			//PCGExArrayHelpers::InitArray(Sites, NumSites);
-			Sites.SetNumUninitialized(NumSites);
-
-			for (int i = 0; i < NumSites; i++)
-			{
-				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
-				FDelaunaySite3& Site = Sites[i];
-
-				for (int a = 0; a < 4; a++)
-				{
-					for (int b = a + 1; b < 4; b++)
-					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
-					}
-				}
-
-				if constexpr (bComputeHull || bComputeAdjacency)
-				{
-					Site.ComputeFaces();
-				}
-
-				if constexpr (bComputeHull && bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet)
-						{
-							FacesUsage.Remove(FH);
-						}
-
-						if (const uint64* AH = Adjacency.Find(FH))
-						{
-							Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH)));
-						}
-						else
-						{
-							Adjacency.Add(FH, PCGEx::NH64(-1, i));
-						}
-					}
-				}
-				else if constexpr (bComputeHull)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet)
-						{
-							FacesUsage.Remove(FH);
-						}
-					}
-				}
-				else if constexpr (bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						if (const uint64* AH = Adjacency.Find(FH))
-						{
-							Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH)));
-						}
-						else
-						{
-							Adjacency.Add(FH, PCGEx::NH64(-1, i));
-						}
-					}
-				}
-			}
-
-			if constexpr (bComputeHull)
-			{
-				for (FDelaunaySite3& Site : Sites)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						if (FacesUsage.Contains(Site.Faces[f]))
-						{
-							for (int fi = 0; fi < 3; fi++)
-							{
-								DelaunayHull.Add(Site.Vtx[MTX[f][fi]]);
-							}
-							Site.bOnHull = true;
-						}
-					}
-				}
-			}
-
-			FacesUsage.Empty();
-			Tetrahedra.Empty();
-
-			return IsValid;
+			return ProcessInternal(Positions, bComputeAdjacency, bComputeHull);
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
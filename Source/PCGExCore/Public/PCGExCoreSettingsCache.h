@@ -33,6 +33,7 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bDefaultScopedAttributeGet = true;
 	bool bBulkInitData = false;
 	bool bUseDelaunator = true;
+	int32 ParallelDelaunayMinPoints = 250000;
 	bool bAssertOnEmptyThread = true;
 	bool bRuntimeAlwaysOffThread = false;
 
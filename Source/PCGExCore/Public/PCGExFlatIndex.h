@@ -0,0 +1,350 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/GenericOctree.h"
+
+namespace PCGExSpatial
+{
+	/** Whether systems that can pick either (cluster closest-node lookups, probing) build an FFlatIndex instead of an FItemOctree. Backed by pcgex.SpatialIndex.Flat. */
+	PCGEXCORE_API bool UseFlatIndex();
+
+	/**
+	 * Static spatial index over int32 items, stored flat.
+	 * Items are sorted along a Morton curve and packed LeafSize per leaf; an implicit binary tree of bounds sits on
+	 * top of the leaves (node j of a level parents nodes 2j and 2j+1 of the level below). Build is parallel end to
+	 * end -- Morton keys, radix sort, gather, and one pass per tree level -- and costs ~28 bytes per point item
+	 * (~52 per box item) plus about 12 bytes per item of tree bounds.
+	 *
+	 * Query surface mirrors PCGExOctree::FItemOctree (box tests, first-hit box tests) plus sphere, nearest and kNN.
+	 * Callbacks receive the item index. Immutable once built; queries are thread-safe.
+	 */
+	class PCGEXCORE_API FFlatIndex
+	{
+	public:
+		static constexpr int32 LeafSize = 8;
+
+		FFlatIndex() = default;
+
+		/** Builds point items. GetPosition is called concurrently; returning false skips the item. */
+		void BuildPoints(const int32 InNum, TFunctionRef<bool(int32, FVector&)> GetPosition);
+
+		/** Builds box items. GetBox is called concurrently; returning false skips the item. */
+		void BuildBoxes(const int32 InNum, TFunctionRef<bool(int32, FBox&)> GetBox);
+
+		FORCEINLINE int32 Num() const
+		{
+			return Indices.Num();
+		}
+
+		FORCEINLINE bool IsEmpty() const
+		{
+			return Indices.IsEmpty();
+		}
+
+		FORCEINLINE bool HasBoxItems() const
+		{
+			return !Extents.IsEmpty();
+		}
+
+		FBox GetBounds() const;
+
+		/** Calls Func(Index) for every item whose bounds intersect InBox (inclusive). */
+		template <typename FuncType>
+		void FindElementsWithBoundsTest(const FBox& InBox, FuncType&& Func) const
+		{
+			ForEachLeafItem(
+				[&](const FVector& Min, const FVector& Max)
+				{
+					return BoxOverlaps(Min, Max, InBox);
+				},
+				[&](const int32 Slot)
+				{
+					if (ItemOverlaps(Slot, InBox))
+					{
+						Func(Indices[Slot]);
+					}
+					return true;
+				});
+		}
+
+		template <typename FuncType>
+		void FindElementsWithBoundsTest(const FBoxCenterAndExtent& InBox, FuncType&& Func) const
+		{
+			FindElementsWithBoundsTest(InBox.GetBox(), Forward<FuncType>(Func));
+		}
+
+		/** Same as FindElementsWithBoundsTest, but Func returns false to stop. Returns false if stopped early. */
+		template <typename FuncType>
+		bool FindFirstElementWithBoundsTest(const FBox& InBox, FuncType&& Func) const
+		{
+			return ForEachLeafItem(
+				[&](const FVector& Min, const FVector& Max)
+				{
+					return BoxOverlaps(Min, Max, InBox);
+				},
+				[&](const int32 Slot)
+				{
+					return !ItemOverlaps(Slot, InBox) || Func(Indices[Slot]);
+				});
+		}
+
+		template <typename FuncType>
+		bool FindFirstElementWithBoundsTest(const FBoxCenterAndExtent& InBox, FuncType&& Func) const
+		{
+			return FindFirstElementWithBoundsTest(InBox.GetBox(), Forward<FuncType>(Func));
+		}
+
+		/** Calls Func(Index) for every item whose bounds intersect the sphere. */
+		template <typename FuncType>
+		void FindElementsInSphere(const FVector& InCenter, const double InRadius, FuncType&& Func) const
+		{
+			const double RadiusSquared = InRadius * InRadius;
+			ForEachLeafItem(
+				[&](const FVector& Min, const FVector& Max)
+				{
+					return BoxDistSquared(Min, Max, InCenter) <= RadiusSquared;
+				},
+				[&](const int32 Slot)
+				{
+					if (ItemDistSquared(Slot, InCenter) <= RadiusSquared)
+					{
+						Func(Indices[Slot]);
+					}
+					return true;
+				});
+		}
+
+		/** Same as FindElementsInSphere, but Func returns false to stop. Returns false if stopped early. */
+		template <typename FuncType>
+		bool FindFirstElementInSphere(const FVector& InCenter, const double InRadius, FuncType&& Func) const
+		{
+			const double RadiusSquared = InRadius * InRadius;
+			return ForEachLeafItem(
+				[&](const FVector& Min, const FVector& Max)
+				{
+					return BoxDistSquared(Min, Max, InCenter) <= RadiusSquared;
+				},
+				[&](const int32 Slot)
+				{
+					return ItemDistSquared(Slot, InCenter) > RadiusSquared || Func(Indices[Slot]);
+				});
+		}
+
+		/**
+		 * Exact nearest item under a caller-provided metric. DistSquared(Index) must never be smaller than the squared
+		 * distance from InPosition to the item bounds (any point-to-geometry distance qualifies); return
+		 * TNumericLimits<double>::Max() to reject an item. Returns -1 if nothing qualifies within InMaxDistSquared.
+		 */
+		template <typename DistFuncType>
+		int32 FindNearest(const FVector& InPosition, DistFuncType&& DistSquared, const double InMaxDistSquared = TNumericLimits<double>::Max()) const
+		{
+			int32 Best = -1;
+			double BestDist = InMaxDistSquared;
+
+			ForEachNearestFirst(
+				InPosition,
+				[&]()
+				{
+					return BestDist;
+				},
+				[&](const int32 Slot)
+				{
+					const int32 Index = Indices[Slot];
+					const double Dist = DistSquared(Index);
+					if (Dist < BestDist)
+					{
+						BestDist = Dist;
+						Best = Index;
+					}
+				});
+
+			return Best;
+		}
+
+		/** Nearest item by distance to its bounds (its position for point items). */
+		int32 FindNearest(const FVector& InPosition, const double InMaxDistSquared = TNumericLimits<double>::Max()) const;
+
+		/** The K items closest to InPosition by distance to their bounds, nearest first. */
+		void FindKNearest(const FVector& InPosition, const int32 K, TArray<int32>& OutIndices, const double InMaxDistSquared = TNumericLimits<double>::Max()) const;
+
+	protected:
+		struct FNodeBounds
+		{
+			FVector Min;
+			FVector Max;
+		};
+
+		// Item data in Morton order
+		TArray<int32> Indices;
+		TArray<FVector> Centers;
+		TArray<FVector> Extents; // Empty for point items
+
+		// Tree bounds, level by level from the leaves (level 0) up to the single root
+		TArray<FNodeBounds> Nodes;
+		TArray<int32> LevelOffsets;
+		TArray<int32> LevelCounts;
+
+		void Build(const int32 InNum, const bool bBoxes, TFunctionRef<bool(int32, FVector&, FVector&)> GetItem);
+		void BuildTree();
+
+		FORCEINLINE static bool BoxOverlaps(const FVector& Min, const FVector& Max, const FBox& InBox)
+		{
+			return Min.X <= InBox.Max.X && Max.X >= InBox.Min.X
+				&& Min.Y <= InBox.Max.Y && Max.Y >= InBox.Min.Y
+				&& Min.Z <= InBox.Max.Z && Max.Z >= InBox.Min.Z;
+		}
+
+		FORCEINLINE static double BoxDistSquared(const FVector& Min, const FVector& Max, const FVector& P)
+		{
+			const double DX = FMath::Max3(Min.X - P.X, 0.0, P.X - Max.X);
+			const double DY = FMath::Max3(Min.Y - P.Y, 0.0, P.Y - Max.Y);
+			const double DZ = FMath::Max3(Min.Z - P.Z, 0.0, P.Z - Max.Z);
+			return DX * DX + DY * DY + DZ * DZ;
+		}
+
+		FORCEINLINE bool ItemOverlaps(const int32 Slot, const FBox& InBox) const
+		{
+			const FVector& C = Centers[Slot];
+			if (Extents.IsEmpty())
+			{
+				return InBox.IsInsideOrOn(C);
+			}
+			const FVector& E = Extents[Slot];
+			return BoxOverlaps(C - E, C + E, InBox);
+		}
+
+		FORCEINLINE double ItemDistSquared(const int32 Slot, const FVector& P) const
+		{
+			const FVector& C = Centers[Slot];
+			if (Extents.IsEmpty())
+			{
+				return FVector::DistSquared(C, P);
+			}
+			const FVector& E = Extents[Slot];
+			return BoxDistSquared(C - E, C + E, P);
+		}
+
+		/** Depth-first walk of nodes accepted by NodeTest; ItemFunc(Slot) returns false to stop. Returns false if stopped. */
+		template <typename NodeTestType, typename ItemFuncType>
+		bool ForEachLeafItem(NodeTestType&& NodeTest, ItemFuncType&& ItemFunc) const
+		{
+			if (Indices.IsEmpty())
+			{
+				return true;
+			}
+
+			// (Level, Node) pairs; depth is log2(leaves) so this never grows past a few dozen entries
+			TArray<TPair<int32, int32>, TInlineAllocator<64>> Stack;
+			Stack.Emplace(LevelCounts.Num() - 1, 0);
+
+			while (!Stack.IsEmpty())
+			{
+				const TPair<int32, int32> Entry = Stack.Pop(EAllowShrinking::No);
+				const int32 Level = Entry.Key;
+				const int32 Node = Entry.Value;
+
+				const FNodeBounds& Bounds = Nodes[LevelOffsets[Level] + Node];
+				if (!NodeTest(Bounds.Min, Bounds.Max))
+				{
+					continue;
+				}
+
+				if (Level == 0)
+				{
+					const int32 End = FMath::Min((Node + 1) * LeafSize, Indices.Num());
+					for (int32 Slot = Node * LeafSize; Slot < End; Slot++)
+					{
+						if (!ItemFunc(Slot))
+						{
+							return false;
+						}
+					}
+					continue;
+				}
+
+				const int32 Child = Node * 2;
+				if (Child + 1 < LevelCounts[Level - 1])
+				{
+					Stack.Emplace(Level - 1, Child + 1);
+				}
+				Stack.Emplace(Level - 1, Child);
+			}
+
+			return true;
+		}
+
+		/** Branch-and-bound walk visiting the closer child first and pruning nodes farther than GetBound(). */
+		template <typename BoundFuncType, typename ItemFuncType>
+		void ForEachNearestFirst(const FVector& InPosition, BoundFuncType&& GetBound, ItemFuncType&& ItemFunc) const
+		{
+			if (Indices.IsEmpty())
+			{
+				return;
+			}
+
+			struct FEntry
+			{
+				int32 Level;
+				int32 Node;
+				double Dist;
+			};
+
+			TArray<FEntry, TInlineAllocator<64>> Stack;
+			{
+				const FNodeBounds& Root = Nodes[LevelOffsets.Last()];
+				Stack.Add({LevelCounts.Num() - 1, 0, BoxDistSquared(Root.Min, Root.Max, InPosition)});
+			}
+
+			while (!Stack.IsEmpty())
+			{
+				const FEntry Entry = Stack.Pop(EAllowShrinking::No);
+				if (Entry.Dist >= GetBound())
+				{
+					continue;
+				}
+
+				if (Entry.Level == 0)
+				{
+					const int32 End = FMath::Min((Entry.Node + 1) * LeafSize, Indices.Num());
+					for (int32 Slot = Entry.Node * LeafSize; Slot < End; Slot++)
+					{
+						ItemFunc(Slot);
+					}
+					continue;
+				}
+
+				const int32 ChildLevel = Entry.Level - 1;
+				const int32 A = Entry.Node * 2;
+				const int32 B = A + 1;
+
+				const FNodeBounds& BoundsA = Nodes[LevelOffsets[ChildLevel] + A];
+				const double DistA = BoxDistSquared(BoundsA.Min, BoundsA.Max, InPosition);
+
+				if (B < LevelCounts[ChildLevel])
+				{
+					const FNodeBounds& BoundsB = Nodes[LevelOffsets[ChildLevel] + B];
+					const double DistB = BoxDistSquared(BoundsB.Min, BoundsB.Max, InPosition);
+
+					// Push the farther one first so the closer one pops next
+					if (DistA <= DistB)
+					{
+						Stack.Add({ChildLevel, B, DistB});
+						Stack.Add({ChildLevel, A, DistA});
+					}
+					else
+					{
+						Stack.Add({ChildLevel, A, DistA});
+						Stack.Add({ChildLevel, B, DistB});
+					}
+				}
+				else
+				{
+					Stack.Add({ChildLevel, A, DistA});
+				}
+			}
+		}
+	};
+}
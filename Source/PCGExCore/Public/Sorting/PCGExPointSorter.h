@@ -90,7 +90,7 @@ namespace PCGExSorting
 	 *
 	 * Usage:
 	 *   auto Cache = Sorter->BuildCache(NumPoints);
-	 *   Order.Sort([&](int32 A, int32 B) { return Cache->Compare(A, B); });
+	 *   Cache->Sort(Order);
 	 */
 	class PCGEXCORE_API FSortCache
 	{
@@ -108,6 +108,13 @@ namespace PCGExSorting
 		int32 NumElements = 0;
 		int32 CachedNumRules = 0;
 
+		/**
+		 * LSD radix sorts the indices, one stable 64-bit key pass set per rule, least significant rule first.
+		 * Returns false, leaving InOutIndices untouched, when a value is NaN or a tolerance rule has two distinct
+		 * values within tolerance of each other -- Compare's pairwise tolerance can't be expressed as a key then.
+		 */
+		bool TryRadixSort(TArray<int32>& InOutIndices) const;
+
 	public:
 		FSortCache() = default;
 
@@ -126,6 +133,16 @@ namespace PCGExSorting
 			return CachedNumRules;
 		}
 
+		/**
+		 * Stable in-place sort of indices into this cache; ties keep their input order.
+		 * Rules whose whole range sits within tolerance are skipped, exactly like Compare would. The remaining rules
+		 * go through a parallel LSD radix sort, one rule at a time. Exact rules always qualify; a tolerance rule only
+		 * does when none of its distinct values are within tolerance of each other (e.g. integer attributes with the
+		 * default tolerance), since that is the only case where Compare's tolerance behaves like equality.
+		 * Otherwise a parallel stable merge sort over Compare is used.
+		 */
+		void Sort(TArray<int32>& InOutIndices) const;
+
 		/** Fast comparison using cached values. No virtual calls. */
 		FORCEINLINE bool Compare(const int32 A, const int32 B) const
 		{
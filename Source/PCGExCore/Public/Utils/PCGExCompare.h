@@ -400,6 +400,49 @@ namespace PCGExCompare
 		}
 	}
 
+	/**
+	 * Span form of Compare for signed arithmetic operands: OutResults[i] = Compare(Method, A[i], B[i], Tolerance).
+	 * The method switch is resolved once, so each case is a flat loop the compiler can vectorize.
+	 */
+	template <typename T>
+	static void CompareSpan(const EPCGExComparison Method, TConstArrayView<T> A, TConstArrayView<T> B, TArrayView<int8> OutResults, const double Tolerance = DBL_COMPARE_TOLERANCE)
+	{
+		static_assert(std::is_arithmetic_v<T> && std::is_signed_v<T>, "CompareSpan only supports signed arithmetic types.");
+		check(A.Num() == OutResults.Num() && B.Num() == OutResults.Num());
+
+		const int32 Num = OutResults.Num();
+		const T* RESTRICT PA = A.GetData();
+		const T* RESTRICT PB = B.GetData();
+		int8* RESTRICT Out = OutResults.GetData();
+
+#define PCGEX_COMPARE_SPAN(_EXPR) for (int32 i = 0; i < Num; i++) { Out[i] = (_EXPR); } break;
+
+		switch (Method)
+		{
+		case EPCGExComparison::StrictlyEqual:
+			PCGEX_COMPARE_SPAN(PA[i] == PB[i])
+		case EPCGExComparison::StrictlyNotEqual:
+			PCGEX_COMPARE_SPAN(PA[i] != PB[i])
+		case EPCGExComparison::EqualOrGreater:
+			PCGEX_COMPARE_SPAN(PA[i] >= PB[i])
+		case EPCGExComparison::EqualOrSmaller:
+			PCGEX_COMPARE_SPAN(PA[i] <= PB[i])
+		case EPCGExComparison::StrictlyGreater:
+			PCGEX_COMPARE_SPAN(PA[i] > PB[i])
+		case EPCGExComparison::StrictlySmaller:
+			PCGEX_COMPARE_SPAN(PA[i] < PB[i])
+		case EPCGExComparison::NearlyEqual:
+			PCGEX_COMPARE_SPAN(FMath::Abs(PA[i] - PB[i]) <= Tolerance)
+		case EPCGExComparison::NearlyNotEqual:
+			PCGEX_COMPARE_SPAN(FMath::Abs(PA[i] - PB[i]) > Tolerance)
+		default:
+			FMemory::Memzero(Out, Num);
+			break;
+		}
+
+#undef PCGEX_COMPARE_SPAN
+	}
+
 	PCGEXCORE_API
 	bool Compare(const EPCGExComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const double B, const double Tolerance = DBL_COMPARE_TOLERANCE);
 
@@ -238,13 +238,29 @@ namespace PCGExWriteEdgeProperties
 		TPCGValueRange<FVector> BoundsMin = bSolidify ? EdgeDataFacade->GetOut()->GetBoundsMinValueRange(false) : TPCGValueRange<FVector>();
 		TPCGValueRange<FVector> BoundsMax = bSolidify ? EdgeDataFacade->GetOut()->GetBoundsMaxValueRange(false) : TPCGValueRange<FVector>();
 
+		// Endpoint blends are collected and run once per scope through the range path
+		TArray<int32> StartIndices;
+		TArray<int32> EndIndices;
+		TArray<int32> EdgeIndices;
+		TArray<double> Weights;
+		StartIndices.SetNumUninitialized(Scope.Count);
+		EndIndices.SetNumUninitialized(Scope.Count);
+		EdgeIndices.SetNumUninitialized(Scope.Count);
+		Weights.SetNumUninitialized(Scope.Count);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			PCGExGraphs::FEdge& Edge = ClusterEdges[Index];
 			const int32 EdgeIndex = Edge.PointIndex;
+			const int32 i = Index - Scope.Start;
 
 			DirectionSettings.SortEndpoints(Cluster.Get(), Edge);
 
+			StartIndices[i] = Edge.Start;
+			EndIndices[i] = Edge.End;
+			EdgeIndices[i] = EdgeIndex;
+			Weights[i] = Settings->EndpointsWeights;
+
 			const PCGExClusters::FNode& StartNode = *Cluster->GetEdgeStart(Edge);
 			const PCGExClusters::FNode& EndNode = *Cluster->GetEdgeEnd(Edge);
 
@@ -319,18 +335,15 @@ TargetBoundsMax._AXIS = (2.0 * Slide * Rad) * InvScale._AXIS;\
 				BoundsMin[EdgeIndex] = TargetBoundsMin;
 				BoundsMax[EdgeIndex] = TargetBoundsMax;
 
-				DataBlender->Blend(Edge.Start, Edge.End, EdgeIndex, BlendWeightEnd);
+				Weights[i] = BlendWeightEnd;
 			}
 			else if (Settings->bWriteEdgePosition)
 			{
 				Transforms[EdgeIndex].SetLocation(FMath::Lerp(A, B, Settings->EdgePositionLerp));
-				DataBlender->Blend(Edge.Start, Edge.End, EdgeIndex, Settings->EndpointsWeights);
-			}
-			else
-			{
-				DataBlender->Blend(Edge.Start, Edge.End, EdgeIndex, Settings->EndpointsWeights);
 			}
 		}
+
+		DataBlender->BlendRange(StartIndices, EndIndices, EdgeIndices, Weights);
 	}
 
 	void FProcessor::CompleteWork()
@@ -12,6 +12,7 @@
 #include "Core/PCGExPointFilter.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
+#include "Helpers/PCGHelpers.h"
 #include "Utils/PCGExScoredQueue.h"
 
 #define LOCTEXT_NAMESPACE "PCGExClusterCentralityElement"
@@ -151,6 +152,13 @@ bool FPCGExClusterCentralityElement::AdvanceWork(FPCGExContext* InContext, const
 
 namespace PCGExClusterCentrality
 {
+	void FSampleAccumulator::Init(const int32 NumNodes, const bool bWithSquares, const bool bWithCounts)
+	{
+		Sum.Init(0.0, NumNodes);
+		if (bWithSquares) { Squares.Init(0.0, NumNodes); }
+		if (bWithCounts) { Counts.Init(0.0, NumNodes); }
+	}
+
 	FProcessor::~FProcessor()
 	{
 	}
@@ -165,14 +173,14 @@ namespace PCGExClusterCentrality
 		}
 
 		CentralityScores.Init(0.0, NumNodes);
+		Adjacency = Cluster->GetFlatAdjacency();
 
 		// Degree centrality: compute directly, no Dijkstra needed
 		if (Settings->CentralityType == EPCGExCentralityType::Degree)
 		{
-			const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
 			for (int32 i = 0; i < NumNodes; i++)
 			{
-				CentralityScores[i] = static_cast<double>(Nodes[i].Links.Num());
+				CentralityScores[i] = static_cast<double>(Adjacency->Num(i));
 			}
 			WriteResults();
 			return true;
@@ -201,6 +209,18 @@ namespace PCGExClusterCentrality
 			{
 				Settings->RandomDownsampling.GetPicks(Context, VtxDataFacade->GetIn(), NumNodes, RandomSamples);
 			}
+			else if (Settings->DownsamplingMode == EPCGExCentralityDownsampling::Adaptive)
+			{
+				// Every node, in random order; rounds consume it front to back
+				bAdaptive = true;
+				PCGExArrayHelpers::ArrayOfIndices(RandomSamples, NumNodes);
+
+				FRandomStream Random = PCGHelpers::GetRandomStreamFromSeed(PCGHelpers::ComputeSeed(Settings->ApproximationSeed), Context->GetInputSettings<UPCGSettings>(), Context->ExecutionSource.Get());
+				for (int32 i = NumNodes - 1; i > 0; --i)
+				{
+					RandomSamples.Swap(i, Random.RandRange(0, i));
+				}
+			}
 			else
 			{
 				PCGExArrayHelpers::ArrayOfIndices(RandomSamples, NumNodes);
@@ -284,20 +304,193 @@ namespace PCGExClusterCentrality
 			RandomSamples.Add(0);
 		}
 
-		StartParallelLoopForRange(bDownsample ? RandomSamples.Num() : NumNodes, 128);
+		// Resolve each link's directed cost once, so per-source searches read costs linearly
+		// alongside the packed links instead of fetching the edge to find its orientation.
+		LinkCosts.SetNumUninitialized(Adjacency->Links.Num());
+		PCGExMT::ParallelOrSequential(
+			NumNodes,
+			[&](const int32 i)
+			{
+				const int32 PointIndex = Cluster->GetNodePointIndex(i);
+				const int32 Start = Adjacency->Offsets[i];
+				const int32 End = Adjacency->Offsets[i + 1];
+				for (int32 l = Start; l < End; l++)
+				{
+					const int32 EdgeIndex = Adjacency->Links[l].Edge;
+					LinkCosts[l] = Cluster->GetEdge(EdgeIndex)->Start == static_cast<uint32>(PointIndex) ? DirectedEdgeScores[EdgeIndex] : DirectedEdgeScores[NumEdges + EdgeIndex];
+				}
+			});
+
+		if (Settings->bUnweightedFastPath && !LinkCosts.IsEmpty() && LinkCosts[0] > 0)
+		{
+			UniformCost = LinkCosts[0];
+			bUniformCosts = true;
+			for (const double Cost : LinkCosts)
+			{
+				if (!FMath::IsNearlyEqual(Cost, UniformCost))
+				{
+					bUniformCosts = false;
+					break;
+				}
+			}
+		}
+
+		// With equal costs distances are symmetric, so summing them on the reached nodes is the same as summing them on the source.
+		// Ratio & Filters keep the per-source behavior, as only the sampled nodes get a value there.
+		bBitParallel = bUniformCosts && Settings->CentralityType != EPCGExCentralityType::Betweenness && (bAdaptive || !bDownsample);
+		bAccumulateTargets = bAdaptive || bBitParallel;
+
+		if (bAccumulateTargets && Settings->CentralityType == EPCGExCentralityType::Closeness) { SampleCounts.Init(0.0, NumNodes); }
+
+		if (bAdaptive)
+		{
+			ComputeAdaptive();
+			return;
+		}
+
+		RoundStart = 0;
+		RoundEnd = bDownsample ? RandomSamples.Num() : NumNodes;
+
+		if (bBitParallel)
+		{
+			StartParallelLoopForRange(FMath::DivideAndRoundUp(RoundEnd, 64), 1);
+			return;
+		}
+
+		StartParallelLoopForRange(RoundEnd, 128);
+	}
+
+	int32 FProcessor::GetHopEccentricity(const int32 From) const
+	{
+		TArray<int32> Depth;
+		Depth.Init(-1, NumNodes);
+
+		TArray<int32> Queue;
+		Queue.Reserve(NumNodes);
+
+		Depth[From] = 0;
+		Queue.Add(From);
+
+		int32 MaxDepth = 0;
+		for (int32 Head = 0; Head < Queue.Num(); Head++)
+		{
+			const int32 Current = Queue[Head];
+			const int32 NextDepth = Depth[Current] + 1;
+			for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(Current))
+			{
+				if (Depth[Lk.Node] != -1) { continue; }
+				Depth[Lk.Node] = NextDepth;
+				MaxDepth = NextDepth;
+				Queue.Add(Lk.Node);
+			}
+		}
+
+		return MaxDepth;
+	}
+
+	void FProcessor::ComputeAdaptive()
+	{
+		const double Epsilon = Settings->ApproximationError;
+		const double Delta = 1.0 - Settings->ApproximationConfidence;
+
+		// Worst-case budget from Riondato & Kornaropoulos, using 2 * eccentricity + 1 as the vertex diameter bound.
+		// That bound holds in hops; on weighted clusters it is an estimate. Most clusters meet the error bound well before.
+		const double VertexDiameter = 2.0 * GetHopEccentricity(0) + 1.0;
+		const double Budget = (0.5 / (Epsilon * Epsilon)) * (FMath::FloorToDouble(FMath::Log2(FMath::Max(1.0, VertexDiameter - 2.0))) + 1.0 + FMath::Loge(1.0 / Delta));
+		const int32 MaxSamples = static_cast<int32>(FMath::Clamp(FMath::CeilToDouble(Budget), 1.0, static_cast<double>(NumNodes)));
+
+		SampleSquares.Init(0.0, NumNodes);
+
+		// Empirical Bernstein bound on each node, with a union bound over all of them
+		const double LogTerm = FMath::Loge(3.0 * NumNodes / Delta);
+
+		int32 NumSamples = 0;
+		int32 RoundSize = FMath::Min(MaxSamples, FMath::Max(64, FMath::CeilToInt32(LogTerm / Epsilon)));
+
+		while (NumSamples < MaxSamples)
+		{
+			PCGEX_CHECK_WORK_HANDLE_VOID
+
+			RoundStart = NumSamples;
+			RoundEnd = FMath::Min(MaxSamples, NumSamples + RoundSize);
+
+			if (bBitParallel) { StartParallelLoopForRange(FMath::DivideAndRoundUp(RoundEnd - RoundStart, 64), 1); }
+			else { StartParallelLoopForRange(RoundEnd - RoundStart, 128); }
+
+			NumSamples = RoundEnd;
+
+			if (IsWithinErrorBound(NumSamples, LogTerm)) { break; }
+
+			// Doubling keeps the number of checks logarithmic
+			RoundSize = NumSamples;
+		}
+
+		FinalizeSamples(NumSamples);
+		WriteResults();
+	}
+
+	bool FProcessor::IsWithinErrorBound(const int32 NumSamples, const double LogTerm) const
+	{
+		// For closeness the bound applies to the mean distance, which the score is the inverse of
+		const double InvK = 1.0 / static_cast<double>(NumSamples);
+		const double RangeTerm = 3.0 * SampleRange * LogTerm * InvK;
+
+		double MaxMean = 0;
+		double MaxError = 0;
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const double Mean = CentralityScores[i] * InvK;
+			const double Variance = FMath::Max(0.0, SampleSquares[i] * InvK - Mean * Mean);
+			MaxMean = FMath::Max(MaxMean, Mean);
+			MaxError = FMath::Max(MaxError, FMath::Sqrt(2.0 * Variance * LogTerm * InvK) + RangeTerm);
+		}
+
+		return MaxError <= Settings->ApproximationError * MaxMean;
+	}
+
+	void FProcessor::FinalizeSamples(const int32 NumSamples)
+	{
+		// Each source is a uniform pick among all nodes, so sums scale by NumNodes / NumSamples
+		const double Scale = static_cast<double>(NumNodes) / static_cast<double>(NumSamples);
+
+		switch (Settings->CentralityType)
+		{
+		case EPCGExCentralityType::Betweenness:
+			// Halved for undirected graphs
+			for (double& C : CentralityScores) { C *= Scale * 0.5; }
+			break;
+		case EPCGExCentralityType::Closeness:
+			// Reached / summed distances; the scale cancels out
+			for (int32 i = 0; i < NumNodes; i++) { CentralityScores[i] = CentralityScores[i] > 0 ? SampleCounts[i] / CentralityScores[i] : 0; }
+			break;
+		case EPCGExCentralityType::HarmonicCloseness:
+			for (double& C : CentralityScores) { C *= Scale; }
+			break;
+		default:
+			break;
+		}
 	}
 
 	void FProcessor::PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops)
 	{
-		ScopedCentralityScores = MakeShared<PCGExMT::TScopedArray<double>>(Loops);
+		ScopedSamples = MakeShared<PCGExMT::TScopedPtr<FSampleAccumulator>>(Loops);
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCentrality::ProcessRange);
 
-		TArray<double>& LocalScores = ScopedCentralityScores->Get_Ref(Scope);
-		LocalScores.Init(0.0, NumNodes);
+		FSampleAccumulator& Samples = ScopedSamples->Get_Ref(Scope);
+		Samples.Init(NumNodes, bAdaptive, bAccumulateTargets && Settings->CentralityType == EPCGExCentralityType::Closeness);
+
+		if (bBitParallel)
+		{
+			ProcessRange_BitParallel(Scope, Samples);
+			return;
+		}
+
+		TArray<double>& LocalScores = Samples.Sum;
 
 		TArray<double> Score;
 		Score.Init(DBL_MAX, NumNodes);
@@ -318,11 +511,18 @@ namespace PCGExClusterCentrality
 			TArray<NodePred> Pred;
 			Pred.SetNum(NumNodes);
 
-			if (bDownsample)
+			if (bAdaptive)
+			{
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					ProcessSingleNode_Betweenness(RandomSamples[RoundStart + Index], Samples, Score, Sigma, Delta, Pred, Stack, Queue);
+				}
+			}
+			else if (bDownsample)
 			{
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					ProcessSingleNode_Betweenness(RandomSamples[Index], LocalScores, Score, Sigma, Delta, Pred, Stack, Queue);
+					ProcessSingleNode_Betweenness(RandomSamples[Index], Samples, Score, Sigma, Delta, Pred, Stack, Queue);
 				}
 
 				const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num());
@@ -335,10 +535,17 @@ namespace PCGExClusterCentrality
 			{
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					ProcessSingleNode_Betweenness(Index, LocalScores, Score, Sigma, Delta, Pred, Stack, Queue);
+					ProcessSingleNode_Betweenness(Index, Samples, Score, Sigma, Delta, Pred, Stack, Queue);
 				}
 			}
 		}
+		else if (bAdaptive)
+		{
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				ProcessSingleNode_Distances(RandomSamples[RoundStart + Index], Samples, Score, Stack, Queue);
+			}
+		}
 		else if (Settings->CentralityType == EPCGExCentralityType::Closeness)
 		{
 			if (bDownsample)
@@ -389,45 +596,73 @@ namespace PCGExClusterCentrality
 
 #pragma region ProcessSingleNode_Betweenness
 
-	void FProcessor::ProcessSingleNode_Betweenness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue)
+	void FProcessor::ProcessSingleNode_Betweenness(const int32 Index, FSampleAccumulator& Samples, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue)
 	{
 		Stack.Reset();
 
 		Score[Index] = 0.0;
 		Sigma[Index] = 1.0;
 
-		Queue->Reset();
-		Queue->Enqueue(Index, 0.0);
-
-		int32 CurrentNode;
-		double CurrentScore;
-
-		while (Queue->Dequeue(CurrentNode, CurrentScore))
+		if (bUniformCosts)
 		{
-			Stack.Add(CurrentNode);
-			const PCGExClusters::FNode& Current = *Cluster->GetNode(CurrentNode);
-
-			for (const PCGExGraphs::FLink Lk : Current.Links)
+			// Equal costs : a FIFO visits nodes in distance order, so the stack doubles as the queue.
+			// Distances are counted in hops, dependencies don't depend on the scale.
+			Stack.Add(Index);
+			for (int32 Head = 0; Head < Stack.Num(); Head++)
 			{
-				const int32 Neighbor = Lk.Node;
-				const int32 EdgeIndex = Lk.Edge;
-				const PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(EdgeIndex);
-
-				const double EdgeCost = Edge.Start == Current.PointIndex ? DirectedEdgeScores[EdgeIndex] : DirectedEdgeScores[NumEdges + EdgeIndex];
-				const double NewDist = Score[CurrentNode] + EdgeCost;
+				const int32 CurrentNode = Stack[Head];
+				const double NewDist = Score[CurrentNode] + 1.0;
+				const int32 LinksEnd = Adjacency->Offsets[CurrentNode + 1];
 
-				if (NewDist < Score[Neighbor])
+				for (int32 l = Adjacency->Offsets[CurrentNode]; l < LinksEnd; l++)
 				{
-					Score[Neighbor] = NewDist;
-					Queue->Enqueue(Neighbor, NewDist);
-					Pred[Neighbor].Reset();
-					Pred[Neighbor].Add(CurrentNode);
-					Sigma[Neighbor] = Sigma[CurrentNode];
+					const int32 Neighbor = Adjacency->Links[l].Node;
+
+					if (Score[Neighbor] == DBL_MAX)
+					{
+						Score[Neighbor] = NewDist;
+						Stack.Add(Neighbor);
+					}
+
+					if (Score[Neighbor] == NewDist)
+					{
+						Pred[Neighbor].Add(CurrentNode);
+						Sigma[Neighbor] += Sigma[CurrentNode];
+					}
 				}
-				else if (FMath::IsNearlyEqual(NewDist, Score[Neighbor]))
+			}
+		}
+		else
+		{
+			Queue->Reset();
+			Queue->Enqueue(Index, 0.0);
+
+			int32 CurrentNode;
+			double CurrentScore;
+
+			while (Queue->Dequeue(CurrentNode, CurrentScore))
+			{
+				Stack.Add(CurrentNode);
+				const int32 LinksEnd = Adjacency->Offsets[CurrentNode + 1];
+
+				for (int32 l = Adjacency->Offsets[CurrentNode]; l < LinksEnd; l++)
 				{
-					Pred[Neighbor].Add(CurrentNode);
-					Sigma[Neighbor] += Sigma[CurrentNode];
+					const int32 Neighbor = Adjacency->Links[l].Node;
+					const double NewDist = Score[CurrentNode] + LinkCosts[l];
+
+					if (NewDist < Score[Neighbor])
+					{
+						Score[Neighbor] = NewDist;
+						Queue->Enqueue(Neighbor, NewDist);
+						Pred[Neighbor].Reset();
+						Pred[Neighbor].Add(CurrentNode);
+						Sigma[Neighbor] = Sigma[CurrentNode];
+					}
+					else if (FMath::IsNearlyEqual(NewDist, Score[Neighbor]))
+					{
+						Pred[Neighbor].Add(CurrentNode);
+						Sigma[Neighbor] += Sigma[CurrentNode];
+					}
 				}
 			}
 		}
@@ -442,7 +677,7 @@ namespace PCGExClusterCentrality
 			}
 			if (W != Index)
 			{
-				LocalScores[W] += Delta[W];
+				Samples.Add(W, Delta[W]);
 			}
 		}
 
@@ -475,16 +710,12 @@ namespace PCGExClusterCentrality
 		while (Queue->Dequeue(CurrentNode, CurrentScore))
 		{
 			Stack.Add(CurrentNode);
-			const PCGExClusters::FNode& Current = *Cluster->GetNode(CurrentNode);
+			const int32 LinksEnd = Adjacency->Offsets[CurrentNode + 1];
 
-			for (const PCGExGraphs::FLink Lk : Current.Links)
+			for (int32 l = Adjacency->Offsets[CurrentNode]; l < LinksEnd; l++)
 			{
-				const int32 Neighbor = Lk.Node;
-				const int32 EdgeIndex = Lk.Edge;
-				const PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(EdgeIndex);
-
-				const double EdgeCost = Edge.Start == Current.PointIndex ? DirectedEdgeScores[EdgeIndex] : DirectedEdgeScores[NumEdges + EdgeIndex];
-				const double NewDist = Score[CurrentNode] + EdgeCost;
+				const int32 Neighbor = Adjacency->Links[l].Node;
+				const double NewDist = Score[CurrentNode] + LinkCosts[l];
 
 				if (NewDist < Score[Neighbor])
 				{
@@ -537,16 +768,12 @@ namespace PCGExClusterCentrality
 		while (Queue->Dequeue(CurrentNode, CurrentScore))
 		{
 			Stack.Add(CurrentNode);
-			const PCGExClusters::FNode& Current = *Cluster->GetNode(CurrentNode);
+			const int32 LinksEnd = Adjacency->Offsets[CurrentNode + 1];
 
-			for (const PCGExGraphs::FLink Lk : Current.Links)
+			for (int32 l = Adjacency->Offsets[CurrentNode]; l < LinksEnd; l++)
 			{
-				const int32 Neighbor = Lk.Node;
-				const int32 EdgeIndex = Lk.Edge;
-				const PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(EdgeIndex);
-
-				const double EdgeCost = Edge.Start == Current.PointIndex ? DirectedEdgeScores[EdgeIndex] : DirectedEdgeScores[NumEdges + EdgeIndex];
-				const double NewDist = Score[CurrentNode] + EdgeCost;
+				const int32 Neighbor = Adjacency->Links[l].Node;
+				const double NewDist = Score[CurrentNode] + LinkCosts[l];
 
 				if (NewDist < Score[Neighbor])
 				{
@@ -577,11 +804,148 @@ namespace PCGExClusterCentrality
 
 #pragma endregion
 
+#pragma region ProcessSingleNode_Distances
+
+	void FProcessor::ProcessSingleNode_Distances(const int32 Index, FSampleAccumulator& Samples, TArray<double>& Score, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue)
+	{
+		Stack.Reset();
+
+		Score[Index] = 0.0;
+
+		Queue->Reset();
+		Queue->Enqueue(Index, 0.0);
+
+		int32 CurrentNode;
+		double CurrentScore;
+
+		while (Queue->Dequeue(CurrentNode, CurrentScore))
+		{
+			Stack.Add(CurrentNode);
+			const int32 LinksEnd = Adjacency->Offsets[CurrentNode + 1];
+
+			for (int32 l = Adjacency->Offsets[CurrentNode]; l < LinksEnd; l++)
+			{
+				const int32 Neighbor = Adjacency->Links[l].Node;
+				const double NewDist = Score[CurrentNode] + LinkCosts[l];
+
+				if (NewDist < Score[Neighbor])
+				{
+					Score[Neighbor] = NewDist;
+					Queue->Enqueue(Neighbor, NewDist);
+				}
+			}
+		}
+
+		// Accumulate on every reached node: distance for closeness, 1/distance for harmonic closeness
+		const bool bHarmonic = Settings->CentralityType == EPCGExCentralityType::HarmonicCloseness;
+		for (const int32 N : Stack)
+		{
+			if (N != Index && Score[N] > 0)
+			{
+				Samples.Add(N, bHarmonic ? 1.0 / Score[N] : Score[N]);
+			}
+		}
+
+		// Reset only visited nodes
+		for (const int32 N : Stack)
+		{
+			Score[N] = DBL_MAX;
+		}
+	}
+
+#pragma endregion
+
+#pragma region ProcessRange_BitParallel
+
+	void FProcessor::ProcessRange_BitParallel(const PCGExMT::FScope& Scope, FSampleAccumulator& Samples)
+	{
+		// Each range index is a block of up to 64 sources, searched together : bit b of a node's mask
+		// tells whether source b has reached it. One pass over a frontier node advances all of them.
+		TArray<uint64> Visited;
+		Visited.Init(0, NumNodes);
+
+		TArray<uint64> Frontier;
+		Frontier.Init(0, NumNodes);
+
+		TArray<uint64> Next;
+		Next.Init(0, NumNodes);
+
+		TArray<int32> FrontierNodes;
+		TArray<int32> NextNodes;
+		TArray<int32> Touched;
+		Touched.Reserve(NumNodes);
+
+		const bool bHarmonic = Settings->CentralityType == EPCGExCentralityType::HarmonicCloseness;
+
+		PCGEX_SCOPE_LOOP(Block)
+		{
+			const int32 First = RoundStart + Block * 64;
+			const int32 Last = FMath::Min(First + 64, RoundEnd);
+
+			FrontierNodes.Reset();
+			Touched.Reset();
+
+			for (int32 j = First; j < Last; j++)
+			{
+				const int32 Source = bDownsample ? RandomSamples[j] : j;
+				const uint64 Bit = static_cast<uint64>(1) << (j - First);
+				Visited[Source] = Bit;
+				Frontier[Source] = Bit;
+				FrontierNodes.Add(Source);
+				Touched.Add(Source);
+			}
+
+			for (int32 Depth = 1; !FrontierNodes.IsEmpty(); Depth++)
+			{
+				NextNodes.Reset();
+
+				for (const int32 Node : FrontierNodes)
+				{
+					const uint64 Bits = Frontier[Node];
+					Frontier[Node] = 0;
+
+					const int32 LinksEnd = Adjacency->Offsets[Node + 1];
+					for (int32 l = Adjacency->Offsets[Node]; l < LinksEnd; l++)
+					{
+						const int32 Neighbor = Adjacency->Links[l].Node;
+						const uint64 Reached = Bits & ~Visited[Neighbor];
+						if (!Reached) { continue; }
+						if (!Next[Neighbor]) { NextNodes.Add(Neighbor); }
+						Next[Neighbor] |= Reached;
+					}
+				}
+
+				const double Distance = Depth * UniformCost;
+				const double Value = bHarmonic ? 1.0 / Distance : Distance;
+
+				for (const int32 Node : NextNodes)
+				{
+					const uint64 Reached = Next[Node];
+					Next[Node] = 0;
+
+					if (!Visited[Node]) { Touched.Add(Node); }
+					Visited[Node] |= Reached;
+					Frontier[Node] = Reached;
+
+					Samples.Add(Node, Value, FMath::CountBits(Reached));
+				}
+
+				Swap(FrontierNodes, NextNodes);
+			}
+
+			for (const int32 Node : Touched)
+			{
+				Visited[Node] = 0;
+			}
+		}
+	}
+
+#pragma endregion
+
 #pragma region ComputeEigenvector
 
 	void FProcessor::ComputeEigenvector()
 	{
-		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
 		const double InitVal = 1.0 / FMath::Sqrt(static_cast<double>(NumNodes));
 
 		TArray<double> X;
@@ -596,7 +960,7 @@ namespace PCGExClusterCentrality
 			for (int32 i = 0; i < NumNodes; i++)
 			{
 				double Sum = 0;
-				for (const PCGExGraphs::FLink Lk : Nodes[i].Links)
+				for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(i))
 				{
 					Sum += X[Lk.Node];
 				}
@@ -647,7 +1011,6 @@ namespace PCGExClusterCentrality
 
 	void FProcessor::ComputeKatz()
 	{
-		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
 		const double Alpha = Settings->KatzAlpha;
 
 		TArray<double> X;
@@ -662,7 +1025,7 @@ namespace PCGExClusterCentrality
 			for (int32 i = 0; i < NumNodes; i++)
 			{
 				double Sum = 0;
-				for (const PCGExGraphs::FLink Lk : Nodes[i].Links)
+				for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(i))
 				{
 					Sum += X[Lk.Node];
 				}
@@ -696,16 +1059,37 @@ namespace PCGExClusterCentrality
 
 	void FProcessor::OnRangeProcessingComplete()
 	{
-		ScopedCentralityScores->ForEach([&](TArray<double>& ScopedArray)
+		ScopedSamples->ForEach([&](FSampleAccumulator& Samples)
 		{
 			for (int i = 0; i < NumNodes; i++)
 			{
-				CentralityScores[i] += ScopedArray[i];
+				CentralityScores[i] += Samples.Sum[i];
 			}
-			ScopedArray.Empty();
+
+			for (int i = 0; i < Samples.Squares.Num(); i++)
+			{
+				SampleSquares[i] += Samples.Squares[i];
+			}
+
+			for (int i = 0; i < Samples.Counts.Num(); i++)
+			{
+				SampleCounts[i] += Samples.Counts[i];
+			}
+
+			SampleRange = FMath::Max(SampleRange, Samples.Range);
 		});
 
-		ScopedCentralityScores.Reset();
+		ScopedSamples.Reset();
+
+		if (bAccumulateTargets)
+		{
+			// Adaptive rounds are finalized by ComputeAdaptive once the error bound is met
+			if (bAdaptive) { return; }
+
+			FinalizeSamples(RoundEnd - RoundStart);
+			WriteResults();
+			return;
+		}
 
 		// Normalize for undirected graphs (betweenness only)
 		if (Settings->CentralityType == EPCGExCentralityType::Betweenness)
@@ -69,6 +69,7 @@ bool FPCGExFuseClustersElement::Boot(FPCGExContext* InContext) const
 
 	Context->FuseBounds = Context->MainPoints->GetInBounds().ExpandBy(10);
 	Context->bUseOctreeMode = (Context->FuseDetails.GetEffectiveMethod() == EPCGExFuseMethod::Octree);
+	Context->bParallelOctree = Context->FuseDetails.UseParallelOctree();
 
 	Context->NodeBuilder = MakeShared<PCGExData::FUnionTableBuilder>(1);
 	Context->NodeBuilder->bDedupeElementsBySource = true; // node table: collapse shared-vtx duplicates
@@ -104,7 +105,7 @@ bool FPCGExFuseClustersElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 	PCGEX_EXECUTION_CHECK
 	PCGEX_ON_INITIAL_EXECUTION
 	{
-		const bool bUseOctree = Context->bUseOctreeMode;
+		const bool bUseOctree = Context->bUseOctreeMode && !Context->bParallelOctree;
 		if (!Context->StartProcessingClusters(
 			[](const TSharedPtr<PCGExData::FPointIOTaggedEntries>& Entries)
 			{
@@ -112,7 +113,8 @@ bool FPCGExFuseClustersElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 			}, [bUseOctree](const TSharedPtr<PCGExClusterMT::IBatch>& NewBatch)
 			{
 				NewBatch->bSkipCompletion = true;
-				// Octree-fuse mode routes through FUnionRegistry, which is sequential by contract.
+				// Octree-fuse mode routes through FUnionRegistry, which is sequential by contract
+				// (unless fused in parallel, after all processors are done).
 				// Grid mode is fully parallel: each processor builds local records, then the post-batch
 				// step collects and sort-groups them deterministically.
 				NewBatch->bForceSingleThreadedProcessing = bUseOctree;
@@ -159,6 +161,12 @@ bool FPCGExFuseClustersElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 		NodeScope.Reserve(EstNodeRecords);
 		AllStagedEdges.Reserve(EstStagedEdges);
 
+		TArray<PCGExData::FConstPoint> AllNodePoints;
+		if (Context->bParallelOctree)
+		{
+			AllNodePoints.Reserve(EstNodeRecords);
+		}
+
 		for (const TSharedPtr<PCGExClusterMT::IBatch>& Batch : Context->Batches)
 		{
 			const int32 NumProcs = Batch->GetNumProcessors();
@@ -171,6 +179,27 @@ bool FPCGExFuseClustersElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 				}
 				NodeScope.Append(MoveTemp(Proc->NodeRecords));
 				AllStagedEdges.Append(MoveTemp(Proc->StagedEdges));
+				AllNodePoints.Append(MoveTemp(Proc->NodePoints));
+			}
+		}
+
+		// Parallel octree mode: processors emitted placeholder keys; fuse every endpoint at once, in the
+		// same order sequential FindOrInsert would have seen them. Records and staged edges pair up 2:1.
+		if (Context->bParallelOctree)
+		{
+			TArray<int32> RepIndices;
+			Context->NodeRegistry->FuseParallel(AllNodePoints, Context->FuseDetails, RepIndices);
+			AllNodePoints.Empty();
+
+			for (int32 i = 0; i < NodeScope.Num(); i++)
+			{
+				NodeScope[i].Key = static_cast<uint64>(RepIndices[i]);
+			}
+
+			for (int32 i = 0; i < AllStagedEdges.Num(); i++)
+			{
+				AllStagedEdges[i].KeyA = static_cast<uint64>(RepIndices[i * 2]);
+				AllStagedEdges[i].KeyB = static_cast<uint64>(RepIndices[i * 2 + 1]);
 			}
 		}
 
@@ -306,13 +335,25 @@ namespace PCGExFuseClusters
 
 		const FPCGExFuseDetails& FuseDetails = Context->FuseDetails;
 		const bool bUseOctree = Context->bUseOctreeMode;
+		const bool bDeferred = Context->bParallelOctree;
 		const TSharedPtr<PCGExData::FUnionRegistry> Registry = Context->NodeRegistry;
 
+		if (bDeferred)
+		{
+			NodePoints.Reserve(NodeRecords.Max());
+		}
+
 		auto EmitEdge = [&](const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& EdgePt)
 		{
-			uint64 KeyA;
-			uint64 KeyB;
-			if (bUseOctree)
+			uint64 KeyA = 0;
+			uint64 KeyB = 0;
+			if (bDeferred)
+			{
+				// Resolved after all processors, see State_PreparingUnion
+				NodePoints.Add(From);
+				NodePoints.Add(To);
+			}
+			else if (bUseOctree)
 			{
 				// FUnionRegistry::FindOrInsert is sequential by contract; safe because the cluster
 				// batch runs single-threaded in octree mode.
@@ -69,6 +69,7 @@ bool FPCGExPathToClustersElement::Boot(FPCGExContext* InContext) const
 
 		Context->FuseBounds = Context->MainPoints->GetInBounds().ExpandBy(10);
 		Context->bUseOctreeMode = (Context->FuseDetails.GetEffectiveMethod() == EPCGExFuseMethod::Octree);
+		Context->bParallelOctree = Context->FuseDetails.UseParallelOctree();
 
 		Context->NodeBuilder = MakeShared<PCGExData::FUnionTableBuilder>(1);
 		Context->NodeBuilder->bDedupeElementsBySource = true; // node table: collapse shared-point duplicates
@@ -108,7 +109,7 @@ bool FPCGExPathToClustersElement::AdvanceWork(FPCGExContext* InContext, const UP
 	{
 		if (Settings->bFusePaths)
 		{
-			const bool bUseOctree = Context->bUseOctreeMode;
+			const bool bUseOctree = Context->bUseOctreeMode && !Context->bParallelOctree;
 			PCGEX_ON_INVALILD_INPUTS(FTEXT("Some input have less than 2 points and will be ignored."))
 			if (!Context->StartBatchProcessingPoints(
 				[&](const TSharedPtr<PCGExData::FPointIO>& Entry)
@@ -188,6 +189,12 @@ bool FPCGExPathToClustersElement::AdvanceWork(FPCGExContext* InContext, const UP
 			NodeScope.Reserve(EstNodeRecords);
 			AllStagedEdges.Reserve(EstStagedEdges);
 
+			TArray<PCGExData::FConstPoint> AllNodePoints;
+			if (Context->bParallelOctree)
+			{
+				AllNodePoints.Reserve(EstNodeRecords);
+			}
+
 			for (int32 Pi = 0; Pi < NumProcs; Pi++)
 			{
 				const TSharedPtr<FFusingProcessor> P = MainBatch->GetProcessor<FFusingProcessor>(Pi);
@@ -198,6 +205,27 @@ bool FPCGExPathToClustersElement::AdvanceWork(FPCGExContext* InContext, const UP
 				Context->PathsFacades.Add(P->PointDataFacade);
 				NodeScope.Append(MoveTemp(P->NodeRecords));
 				AllStagedEdges.Append(MoveTemp(P->StagedEdges));
+				AllNodePoints.Append(MoveTemp(P->NodePoints));
+			}
+
+			// Parallel octree mode: processors emitted placeholder keys; fuse every endpoint at once, in the
+			// same order sequential FindOrInsert would have seen them. Records and staged edges pair up 2:1.
+			if (Context->bParallelOctree)
+			{
+				TArray<int32> RepIndices;
+				Context->NodeRegistry->FuseParallel(AllNodePoints, Context->FuseDetails, RepIndices);
+				AllNodePoints.Empty();
+
+				for (int32 i = 0; i < NodeScope.Num(); i++)
+				{
+					NodeScope[i].Key = static_cast<uint64>(RepIndices[i]);
+				}
+
+				for (int32 i = 0; i < AllStagedEdges.Num(); i++)
+				{
+					AllStagedEdges[i].KeyA = static_cast<uint64>(RepIndices[i * 2]);
+					AllStagedEdges[i].KeyB = static_cast<uint64>(RepIndices[i * 2 + 1]);
+				}
 			}
 
 			Context->MainBatch.Reset();
@@ -390,10 +418,22 @@ namespace PCGExPathToClusters
 
 		const FPCGExFuseDetails& FuseDetails = Context->FuseDetails;
 		const bool bUseOctree = Context->bUseOctreeMode;
+		const bool bDeferred = Context->bParallelOctree;
 		const TSharedPtr<PCGExData::FUnionRegistry> Registry = Context->NodeRegistry;
 
+		if (bDeferred)
+		{
+			NodePoints.Reserve(NodeRecords.Max());
+		}
+
 		auto KeyOf = [&](const PCGExData::FConstPoint& Pt) -> uint64
 		{
+			if (bDeferred)
+			{
+				// Resolved after all processors, see State_PreparingUnion
+				NodePoints.Add(Pt);
+				return 0;
+			}
 			if (bUseOctree)
 			{
 				return static_cast<uint64>(Registry->FindOrInsert(Pt, FuseDetails));
@@ -20,7 +20,12 @@ class UPCGExSearchInstancedFactory;
 namespace PCGExMT
 {
 	template <typename T>
-	class TScopedArray;
+	class TScopedPtr;
+}
+
+namespace PCGExClusters
+{
+	class FFlatAdjacency;
 }
 
 UENUM()
@@ -37,9 +42,10 @@ enum class EPCGExCentralityType : uint8
 UENUM()
 enum class EPCGExCentralityDownsampling : uint8
 {
-	None    = 0 UMETA(DisplayName = "None", ToolTip="All connected filters must pass."),
-	Ratio   = 1 UMETA(DisplayName = "Random ratio", ToolTip="Sample using a random subset of the nodes."),
-	Filters = 2 UMETA(DisplayName = "Filters", ToolTip="Use filters to drive which nodes are added to the subset")
+	None     = 0 UMETA(DisplayName = "None", ToolTip="All connected filters must pass."),
+	Ratio    = 1 UMETA(DisplayName = "Random ratio", ToolTip="Sample using a random subset of the nodes."),
+	Filters  = 2 UMETA(DisplayName = "Filters", ToolTip="Use filters to drive which nodes are added to the subset"),
+	Adaptive = 3 UMETA(DisplayName = "Adaptive", ToolTip="Add random nodes to the subset until every estimate is within the error bound, at the requested confidence.")
 };
 
 /**
@@ -133,6 +139,22 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Ratio", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Ratio", EditConditionHides))
 	FPCGExRandomRatioDetails RandomDownsampling;
 
+	/** Maximum error of the estimate, relative to the highest score of the cluster. Sampling stops as soon as every node is within that bound. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" ├─ Error", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Adaptive", EditConditionHides, ClampMin=0.001, ClampMax=1))
+	double ApproximationError = 0.05;
+
+	/** Probability that every node ends up within the error bound. Higher values require more samples. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" ├─ Confidence", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Adaptive", EditConditionHides, ClampMin=0.5, ClampMax=0.999))
+	double ApproximationConfidence = 0.9;
+
+	/** Seed used to order the sampled nodes. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Seed", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Adaptive", EditConditionHides))
+	int32 ApproximationSeed = 42;
+
+	/** When every edge has the same cost, use breadth-first searches instead of Dijkstra. Closeness types then process 64 sources at once. Results are unchanged. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="CentralityType == EPCGExCentralityType::Betweenness || CentralityType == EPCGExCentralityType::Closeness || CentralityType == EPCGExCentralityType::HarmonicCloseness", EditConditionHides), AdvancedDisplay)
+	bool bUnweightedFastPath = true;
+
 	bool IsPathBased() const
 	{
 		return CentralityType == EPCGExCentralityType::Betweenness ||
@@ -164,6 +186,31 @@ namespace PCGExClusterCentrality
 {
 	using NodePred = TArray<int32, TInlineAllocator<4>>;
 
+	/** Per-node sums of the values contributed by each source. Squares and Counts are only allocated when needed. */
+	struct FSampleAccumulator
+	{
+		TArray<double> Sum;
+		TArray<double> Squares;
+		TArray<double> Counts;
+		double Range = 0;
+
+		void Init(const int32 NumNodes, const bool bWithSquares, const bool bWithCounts);
+
+		FORCEINLINE void Add(const int32 Node, const double Value, const double Count = 1)
+		{
+			Sum[Node] += Value * Count;
+			if (!Squares.IsEmpty())
+			{
+				Squares[Node] += Value * Value * Count;
+				Range = FMath::Max(Range, Value);
+			}
+			if (!Counts.IsEmpty())
+			{
+				Counts[Node] += Count;
+			}
+		}
+	};
+
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExClusterCentralityContext, UPCGExClusterCentralitySettings>
 	{
 		friend class FBatch;
@@ -171,14 +218,34 @@ namespace PCGExClusterCentrality
 	protected:
 		bool bDownsample = false;
 
+		// Adaptive sampling and bit-parallel searches accumulate on the reached nodes rather than on the source
+		bool bAdaptive = false;
+		bool bBitParallel = false;
+		bool bAccumulateTargets = false;
+
+		bool bUniformCosts = false;
+		double UniformCost = 1;
+
+		// Range of sources processed by the current loop
+		int32 RoundStart = 0;
+		int32 RoundEnd = 0;
+
 		FRWLock CompletionLock;
 		bool bVtxComplete = true;
 		bool bEdgeComplete = false;
 
 		TArray<int32> RandomSamples;
 		TArray<double> DirectedEdgeScores;
+
+		// Packed adjacency, and the directed edge cost of each of its links (same layout as Adjacency->Links)
+		TSharedPtr<PCGExClusters::FFlatAdjacency> Adjacency;
+		TArray<double> LinkCosts;
 		TArray<double> CentralityScores;
-		TSharedPtr<PCGExMT::TScopedArray<double>> ScopedCentralityScores;
+		TSharedPtr<PCGExMT::TScopedPtr<FSampleAccumulator>> ScopedSamples;
+
+		TArray<double> SampleSquares;
+		TArray<double> SampleCounts;
+		double SampleRange = 0;
 
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
@@ -204,9 +271,16 @@ namespace PCGExClusterCentrality
 
 		void WriteResults();
 
-		void ProcessSingleNode_Betweenness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
+		void ComputeAdaptive();
+		int32 GetHopEccentricity(const int32 From) const;
+		bool IsWithinErrorBound(const int32 NumSamples, const double LogTerm) const;
+		void FinalizeSamples(const int32 NumSamples);
+
+		void ProcessSingleNode_Betweenness(const int32 Index, FSampleAccumulator& Samples, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
 		void ProcessSingleNode_Closeness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
 		void ProcessSingleNode_HarmonicCloseness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
+		void ProcessSingleNode_Distances(const int32 Index, FSampleAccumulator& Samples, TArray<double>& Score, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
+		void ProcessRange_BitParallel(const PCGExMT::FScope& Scope, FSampleAccumulator& Samples);
 
 		void ComputeEigenvector();
 		void ComputeKatz();
@@ -147,6 +147,7 @@ struct FPCGExFuseClustersContext final : FPCGExClustersProcessorContext
 	FPCGExFuseDetails FuseDetails;
 	FBox FuseBounds = FBox(ForceInit);
 	bool bUseOctreeMode = false;
+	bool bParallelOctree = false; // Octree mode fused in one FUnionRegistry::FuseParallel batch after processing
 
 	FPCGExCarryOverDetails VtxCarryOverDetails;
 	FPCGExCarryOverDetails EdgesCarryOverDetails;
@@ -184,6 +185,7 @@ namespace PCGExFuseClusters
 		// post-batch sequential phase so the central builders see input in deterministic order.
 		TArray<PCGExData::FUnionStreamRecord> NodeRecords;
 		TArray<FStagedEdge> StagedEdges;
+		TArray<PCGExData::FConstPoint> NodePoints; // Parallel octree mode only, 1:1 with NodeRecords
 
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -143,6 +143,7 @@ struct FPCGExPathToClustersContext final : FPCGExPathProcessorContext
 	FPCGExFuseDetails FuseDetails;
 	FBox FuseBounds = FBox(ForceInit);
 	bool bUseOctreeMode = false;
+	bool bParallelOctree = false; // Octree mode fused in one FUnionRegistry::FuseParallel batch after processing
 
 	TSharedPtr<PCGExGraphs::FUnionProcessor> UnionProcessor;
 
@@ -199,6 +200,7 @@ namespace PCGExPathToClusters
 		// Per-processor buffers populated during Process(), drained serially in the post-batch step.
 		TArray<PCGExData::FUnionStreamRecord> NodeRecords;
 		TArray<FStagedEdge> StagedEdges;
+		TArray<PCGExData::FConstPoint> NodePoints; // Parallel octree mode only, 1:1 with NodeRecords
 
 		explicit FFusingProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
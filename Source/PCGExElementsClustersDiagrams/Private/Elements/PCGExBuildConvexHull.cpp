@@ -114,7 +114,7 @@ namespace PCGExBuildConvexHull
 		ActivePositions.Empty();
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-		Edges = Delaunay->DelaunayEdges.Array();
+		Edges = Delaunay->DelaunayEdges;
 
 		GraphBuilder = MakeShared<PCGExGraphs::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 		StartParallelLoopForRange(Edges.Num());
@@ -12,7 +12,6 @@
 #include "Data/PCGExData.h"
 #include "Details/PCGExInfluenceDetails.h"
 #include "Helpers/PCGExMetaHelpers.h"
-#include "Types/PCGExTypeOpsRotation.h"
 
 #define LOCTEXT_NAMESPACE "PCGExRelaxClusters"
 #define PCGEX_NAMESPACE RelaxClusters
@@ -143,21 +142,20 @@ namespace PCGExRelaxClusters
 		RelaxOperation->SecondaryDataFacade = EdgeDataFacade;
 
 
-		PrimaryBuffer = MakeShared<TArray<FTransform>>();
-		SecondaryBuffer = MakeShared<TArray<FTransform>>();
+		PrimaryBuffer = MakeShared<FPositionBuffer>();
+		SecondaryBuffer = MakeShared<FPositionBuffer>();
 
-		PrimaryBuffer->Init(FTransform::Identity, NumNodes);
-		SecondaryBuffer->Init(FTransform::Identity, NumNodes);
+		PrimaryBuffer->Init(NumNodes);
+		SecondaryBuffer->Init(NumNodes);
 
-		TArray<FTransform>& PBufferRef = (*PrimaryBuffer);
-		TArray<FTransform>& SBufferRef = (*SecondaryBuffer);
-
-		TArray<PCGExClusters::FNode> NodesRef = *Cluster->Nodes.Get();
+		const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes.Get();
 		TConstPCGValueRange<FTransform> InTransforms = VtxDataFacade->GetIn()->GetConstTransformValueRange();
 
 		for (int i = 0; i < NumNodes; i++)
 		{
-			PBufferRef[i] = SBufferRef[i] = InTransforms[NodesRef[i].PointIndex];
+			const FVector Position = InTransforms[NodesRef[i].PointIndex].GetLocation();
+			PrimaryBuffer->Set(i, Position);
+			SecondaryBuffer->Set(i, Position);
 		}
 
 		RelaxOperation->ReadBuffer = PrimaryBuffer.Get();
@@ -170,6 +168,9 @@ namespace PCGExRelaxClusters
 
 		Iterations = Settings->Iterations;
 
+		bCheckConvergence = Settings->bStopOnConvergence;
+		ConvergenceToleranceSquared = FMath::Square(Settings->ConvergenceTolerance);
+
 		Steps = RelaxOperation->GetNumSteps();
 		CurrentStep = -1;
 
@@ -212,6 +213,14 @@ namespace PCGExRelaxClusters
 
 		if (CurrentStep > Steps)
 		{
+			if (MaxDisplacement && MaxDisplacement->Max() <= ConvergenceToleranceSquared)
+			{
+				// Nothing moved enough during the iteration that just completed; further ones would be no-ops
+				StartParallelLoopForNodes();
+				return;
+			}
+
+			MaxDisplacement.Reset();
 			Iterations--;
 			CurrentStep = 0;
 		}
@@ -220,6 +229,15 @@ namespace PCGExRelaxClusters
 
 		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, IterationGroup)
 
+		if (bCheckConvergence && CurrentStep == Steps - 1 && StepSource == EPCGExClusterElement::Vtx)
+		{
+			IterationGroup->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->MaxDisplacement = MakeShared<PCGExMT::TScopedNumericValue<double>>(Loops, 0);
+			};
+		}
+
 		IterationGroup->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
 		{
 			PCGEX_ASYNC_THIS
@@ -245,15 +263,16 @@ namespace PCGExRelaxClusters
 
 	void FProcessor::RelaxScope(const PCGExMT::FScope& Scope) const
 	{
-		const TArray<FTransform>& RBufferRef = (*RelaxOperation->ReadBuffer);
-		TArray<FTransform>& WBufferRef = (*RelaxOperation->WriteBuffer);
+		const FPositionBuffer& RBufferRef = (*RelaxOperation->ReadBuffer);
+		FPositionBuffer& WBufferRef = (*RelaxOperation->WriteBuffer);
 
-#define PCGEX_RELAX_PROGRESS  WBufferRef[i] = PCGExTypeOps::FTypeOps<FTransform>::Lerp( RBufferRef[i], WBufferRef[i], InfluenceDetails.GetInfluence(Node.PointIndex));
-#define PCGEX_RELAX_FILTER if(!IsNodePassingFilters(Node)){ WBufferRef[i] = RBufferRef[i]; }else
+#define PCGEX_RELAX_PROGRESS  WBufferRef.Set(i, FMath::Lerp(RBufferRef.Get(i), WBufferRef.Get(i), InfluenceDetails.GetInfluence(Node.PointIndex)));
+#define PCGEX_RELAX_FILTER if(!IsNodePassingFilters(Node)){ WBufferRef.Set(i, RBufferRef.Get(i)); }else
 #define PCGEX_RELAX_STEP_NODE(_STEP) if (CurrentStep == _STEP-1){\
 		if(bLastStep){ \
 			if(InfluenceDetails.bProgressiveInfluence){PCGEX_SCOPE_LOOP(i){ PCGExClusters::FNode& Node = *Cluster->GetNode(i); RelaxOperation->Step##_STEP(Node); PCGEX_RELAX_FILTER{ PCGEX_RELAX_PROGRESS }} } \
 			else{ PCGEX_SCOPE_LOOP(i){ PCGExClusters::FNode& Node = *Cluster->GetNode(i); RelaxOperation->Step##_STEP(Node); PCGEX_RELAX_FILTER{} } } \
+			if(MaxDisplacement){ MeasureDisplacement(Scope, RBufferRef, WBufferRef); } \
 		}else{ \
 			PCGEX_SCOPE_LOOP(i){ RelaxOperation->Step##_STEP(*Cluster->GetNode(i)); \
 		}} return; }
@@ -275,10 +294,32 @@ namespace PCGExRelaxClusters
 		}
 
 #undef PCGEX_RELAX_PROGRESS
+#undef PCGEX_RELAX_FILTER
 #undef PCGEX_RELAX_STEP_NODE
 #undef PCGEX_RELAX_STEP_EDGE
 	}
 
+	void FProcessor::MeasureDisplacement(const PCGExMT::FScope& Scope, const FPositionBuffer& InRead, const FPositionBuffer& InWrite) const
+	{
+		const double* RESTRICT RX = InRead.X.GetData();
+		const double* RESTRICT RY = InRead.Y.GetData();
+		const double* RESTRICT RZ = InRead.Z.GetData();
+		const double* RESTRICT WX = InWrite.X.GetData();
+		const double* RESTRICT WY = InWrite.Y.GetData();
+		const double* RESTRICT WZ = InWrite.Z.GetData();
+
+		double Max = 0;
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const double DX = WX[i] - RX[i];
+			const double DY = WY[i] - RY[i];
+			const double DZ = WZ[i] - RZ[i];
+			Max = FMath::Max(Max, DX * DX + DY * DY + DZ * DZ);
+		}
+
+		MaxDisplacement->Set(Scope, Max);
+	}
+
 	void FProcessor::PrepareLoopScopesForNodes(const TArray<PCGExMT::FScope>& Loops)
 	{
 		TProcessor<FPCGExRelaxClustersContext, UPCGExRelaxClustersSettings>::PrepareLoopScopesForNodes(Loops);
@@ -291,19 +332,20 @@ namespace PCGExRelaxClusters
 
 		TPCGValueRange<FTransform> OutTransforms = VtxDataFacade->GetOut()->GetTransformValueRange(false);
 
-		TArray<FTransform>& WBufferRef = (*RelaxOperation->WriteBuffer);
+		const FPositionBuffer& WBufferRef = (*RelaxOperation->WriteBuffer);
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			PCGExClusters::FNode& Node = Nodes[Index];
 
+			// Only positions are relaxed, rotation & scale stay as they were
 			if (!InfluenceDetails.bProgressiveInfluence)
 			{
-				OutTransforms[Node.PointIndex] = PCGExTypeOps::FTypeOps<FTransform>::Lerp(OutTransforms[Node.PointIndex], WBufferRef[Node.Index], InfluenceDetails.GetInfluence(Node.PointIndex));
+				OutTransforms[Node.PointIndex].SetLocation(FMath::Lerp(OutTransforms[Node.PointIndex].GetLocation(), WBufferRef.Get(Node.Index), InfluenceDetails.GetInfluence(Node.PointIndex)));
 			}
 			else
 			{
-				OutTransforms[Node.PointIndex] = WBufferRef[Node.Index];
+				OutTransforms[Node.PointIndex].SetLocation(WBufferRef.Get(Node.Index));
 			}
 
 			const FVector DirectionAndSize = OutTransforms[Node.PointIndex].GetLocation() - Cluster->GetPos(Node.Index);
@@ -13,7 +13,20 @@ bool UPCGExBoxFittingRelax::PrepareForCluster(FPCGExContext* InContext, const TS
 	{
 		return false;
 	}
-	PCGExArrayHelpers::InitArray(BoxBuffer, Cluster->Nodes->Num());
+	const int32 NumNodes = Cluster->Nodes->Num();
+	const UPCGBasePointData* InPointData = PrimaryDataFacade->GetIn();
+	const TConstPCGValueRange<FTransform> InTransforms = InPointData->GetConstTransformValueRange();
+
+	PCGExArrayHelpers::InitArray(BoxBuffer, NumNodes);
+	PCGExArrayHelpers::InitArray(LocalBoxBuffer, NumNodes);
+
+	for (int i = 0; i < NumNodes; i++)
+	{
+		const int32 PointIndex = Cluster->GetNodePointIndex(i);
+		const FTransform& Transform = InTransforms[PointIndex];
+		LocalBoxBuffer[i] = InPointData->GetLocalBounds(PointIndex).ExpandBy(Padding).TransformBy(FTransform(Transform.GetRotation(), FVector::ZeroVector, Transform.GetScale3D()));
+	}
+
 	return true;
 }
 
@@ -23,11 +36,9 @@ EPCGExClusterElement UPCGExBoxFittingRelax::PrepareNextStep(const int32 InStep)
 	if (InStep == 0)
 	{
 		const int32 NumNodes = Cluster->Nodes->Num();
-		const UPCGBasePointData* InPointData = PrimaryDataFacade->GetIn();
-
 		for (int i = 0; i < NumNodes; i++)
 		{
-			BoxBuffer[i] = InPointData->GetLocalBounds(Cluster->GetNodePointIndex(i)).ExpandBy(Padding).TransformBy(*(ReadBuffer->GetData() + i));
+			BoxBuffer[i] = LocalBoxBuffer[i].ShiftBy(ReadBuffer->Get(i));
 		}
 	}
 	return Source;
@@ -35,17 +46,15 @@ EPCGExClusterElement UPCGExBoxFittingRelax::PrepareNextStep(const int32 InStep)
 
 void UPCGExBoxFittingRelax::Step2(const PCGExClusters::FNode& Node)
 {
-	const FTransform& CurrentTr = *(ReadBuffer->GetData() + Node.Index);
 	const FBox CurrentBox = BoxBuffer[Node.Index];
-	const FVector& CurrentPos = CurrentTr.GetLocation();
+	const FVector CurrentPos = ReadBuffer->Get(Node.Index);
 
 	// Apply repulsion forces between all pairs of nodes
 	const int32 NumNodes = Cluster->Nodes->Num();
 	for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < NumNodes; OtherNodeIndex++)
 	{
-		const FTransform& OtherTr = *(ReadBuffer->GetData() + OtherNodeIndex);
 		const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-		const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+		const FVector OtherPos = ReadBuffer->Get(OtherNodeIndex);
 
 		// Transform boxes to world space
 		const FBox OtherBox = BoxBuffer[OtherNodeIndex];
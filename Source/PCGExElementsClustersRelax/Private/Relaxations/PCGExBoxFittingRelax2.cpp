@@ -39,7 +39,7 @@ bool UPCGExBoxFittingRelax2::PrepareForCluster(FPCGExContext* InContext, const T
 
 void UPCGExBoxFittingRelax2::Step2(const PCGExClusters::FNode& Node)
 {
-	const FVector& CurrentPos = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+	const FVector CurrentPos = ReadBuffer->Get(Node.Index);
 	const FVector& CurrentExtents = ExtentsBuffer->Read(Node.PointIndex) + FVector(Padding);
 
 	// Build current node's bounds
@@ -49,7 +49,7 @@ void UPCGExBoxFittingRelax2::Step2(const PCGExClusters::FNode& Node)
 	for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
 	{
 		const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-		const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+		const FVector OtherPos = ReadBuffer->Get(OtherNodeIndex);
 		const FVector& OtherExtents = ExtentsBuffer->Read(OtherNode->PointIndex) + FVector(Padding);
 
 		// Build other node's bounds
@@ -76,8 +76,8 @@ void UPCGExFittingRelaxBase::Step1(const PCGExGraphs::FEdge& Edge)
 	const int32 Start = Cluster->GetEdgeStart(Edge)->Index;
 	const int32 End = Cluster->GetEdgeEnd(Edge)->Index;
 
-	const FVector& StartPos = (ReadBuffer->GetData() + Start)->GetLocation();
-	const FVector& EndPos = (ReadBuffer->GetData() + End)->GetLocation();
+	const FVector StartPos = ReadBuffer->Get(Start);
+	const FVector EndPos = ReadBuffer->Get(End);
 
 	const FVector Delta = EndPos - StartPos;
 	const double CurrentLength = Delta.Size();
@@ -96,8 +96,7 @@ void UPCGExFittingRelaxBase::Step1(const PCGExGraphs::FEdge& Edge)
 void UPCGExFittingRelaxBase::Step3(const PCGExClusters::FNode& Node)
 {
 	// Update positions based on accumulated forces
-	const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
-	(*WriteBuffer)[Node.Index].SetLocation(Position + GetDelta(Node.Index) * TimeStep);
+	WriteBuffer->Set(Node.Index, ReadBuffer->Get(Node.Index) + GetDelta(Node.Index) * TimeStep);
 }
 
 #pragma endregion
@@ -5,6 +5,38 @@
 
 #pragma region UPCGExForceDirectedRelax
 
+namespace PCGExForceDirectedRelax
+{
+	// Same math as CalculateRepulsiveForce, over a contiguous range of the position components so the loop can vectorize
+	FORCEINLINE void AccumulateRepulsion(
+		const double* RESTRICT RX, const double* RESTRICT RY, const double* RESTRICT RZ,
+		const int32 Start, const int32 End,
+		const double PX, const double PY, const double PZ,
+		const double Constant,
+		double& OutX, double& OutY, double& OutZ)
+	{
+		double FX = 0;
+		double FY = 0;
+		double FZ = 0;
+
+		for (int32 i = Start; i < End; i++)
+		{
+			const double DX = RX[i] - PX;
+			const double DY = RY[i] - PY;
+			const double DZ = RZ[i] - PZ;
+			const double Distance = FMath::Max(FMath::Sqrt(DX * DX + DY * DY + DZ * DZ), 1e-5);
+			const double S = Constant / (Distance * Distance * Distance);
+			FX -= DX * S;
+			FY -= DY * S;
+			FZ -= DZ * S;
+		}
+
+		OutX += FX;
+		OutY += FY;
+		OutZ += FZ;
+	}
+}
+
 void UPCGExForceDirectedRelax::CopySettingsFrom(const UPCGExInstancedFactory* Other)
 {
 	Super::CopySettingsFrom(Other);
@@ -17,28 +49,25 @@ void UPCGExForceDirectedRelax::CopySettingsFrom(const UPCGExInstancedFactory* Ot
 
 void UPCGExForceDirectedRelax::Step1(const PCGExClusters::FNode& Node)
 {
-	const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+	const FVector Position = ReadBuffer->Get(Node.Index);
 	FVector Force = FVector::ZeroVector;
 
 	// Attractive forces: only between connected nodes (edges act as springs)
-	for (const PCGExGraphs::FLink& Lk : Node.Links)
+	for (const PCGExGraphs::FLink& Lk : Adjacency->GetLinks(Node.Index))
 	{
-		const FVector OtherPosition = (ReadBuffer->GetData() + Lk.Node)->GetLocation();
-		CalculateAttractiveForce(Force, Position, OtherPosition);
+		CalculateAttractiveForce(Force, Position, ReadBuffer->Get(Lk.Node));
 	}
 
 	// Repulsive forces: between ALL node pairs (electrostatic repulsion)
-	for (int32 OtherNodeIndex = 0; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
-	{
-		if (OtherNodeIndex == Node.Index)
-		{
-			continue;
-		}
-		const FVector OtherPosition = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
-		CalculateRepulsiveForce(Force, Position, OtherPosition);
-	}
+	// Split around the node itself rather than branching inside the loop
+	const double* RX = ReadBuffer->X.GetData();
+	const double* RY = ReadBuffer->Y.GetData();
+	const double* RZ = ReadBuffer->Z.GetData();
+
+	PCGExForceDirectedRelax::AccumulateRepulsion(RX, RY, RZ, 0, Node.Index, Position.X, Position.Y, Position.Z, ElectrostaticConstant, Force.X, Force.Y, Force.Z);
+	PCGExForceDirectedRelax::AccumulateRepulsion(RX, RY, RZ, Node.Index + 1, ReadBuffer->Num(), Position.X, Position.Y, Position.Z, ElectrostaticConstant, Force.X, Force.Y, Force.Z);
 
-	(*WriteBuffer)[Node.Index].SetLocation(Position + Force);
+	WriteBuffer->Set(Node.Index, Position + Force);
 }
 
 void UPCGExForceDirectedRelax::CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const
@@ -7,15 +7,33 @@
 
 void UPCGExLaplacianRelax::Step1(const PCGExClusters::FNode& Node)
 {
-	const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
-	FVector Force = FVector::ZeroVector;
+	const double* RESTRICT RX = ReadBuffer->X.GetData();
+	const double* RESTRICT RY = ReadBuffer->Y.GetData();
+	const double* RESTRICT RZ = ReadBuffer->Z.GetData();
 
-	for (const PCGExGraphs::FLink& Lk : Node.Links)
+	const double PX = RX[Node.Index];
+	const double PY = RY[Node.Index];
+	const double PZ = RZ[Node.Index];
+
+	// Accumulate per component straight off the flat adjacency
+	double FX = 0;
+	double FY = 0;
+	double FZ = 0;
+
+	const PCGExGraphs::FLink* RESTRICT Links = Adjacency->Links.GetData();
+	const int32 Start = Adjacency->Offsets[Node.Index];
+	const int32 End = Adjacency->Offsets[Node.Index + 1];
+
+	for (int32 i = Start; i < End; i++)
 	{
-		Force += (ReadBuffer->GetData() + Lk.Node)->GetLocation() - Position;
+		const int32 Other = Links[i].Node;
+		FX += RX[Other] - PX;
+		FY += RY[Other] - PY;
+		FZ += RZ[Other] - PZ;
 	}
 
-	(*WriteBuffer)[Node.Index].SetLocation(Position + Force / static_cast<double>(Node.Links.Num()));
+	const double InvNum = 1 / static_cast<double>(End - Start);
+	WriteBuffer->Set(Node.Index, FVector(PX + FX * InvNum, PY + FY * InvNum, PZ + FZ * InvNum));
 }
 
 #pragma endregion
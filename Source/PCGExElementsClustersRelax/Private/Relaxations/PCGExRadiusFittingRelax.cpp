@@ -39,7 +39,7 @@ bool UPCGExRadiusFittingRelax::PrepareForCluster(FPCGExContext* InContext, const
 
 void UPCGExRadiusFittingRelax::Step2(const PCGExClusters::FNode& Node)
 {
-	const FVector& CurrentPos = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+	const FVector CurrentPos = ReadBuffer->Get(Node.Index);
 	const double& CurrentRadius = RadiusBuffer->Read(Node.PointIndex);
 
 	// Apply repulsion forces between all pairs of nodes
@@ -47,7 +47,7 @@ void UPCGExRadiusFittingRelax::Step2(const PCGExClusters::FNode& Node)
 	for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
 	{
 		const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-		const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+		const FVector OtherPos = ReadBuffer->Get(OtherNodeIndex);
 
 		FVector Delta = OtherPos - CurrentPos;
 		const double Distance = Delta.Size();
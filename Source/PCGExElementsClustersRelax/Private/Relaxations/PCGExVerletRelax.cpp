@@ -93,13 +93,13 @@ void UPCGExVerletRelax::Step1(const PCGExClusters::FNode& Node)
 	const double F = (1 - FrictionBuffer->Read(Node.PointIndex)) * DampingScale;
 
 	const FVector G = GravityBuffer->Read(Node.PointIndex);
-	const FVector P = (*ReadBuffer)[Node.Index].GetLocation();
+	const FVector P = ReadBuffer->Get(Node.Index);
 
 	// Write buffer is the old position at this point
-	const FVector V = (P - (*WriteBuffer)[Node.Index].GetLocation()) * F;
+	const FVector V = (P - WriteBuffer->Get(Node.Index)) * F;
 
 	// Compute predicted position INCLUDING gravity, so springs can properly counteract it
-	(*WriteBuffer)[Node.Index].SetLocation(P + V + G * (TimeStep * TimeStep));
+	WriteBuffer->Set(Node.Index, P + V + G * (TimeStep * TimeStep));
 }
 
 void UPCGExVerletRelax::Step2(const PCGExGraphs::FEdge& Edge)
@@ -111,8 +111,8 @@ void UPCGExVerletRelax::Step2(const PCGExGraphs::FEdge& Edge)
 	const int32 A = NodeA->Index;
 	const int32 B = NodeB->Index;
 
-	const FVector PA = (*WriteBuffer)[A].GetLocation();
-	const FVector PB = (*WriteBuffer)[B].GetLocation();
+	const FVector PA = WriteBuffer->Get(A);
+	const FVector PB = WriteBuffer->Get(B);
 
 	const double RestLength = *(EdgeLengths->GetData() + Edge.Index) * ScalingBuffer->Read(Edge.PointIndex);
 	const double L = FVector::Dist(PA, PB);
@@ -132,7 +132,7 @@ void UPCGExVerletRelax::Step3(const PCGExClusters::FNode& Node)
 	{
 		return;
 	}
-	(*WriteBuffer)[Node.Index].SetLocation((*WriteBuffer)[Node.Index].GetLocation() + GetDelta(Node.Index));
+	WriteBuffer->Set(Node.Index, WriteBuffer->Get(Node.Index) + GetDelta(Node.Index));
 }
 
 #pragma endregion
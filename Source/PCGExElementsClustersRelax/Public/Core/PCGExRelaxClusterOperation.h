@@ -9,6 +9,44 @@
 #include "Clusters/PCGExCluster.h"
 #include "PCGExRelaxClusterOperation.generated.h"
 
+namespace PCGExRelaxClusters
+{
+	/**
+	 * Node positions, stored as separate X/Y/Z arrays indexed by node index.
+	 * Relaxing only ever moves positions; rotation and scale are carried over from the input points.
+	 */
+	struct FPositionBuffer
+	{
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+
+		void Init(const int32 InNum)
+		{
+			X.SetNumUninitialized(InNum);
+			Y.SetNumUninitialized(InNum);
+			Z.SetNumUninitialized(InNum);
+		}
+
+		FORCEINLINE int32 Num() const
+		{
+			return X.Num();
+		}
+
+		FORCEINLINE FVector Get(const int32 Index) const
+		{
+			return FVector(X.GetData()[Index], Y.GetData()[Index], Z.GetData()[Index]);
+		}
+
+		FORCEINLINE void Set(const int32 Index, const FVector& InPosition)
+		{
+			X.GetData()[Index] = InPosition.X;
+			Y.GetData()[Index] = InPosition.Y;
+			Z.GetData()[Index] = InPosition.Z;
+		}
+	};
+}
+
 /**
  * 
  */
@@ -39,6 +77,7 @@ public:
 	virtual bool PrepareForCluster(FPCGExContext* InContext, const TSharedPtr<PCGExClusters::FCluster>& InCluster)
 	{
 		Cluster = InCluster;
+		Adjacency = Cluster->GetFlatAdjacency();
 		return true;
 	}
 
@@ -91,13 +130,15 @@ public:
 	}
 
 	TSharedPtr<PCGExClusters::FCluster> Cluster;
-	TArray<FTransform>* ReadBuffer = nullptr;
-	TArray<FTransform>* WriteBuffer = nullptr;
+	TSharedPtr<PCGExClusters::FFlatAdjacency> Adjacency;
+	PCGExRelaxClusters::FPositionBuffer* ReadBuffer = nullptr;
+	PCGExRelaxClusters::FPositionBuffer* WriteBuffer = nullptr;
 
 
 	virtual void Cleanup() override
 	{
 		Cluster = nullptr;
+		Adjacency = nullptr;
 		ReadBuffer = nullptr;
 		WriteBuffer = nullptr;
 
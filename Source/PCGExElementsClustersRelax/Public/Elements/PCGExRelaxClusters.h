@@ -17,6 +17,11 @@ MACRO(Amplitude, double, 0)
 
 class UPCGExRelaxClusterOperation;
 
+namespace PCGExRelaxClusters
+{
+	struct FPositionBuffer;
+}
+
 namespace PCGExMT
 {
 	template <typename T>
@@ -58,6 +63,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 10;
 
+	/** If enabled, stops iterating early once no point moves more than the tolerance over a full iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bStopOnConvergence = false;
+
+	/** Largest per-iteration point displacement under which the relaxation is considered converged. Iterations still act as an upper bound. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bStopOnConvergence", ClampMin=0))
+	double ConvergenceTolerance = 0.01;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -131,13 +144,18 @@ namespace PCGExRelaxClusters
 
 		UPCGExRelaxClusterOperation* RelaxOperation = nullptr;
 
-		TSharedPtr<TArray<FTransform>> PrimaryBuffer;
-		TSharedPtr<TArray<FTransform>> SecondaryBuffer;
+		TSharedPtr<PCGExRelaxClusters::FPositionBuffer> PrimaryBuffer;
+		TSharedPtr<PCGExRelaxClusters::FPositionBuffer> SecondaryBuffer;
 
 		FPCGExInfluenceDetails InfluenceDetails;
 
 		TSharedPtr<PCGExMT::TScopedNumericValue<double>> MaxDistanceValue;
 
+		// Squared largest displacement of the last completed iteration, gathered during its final step
+		bool bCheckConvergence = false;
+		double ConvergenceToleranceSquared = 0;
+		TSharedPtr<PCGExMT::TScopedNumericValue<double>> MaxDisplacement;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -152,6 +170,7 @@ namespace PCGExRelaxClusters
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		void StartNextStep();
 		void RelaxScope(const PCGExMT::FScope& Scope) const;
+		void MeasureDisplacement(const PCGExMT::FScope& Scope, const FPositionBuffer& InRead, const FPositionBuffer& InWrite) const;
 		virtual void PrepareLoopScopesForNodes(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessNodes(const PCGExMT::FScope& Scope) override;
 		virtual void OnNodesProcessingComplete() override;
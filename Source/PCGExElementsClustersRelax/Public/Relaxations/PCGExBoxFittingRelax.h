@@ -33,5 +33,6 @@ public:
 	virtual void Step2(const PCGExClusters::FNode& Node) override;
 
 protected:
+	TArray<FBox> LocalBoxBuffer; // Padded bounds under each node's rotation & scale, which relaxing never changes
 	TArray<FBox> BoxBuffer;
 };
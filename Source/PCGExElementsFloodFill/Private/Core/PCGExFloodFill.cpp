@@ -79,6 +79,11 @@ namespace PCGExFloodFill
 		{
 			*(FillControlsHandler->InfluencesCount->GetData() + SeedNode->PointIndex) = 1;
 		}
+		if (FillControlsHandler->HasClaimRounds())
+		{
+			// Round 0 predates any growth round: seeds are never contested past seed picking.
+			FillControlsHandler->ClaimKeys[SeedNode->Index] = FFillControlsHandler::MakeClaimKey(0, Index);
+		}
 		FCandidate& SeedCandidate = Captured.Emplace_GetRef();
 		SeedCandidate.Link = PCGExGraphs::FLink(-1, -1);
 		SeedCandidate.Node = SeedNode;
@@ -97,6 +102,7 @@ namespace PCGExFloodFill
 
 		const PCGExClusters::FNode& FromNode = *From.Node;
 		const FVector FromPosition = Cluster->GetPos(FromNode);
+		const TConstArrayView<PCGExGraphs::FLink> FromLinks = FillControlsHandler->Adjacency->GetLinks(FromNode.Index);
 
 		// Builds a scored candidate for a neighbor, without claiming (marking visited) it.
 		const auto MakeCandidate = [&](PCGExClusters::FNode* OtherNode, const PCGExGraphs::FLink& Lk) -> FCandidate
@@ -124,7 +130,7 @@ namespace PCGExFloodFill
 		if (FanoutLimit == MAX_int32)
 		{
 			// Unlimited: claim every first-seen neighbor up front (rejected ones stay visited -- legacy behavior).
-			for (const PCGExGraphs::FLink& Lk : FromNode.Links)
+			for (const PCGExGraphs::FLink& Lk : FromLinks)
 			{
 				PCGExClusters::FNode* OtherNode = Cluster->GetNode(Lk);
 				const int32 OtherIndex = OtherNode->Index;
@@ -134,7 +140,7 @@ namespace PCGExFloodFill
 				{
 					continue;
 				}
-				Visited[OtherIndex] = true;
+				MarkVisited(OtherIndex);
 
 				FCandidate Candidate = MakeCandidate(OtherNode, Lk);
 				if (FillControlsHandler->IsValidCandidate(this, From, Candidate))
@@ -149,7 +155,7 @@ namespace PCGExFloodFill
 		// Fan-out-limited (Vtx+Reroute): score all valid unvisited neighbors, claim only the best
 		// 'FanoutLimit' by heap priority. Unclaimed ones stay unvisited for other nodes to adopt.
 		TArray<FCandidate, TInlineAllocator<8>> Pending;
-		for (const PCGExGraphs::FLink& Lk : FromNode.Links)
+		for (const PCGExGraphs::FLink& Lk : FromLinks)
 		{
 			PCGExClusters::FNode* OtherNode = Cluster->GetNode(Lk);
 			if (Visited[OtherNode->Index])
@@ -172,7 +178,7 @@ namespace PCGExFloodFill
 
 		for (const FCandidate& Candidate : Pending)
 		{
-			Visited[Candidate.Node->Index] = true;
+			MarkVisited(Candidate.Node->Index);
 			Candidates.HeapPush(Candidate, HeapComparator);
 		}
 	}
@@ -227,6 +233,61 @@ namespace PCGExFloodFill
 		Probe(Captured.Last(), Captured.Num() - 1);
 	}
 
+	void FDiffusion::BeginRound()
+	{
+		// Plain copy: the heap layout must come back bit-identical for ties to pop in the same order on replay.
+		Checkpoint.Candidates = Candidates;
+		Checkpoint.Visited.Reset();
+		Checkpoint.NumCaptured = Captured.Num();
+		Checkpoint.MaxDepth = MaxDepth;
+		Checkpoint.MaxDistance = MaxDistance;
+		Checkpoint.bStopped = bStopped;
+		Checkpoint.bActive = true;
+		bContended = false;
+	}
+
+	void FDiffusion::EndRound()
+	{
+		Checkpoint = FRoundCheckpoint();
+		bContended = false;
+	}
+
+	bool FDiffusion::LostRoundClaims() const
+	{
+		for (int32 i = Checkpoint.NumCaptured; i < Captured.Num(); i++)
+		{
+			if (!FillControlsHandler->OwnsClaim(this, Captured[i].Node->Index))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void FDiffusion::RollbackRound()
+	{
+		for (int32 i = Checkpoint.NumCaptured; i < Captured.Num(); i++)
+		{
+			FillControlsHandler->ReleaseClaim(this, Captured[i].Node->Index);
+		}
+
+		// TravelStack entries written this round are left behind: they are only ever read for captured nodes,
+		// and are overwritten if the node gets captured again.
+		Captured.SetNum(Checkpoint.NumCaptured, EAllowShrinking::No);
+
+		for (const int32 NodeIndex : Checkpoint.Visited)
+		{
+			Visited[NodeIndex] = false;
+		}
+		Checkpoint.Visited.Reset();
+
+		Candidates = Checkpoint.Candidates;
+		MaxDepth = Checkpoint.MaxDepth;
+		MaxDistance = Checkpoint.MaxDistance;
+		bStopped = Checkpoint.bStopped;
+		bContended = false;
+	}
+
 	void FDiffusion::BuildEndpoints()
 	{
 		const int32 NumCaptured = Captured.Num();
@@ -347,6 +408,7 @@ namespace PCGExFloodFill
 		// Use 'Heuristics Scoring' fill control instead for modern approach
 
 		NumDiffusions = Diffusions.Num();
+		Adjacency = Cluster->GetFlatAdjacency();
 
 		SeedIndices = MakeShared<TArray<int32>>();
 		SeedNodeIndices = MakeShared<TArray<int32>>();
@@ -387,7 +449,51 @@ namespace PCGExFloodFill
 		}
 	}
 
-	bool FFillControlsHandler::TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate)
+	void FFillControlsHandler::EnableClaimRounds()
+	{
+		ClaimKeys.Init(MAX_int64, Cluster->Nodes->Num());
+		ClaimRound = 0;
+	}
+
+	bool FFillControlsHandler::TryClaim(FDiffusion* Diffusion, const int32 NodeIndex)
+	{
+		// Atomic min: the lowest (round, diffusion index) key is the capture a one-at-a-time, seed-ordered
+		// growth would have made, regardless of which worker got there first.
+		const int64 Key = MakeClaimKey(ClaimRound, Diffusion->Index);
+		volatile int64* Slot = ClaimKeys.GetData() + NodeIndex;
+
+		int64 Current = FPlatformAtomics::AtomicRead(Slot);
+		while (Key < Current)
+		{
+			const int64 Prev = FPlatformAtomics::InterlockedCompareExchange(Slot, Key, Current);
+			if (Prev == Current)
+			{
+				return true;
+			}
+			Current = Prev;
+		}
+
+		// Held by a lower diffusion index from this same round: that claim is not final yet.
+		if (static_cast<int32>(Current >> 32) == ClaimRound)
+		{
+			Diffusion->bContended = true;
+		}
+
+		return false;
+	}
+
+	bool FFillControlsHandler::OwnsClaim(const FDiffusion* Diffusion, const int32 NodeIndex) const
+	{
+		return FPlatformAtomics::AtomicRead(ClaimKeys.GetData() + NodeIndex) == MakeClaimKey(ClaimRound, Diffusion->Index);
+	}
+
+	void FFillControlsHandler::ReleaseClaim(const FDiffusion* Diffusion, const int32 NodeIndex)
+	{
+		// Only if still ours -- a taken-over claim belongs to its new owner.
+		FPlatformAtomics::InterlockedCompareExchange(ClaimKeys.GetData() + NodeIndex, MAX_int64, MakeClaimKey(ClaimRound, Diffusion->Index));
+	}
+
+	bool FFillControlsHandler::TryCapture(FDiffusion* Diffusion, const FCandidate& Candidate)
 	{
 		for (const TSharedPtr<FPCGExFillControlOperation>& Op : SubOpsCapture)
 		{
@@ -396,9 +502,16 @@ namespace PCGExFloodFill
 				return false;
 			}
 		}
+		if (HasClaimRounds())
+		{
+			if (!TryClaim(Diffusion, Candidate.Node->Index))
+			{
+				return false;
+			}
+		}
 		// When claiming is disabled (no InfluencesCount), the && skips the atomic and capture is never gated on
 		// exclusivity -- multiple diffusions may capture the same node.
-		if (InfluencesCount && FPlatformAtomics::InterlockedCompareExchange((InfluencesCount->GetData() + Candidate.Node->PointIndex), 1, 0) == 1)
+		else if (InfluencesCount && FPlatformAtomics::InterlockedCompareExchange((InfluencesCount->GetData() + Candidate.Node->PointIndex), 1, 0) == 1)
 		{
 			return false;
 		}
@@ -228,6 +228,7 @@ namespace PCGExBFSDepth
 		}
 
 		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes;
+		const TSharedPtr<PCGExClusters::FFlatAdjacency> Adjacency = Cluster->GetFlatAdjacency();
 		const bool bComputeDistance = DistanceData != nullptr;
 		// Seed forwarding needs per-vtx ownership even when the SeedIndex output is off.
 		const bool bTrackSeedOwner = SeedIndexData != nullptr || SeedForwardHandler != nullptr;
@@ -301,12 +302,11 @@ namespace PCGExBFSDepth
 			while (Head < Queue.Num())
 			{
 				const int32 CurrentIdx = Queue[Head++];
-				const PCGExClusters::FNode& Current = Nodes[CurrentIdx];
 				const FVector CurrentPos = Cluster->GetPos(CurrentIdx);
 				const int32 NextDepth = Depths[CurrentIdx] + 1;
 				const double CurrentDist = Distances[CurrentIdx];
 
-				for (const PCGExGraphs::FLink& Lk : Current.Links)
+				for (const PCGExGraphs::FLink& Lk : Adjacency->GetLinks(CurrentIdx))
 				{
 					if (Depths[Lk.Node] != -1)
 					{
@@ -356,10 +356,9 @@ namespace PCGExBFSDepth
 			while (Head < Queue.Num())
 			{
 				const int32 CurrentIdx = Queue[Head++];
-				const PCGExClusters::FNode& Current = Nodes[CurrentIdx];
 				const int32 NextDepth = Depths[CurrentIdx] + 1;
 
-				for (const PCGExGraphs::FLink& Lk : Current.Links)
+				for (const PCGExGraphs::FLink& Lk : Adjacency->GetLinks(CurrentIdx))
 				{
 					if (Depths[Lk.Node] != -1)
 					{
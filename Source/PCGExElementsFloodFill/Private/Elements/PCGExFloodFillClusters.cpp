@@ -193,8 +193,8 @@ namespace PCGExClusterDiffusion
 			return;
 		}
 
-		// Proceed to blending. Claiming (InfluencesCount CAS) guarantees each vtx belongs to at most
-		// one diffusion, so the parallel per-diffusion passes below write disjoint vtx.
+		// Proceed to blending. Claiming (InfluencesCount CAS, or claim rounds) guarantees each vtx belongs
+		// to at most one diffusion, so the parallel per-diffusion passes below write disjoint vtx.
 
 		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, DiffuseDiffusions)
 
@@ -56,6 +56,12 @@ namespace PCGExFloodFill
 		// single diffusion remains (no competitor left to interleave with).
 		bool bGrowthRunToCompletion = false;
 
+		// Claim rounds: parallel growth with claiming runs each round speculatively on worker threads, then
+		// replays the diffusions whose captures were contested until the round matches a one-at-a-time pass.
+		bool bClaimRounds = false;
+		bool bRetryPass = false;
+		TArray<TSharedPtr<FDiffusion>> RetryDiffusions;
+
 		/** Node-specific Process()-time setup, run before diffusion initialization. Return false to abort. */
 		virtual bool OnGrowthSetup() { return true; }
 
@@ -199,6 +205,21 @@ namespace PCGExFloodFill
 				return;
 			}
 
+			// Claiming diffusions stepping in lockstep compete for nodes every round. Capture-notify controls keep
+			// shared per-capture state a round replay cannot undo, so those stay on the single-threaded lockstep.
+			if (this->Settings->Processing == EPCGExFloodFillProcessing::Parallel)
+			{
+				if (FillControlsHandler->bHasCaptureNotify)
+				{
+					this->bForceSingleThreadedProcessRange = true;
+				}
+				else if (FillControlsHandler->InfluencesCount && OngoingDiffusions.Num() > 1)
+				{
+					bClaimRounds = true;
+					FillControlsHandler->EnableClaimRounds();
+				}
+			}
+
 			// Init only touches per-diffusion state (plus each diffusion's unique slot in the shared claim array),
 			// so diffusions initialize concurrently -- allocation & the first probe are the heavy parts.
 			PCGExMT::ParallelOrSequential(
@@ -219,7 +240,11 @@ namespace PCGExFloodFill
 			// Iterative drivers only: growth used to re-enter itself (Grow -> round -> completion -> Grow),
 			// stacking 3+ frames per round -- a stack overflow on large clusters at low fill rates.
 
-			if (this->Settings->Processing != EPCGExFloodFillProcessing::Parallel)
+			// Without claiming or shared capture state, diffusions cannot interact -- lockstep interleaving and
+			// seed ordering buy nothing, so each diffusion runs to completion on its own worker, in either mode.
+			bGrowthRunToCompletion = !FillControlsHandler->InfluencesCount && !FillControlsHandler->bHasCaptureNotify;
+
+			if (!bGrowthRunToCompletion && this->Settings->Processing != EPCGExFloodFillProcessing::Parallel)
 			{
 				// Sequential: exhaust one diffusion at a time, in seed order.
 				for (const TSharedPtr<FDiffusion>& Diffusion : OngoingDiffusions)
@@ -239,9 +264,11 @@ namespace PCGExFloodFill
 				return;
 			}
 
-			// Parallel: without claiming or shared capture state, diffusions cannot interact -- lockstep
-			// interleaving buys nothing, so each diffusion runs to completion in a single pass.
-			bGrowthRunToCompletion = !FillControlsHandler->InfluencesCount && !FillControlsHandler->bHasCaptureNotify;
+			if (bClaimRounds)
+			{
+				GrowClaimRounds();
+				return;
+			}
 
 			while (!OngoingDiffusions.IsEmpty())
 			{
@@ -264,11 +291,93 @@ namespace PCGExFloodFill
 			}
 		}
 
+		void GrowClaimRounds()
+		{
+			// Each round, every ongoing diffusion takes its FillRate steps concurrently, claiming captures with a
+			// (round, diffusion index) key -- the order a one-at-a-time lockstep would have made them in.
+			// A capture taken over by a lower key, or refused over a same-round claim that may yet be rolled back,
+			// invalidates the rest of that diffusion's round. The lowest such diffusion is necessarily right once
+			// replayed (everything below it is final), so each replay settles at least one more diffusion.
+			TArray<int8> Lost;
+
+			while (!OngoingDiffusions.IsEmpty())
+			{
+				if (!this->WorkHandle.IsValid())
+				{
+					return;
+				}
+
+				const int32 NumOngoing = OngoingDiffusions.Num();
+
+				if (NumOngoing == 1)
+				{
+					// Nothing left to contest with. A fresh round keeps every claim already made out of reach.
+					FillControlsHandler->ClaimRound++;
+					OngoingDiffusions[0]->EndRound();
+					bGrowthRunToCompletion = true;
+					this->StartParallelLoopForRange(1, 1);
+					CompactOngoing();
+					continue;
+				}
+
+				FillControlsHandler->ClaimRound++;
+				PCGExMT::ParallelOrSequential(
+					NumOngoing,
+					[&](const int32 i)
+					{
+						OngoingDiffusions[i]->BeginRound();
+					});
+
+				this->StartParallelLoopForRange(NumOngoing);
+
+				while (this->WorkHandle.IsValid())
+				{
+					Lost.SetNumUninitialized(NumOngoing);
+					PCGExMT::ParallelOrSequential(
+						NumOngoing,
+						[&](const int32 i)
+						{
+							Lost[i] = OngoingDiffusions[i]->LostRoundClaims();
+						});
+
+					const int32 FirstLost = Lost.Find(1);
+					if (FirstLost == INDEX_NONE)
+					{
+						break;
+					}
+
+					RetryDiffusions.Reset();
+					for (int32 i = FirstLost; i < NumOngoing; i++)
+					{
+						if (Lost[i] || OngoingDiffusions[i]->bContended)
+						{
+							RetryDiffusions.Add(OngoingDiffusions[i]);
+						}
+					}
+
+					PCGExMT::ParallelOrSequential(
+						RetryDiffusions.Num(),
+						[&](const int32 i)
+						{
+							RetryDiffusions[i]->RollbackRound();
+						});
+
+					bRetryPass = true;
+					this->StartParallelLoopForRange(RetryDiffusions.Num());
+					bRetryPass = false;
+				}
+
+				CompactOngoing();
+			}
+
+			RetryDiffusions.Empty();
+		}
+
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override
 		{
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				const TSharedPtr<FDiffusion> Diffusion = OngoingDiffusions[Index];
+				const TSharedPtr<FDiffusion> Diffusion = bRetryPass ? RetryDiffusions[Index] : OngoingDiffusions[Index];
 
 				const int32 CurrentFillRate = ReadFillRate(Diffusion);
 				if (CurrentFillRate <= 0)
@@ -298,7 +407,15 @@ namespace PCGExFloodFill
 		virtual void OnRangeProcessingComplete() override
 		{
 			// A single growth pass is complete: move stopped diffusions in another castle.
-			// Compaction only -- the Grow() driver loop owns re-entry.
+			// Compaction only -- the Grow() driver loop owns re-entry. Claim rounds compact once the round is settled.
+			if (!bClaimRounds)
+			{
+				CompactOngoing();
+			}
+		}
+
+		void CompactOngoing()
+		{
 			const int32 OngoingNum = OngoingDiffusions.Num();
 
 			int32 WriteIndex = 0;
@@ -307,6 +424,7 @@ namespace PCGExFloodFill
 				const TSharedPtr<FDiffusion> Diff = OngoingDiffusions[i];
 				if (Diff->bStopped)
 				{
+					Diff->EndRound();
 					Diffusions.Add(Diff);
 				}
 				else
@@ -327,6 +445,7 @@ namespace PCGExFloodFill
 			SeedClosestNode.Empty();
 			OngoingDiffusions.Reset();
 			Diffusions.Reset();
+			RetryDiffusions.Reset();
 			FillControlsHandler.Reset();
 		}
 	};
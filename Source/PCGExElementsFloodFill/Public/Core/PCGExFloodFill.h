@@ -58,7 +58,7 @@ enum class EPCGExFloodFillOrder : uint8
 UENUM()
 enum class EPCGExFloodFillProcessing : uint8
 {
-	Parallel = 0 UMETA(DisplayName = "Parallel", ToolTip="Diffuse each vtx once before moving to the next iteration."),
+	Parallel = 0 UMETA(DisplayName = "Parallel", ToolTip="Diffuse each vtx once before moving to the next iteration. Diffusions grow concurrently; contested captures resolve as if they had been processed one after the other, in seed order."),
 	Sequence = 1 UMETA(DisplayName = "Sequential", ToolTip="Diffuse each vtx until it stops before moving to the next one, and so on."),
 };
 
@@ -153,6 +153,11 @@ namespace PCGExData
 	class FPointIOCollection;
 }
 
+namespace PCGExClusters
+{
+	class FFlatAdjacency;
+}
+
 struct FPCGExAttributeToTagDetails;
 
 namespace PCGExFloodFill
@@ -262,9 +267,34 @@ namespace PCGExFloodFill
 
 		TBitArray<> HasChildMask; // Indexed by capture index; built by BuildEndpoints()
 
+		// State at the start of the current claim round, so the round can be replayed (see FFillControlsHandler::ClaimKeys)
+		struct FRoundCheckpoint
+		{
+			TArray<FCandidate> Candidates;
+			TArray<int32> Visited; // Nodes marked visited since the checkpoint
+			int32 NumCaptured = 0;
+			int32 MaxDepth = 0;
+			double MaxDistance = 0;
+			bool bStopped = false;
+			bool bActive = false;
+		};
+
+		FRoundCheckpoint Checkpoint;
+
+		FORCEINLINE void MarkVisited(const int32 NodeIndex)
+		{
+			Visited[NodeIndex] = true;
+			if (Checkpoint.bActive)
+			{
+				Checkpoint.Visited.Add(NodeIndex);
+			}
+		}
+
 	public:
 		int32 Index = -1;
 		bool bStopped = false;
+		// Set when a capture was refused over a claim made during the current round -- that claim may still be rolled back.
+		bool bContended = false;
 		const PCGExClusters::FNode* SeedNode = nullptr;
 		int32 SeedIndex = -1; // Seed point index; set by the owning processor before PrepareForDiffusions
 
@@ -305,6 +335,18 @@ namespace PCGExFloodFill
 		void Grow();
 		void PostGrow();
 
+		/** Checkpoint the diffusion at the start of a claim round. */
+		void BeginRound();
+
+		/** Drop the round checkpoint; captures made so far are final. */
+		void EndRound();
+
+		/** Whether any capture made since BeginRound() was taken over by a higher-priority claim. */
+		bool LostRoundClaims() const;
+
+		/** Release this round's claims and restore the diffusion to its BeginRound() state. */
+		void RollbackRound();
+
 		/** Derive endpoints (leaf captures) from parent links. Call once after growth, before Endpoints/IsEndpoint. */
 		void BuildEndpoints();
 
@@ -349,10 +391,19 @@ namespace PCGExFloodFill
 		TSharedPtr<PCGExData::FFacade> SeedsDataFacade;
 		TWeakPtr<PCGExHeuristics::FHandler> HeuristicsHandler;
 
+		// Packed cluster adjacency, grabbed in PrepareForDiffusions -- diffusions probe neighbors through it.
+		TSharedPtr<PCGExClusters::FFlatAdjacency> Adjacency;
+
 		TArray<TSharedPtr<FPCGExFillControlOperation>> Operations;
 
 		TSharedPtr<TArray<int8>> InfluencesCount;
 
+		// Per node, the packed (round, diffusion index) key of its current claimant; the lowest key wins.
+		// Empty unless the growth driver runs claim rounds (EnableClaimRounds), in which case captures
+		// are claimed here instead of through InfluencesCount.
+		TArray<int64> ClaimKeys;
+		int32 ClaimRound = 0;
+
 		TSharedPtr<TArray<int32>> SeedIndices;
 		TSharedPtr<TArray<int32>> SeedNodeIndices;
 
@@ -373,6 +424,16 @@ namespace PCGExFloodFill
 			return DiffusionConfig;
 		}
 
+		FORCEINLINE bool HasClaimRounds() const
+		{
+			return !ClaimKeys.IsEmpty();
+		}
+
+		static FORCEINLINE int64 MakeClaimKey(const int32 Round, const int32 DiffusionIndex)
+		{
+			return (static_cast<int64>(Round) << 32) | static_cast<uint32>(DiffusionIndex);
+		}
+
 		FFillControlsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExClusters::FCluster>& InCluster, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TSharedPtr<PCGExData::FFacade>& InSeedsDataCache, const TArray<TObjectPtr<const UPCGExFillControlsFactoryData>>& InFactories);
 
 		~FFillControlsHandler();
@@ -381,11 +442,17 @@ namespace PCGExFloodFill
 
 		bool PrepareForDiffusions(const TArray<TSharedPtr<FDiffusion>>& Diffusions, const FPCGExFloodFillFlowDetails& Details);
 
+		// Round-based claiming. Must be enabled before diffusions are initialized.
+		void EnableClaimRounds();
+		bool TryClaim(FDiffusion* Diffusion, const int32 NodeIndex);
+		bool OwnsClaim(const FDiffusion* Diffusion, const int32 NodeIndex) const;
+		void ReleaseClaim(const FDiffusion* Diffusion, const int32 NodeIndex);
+
 		// Scoring phase - called before validation
 		void ScoreCandidate(const FDiffusion* Diffusion, const FCandidate& From, FCandidate& OutCandidate);
 
 		// Validation phase
-		bool TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate);
+		bool TryCapture(FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool IsValidProbe(const FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool IsValidCandidate(const FDiffusion* Diffusion, const FCandidate& From, const FCandidate& Candidate);
 
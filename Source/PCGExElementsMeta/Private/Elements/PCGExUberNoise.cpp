@@ -72,6 +72,11 @@ bool FPCGExUberNoiseElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	if (Settings->bUseLatticeCache)
+	{
+		Context->NoiseGenerator->EnableLatticeCache(Settings->LatticeSpacing);
+	}
+
 	return true;
 }
 
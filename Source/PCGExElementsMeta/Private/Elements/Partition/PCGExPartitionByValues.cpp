@@ -4,6 +4,8 @@
 #include "Elements/Partition/PCGExPartitionByValues.h"
 
 
+#include "Async/ParallelFor.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
@@ -15,6 +17,22 @@
 namespace PCGExPartitionByValuesBase
 {
 	const FName SourceLabel = TEXT("Source");
+
+	namespace PartitionInternal
+	{
+		/** Largest composite key space partitioned through histograms; sparser keys go through a sort. */
+		constexpr uint64 MaxDenseBuckets = 1 << 24;
+
+		constexpr int32 MinChunkSize = 16384;
+
+		int32 GetNumChunks(const int32 InNum, const int32 InNumBuckets)
+		{
+			// Each chunk holds a full histogram; keep their combined size within about twice the point count
+			const int32 MaxByMemory = static_cast<int32>(FMath::Max<int64>(1, static_cast<int64>(InNum) * 2 / FMath::Max(1, InNumBuckets)));
+			const int32 MaxByWork = FMath::Max(1, InNum / MinChunkSize);
+			return FMath::Min3(MaxByMemory, MaxByWork, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() * 2));
+		}
+	}
 }
 
 #if WITH_EDITOR
@@ -215,6 +233,176 @@ namespace PCGExPartitionByValuesBase
 		return false;
 	}
 
+	void FProcessor::ComputeKeyBounds()
+	{
+		const int32 NumPoints = SortedIndices.Num();
+		const int32 NumChunks = PartitionInternal::GetNumChunks(NumPoints, 1);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(NumPoints, NumChunks);
+
+		for (PCGExPartition::FRule& Rule : Rules)
+		{
+			TArray<int64> ChunkMin;
+			TArray<int64> ChunkMax;
+			ChunkMin.Init(MAX_int64, NumChunks);
+			ChunkMax.Init(MIN_int64, NumChunks);
+
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					int64 LocalMin = MAX_int64;
+					int64 LocalMax = MIN_int64;
+					const int32 End = FMath::Min((Chunk + 1) * ChunkSize, NumPoints);
+					for (int32 i = Chunk * ChunkSize; i < End; i++)
+					{
+						LocalMin = FMath::Min(LocalMin, Rule.FilteredValues[i]);
+						LocalMax = FMath::Max(LocalMax, Rule.FilteredValues[i]);
+					}
+					ChunkMin[Chunk] = LocalMin;
+					ChunkMax[Chunk] = LocalMax;
+				}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+			Rule.MinKey = FMath::Min(ChunkMin);
+			Rule.MaxKey = FMath::Max(ChunkMax);
+		}
+	}
+
+	bool FProcessor::BuildDensePartitions()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::BuildDensePartitions);
+
+		const int32 NumPoints = SortedIndices.Num();
+
+		// Mixed-radix composite key, first rule most significant, so ascending cells follow the lexicographic key order
+		TArray<uint64, TInlineAllocator<8>> Strides;
+		Strides.SetNumUninitialized(Rules.Num());
+
+		uint64 NumBuckets = 1;
+		for (int32 r = Rules.Num() - 1; r >= 0; r--)
+		{
+			const uint64 Range = static_cast<uint64>(Rules[r].MaxKey) - static_cast<uint64>(Rules[r].MinKey) + 1;
+			if (Range == 0 || Range > PartitionInternal::MaxDenseBuckets)
+			{
+				return false;
+			}
+
+			Strides[r] = NumBuckets;
+			NumBuckets *= Range;
+			if (NumBuckets > PartitionInternal::MaxDenseBuckets || NumBuckets > static_cast<uint64>(NumPoints))
+			{
+				return false;
+			}
+		}
+
+		const int32 NumCells = static_cast<int32>(NumBuckets);
+
+		TArray<int32> Cells;
+		Cells.SetNumUninitialized(NumPoints);
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			uint64 Cell = 0;
+			for (int32 r = 0; r < Rules.Num(); r++)
+			{
+				Cell += (static_cast<uint64>(Rules[r].FilteredValues[i]) - static_cast<uint64>(Rules[r].MinKey)) * Strides[r];
+			}
+			Cells[i] = static_cast<int32>(Cell);
+		)
+
+		// Per-chunk histograms
+		const int32 NumChunks = PartitionInternal::GetNumChunks(NumPoints, NumCells);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(NumPoints, NumChunks);
+		const EParallelForFlags Flags = NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+		TArray<int32> Offsets;
+		Offsets.SetNumZeroed(NumChunks * NumCells);
+
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				int32* Counts = Offsets.GetData() + Chunk * NumCells;
+				const int32 End = FMath::Min((Chunk + 1) * ChunkSize, NumPoints);
+				for (int32 i = Chunk * ChunkSize; i < End; i++)
+				{
+					Counts[Cells[i]]++;
+				}
+			}, Flags);
+
+		// Cell-major, chunk-minor prefix sum; every non-empty cell is a partition
+		PartitionRanges.Reset();
+
+		int32 Sum = 0;
+		for (int32 Cell = 0; Cell < NumCells; Cell++)
+		{
+			const int32 Start = Sum;
+			for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+			{
+				int32& Slot = Offsets[Chunk * NumCells + Cell];
+				const int32 Count = Slot;
+				Slot = Sum;
+				Sum += Count;
+			}
+
+			if (Sum > Start)
+			{
+				PartitionRanges.Emplace(Start, Sum - Start);
+			}
+		}
+
+		// Chunks scatter in order, so points keep their original order within a partition
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				int32* Cursor = Offsets.GetData() + Chunk * NumCells;
+				const int32 End = FMath::Min((Chunk + 1) * ChunkSize, NumPoints);
+				for (int32 i = Chunk * ChunkSize; i < End; i++)
+				{
+					SortedIndices[Cursor[Cells[i]]++] = i;
+				}
+			}, Flags);
+
+		return true;
+	}
+
+	void FProcessor::BuildSortedPartitions()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::BuildSortedPartitions);
+
+		const int32 NumPoints = SortedIndices.Num();
+
+		// Sort indices by lexicographic comparison of keys across all rules
+		SortedIndices.Sort(
+			[this](const int32 A, const int32 B)
+			{
+				for (const PCGExPartition::FRule& Rule : Rules)
+				{
+					const int64 KeyA = Rule.FilteredValues[A];
+					const int64 KeyB = Rule.FilteredValues[B];
+					if (KeyA != KeyB)
+					{
+						return KeyA < KeyB;
+					}
+				}
+				return A < B; // Stable tiebreaker by original index
+			});
+
+		// Scan for partition boundaries
+		PartitionRanges.Reset();
+		if (NumPoints > 0)
+		{
+			int32 CurrentStart = 0;
+			for (int32 i = 1; i < NumPoints; i++)
+			{
+				if (KeysChanged(SortedIndices[i - 1], SortedIndices[i]))
+				{
+					PartitionRanges.Emplace(CurrentStart, i - CurrentStart);
+					CurrentStart = i;
+				}
+			}
+			// Add last partition
+			PartitionRanges.Emplace(CurrentStart, NumPoints - CurrentStart);
+		}
+	}
+
 	void FProcessor::BuildKeyToPartitionIndexMaps()
 	{
 		// Build per-rule key-to-partition-index maps for rules that need them
@@ -229,12 +417,13 @@ namespace PCGExPartitionByValuesBase
 				continue;
 			}
 
-			// Build key-to-index map for this rule based on sorted order
+			// Keys are constant within a partition, so one representative per range is enough
 			TMap<int64, int32> KeyToIndex;
+			KeyToIndex.Reserve(PartitionRanges.Num());
 			int32 NextIndex = 0;
-			for (const int32 SortedIdx : SortedIndices)
+			for (const PCGExPartition::FPartitionRange& Range : PartitionRanges)
 			{
-				const int64 Key = Rule.FilteredValues[SortedIdx];
+				const int64 Key = Rule.FilteredValues[SortedIndices[Range.Start]];
 				if (!KeyToIndex.Contains(Key))
 				{
 					KeyToIndex.Add(Key, NextIndex++);
@@ -309,39 +498,10 @@ namespace PCGExPartitionByValuesBase
 
 		if (Settings->bSplitOutput)
 		{
-			const int32 NumPoints = SortedIndices.Num();
-
-			// Sort indices by lexicographic comparison of keys across all rules
-			SortedIndices.Sort(
-				[this](const int32 A, const int32 B)
-				{
-					for (const PCGExPartition::FRule& Rule : Rules)
-					{
-						const int64 KeyA = Rule.FilteredValues[A];
-						const int64 KeyB = Rule.FilteredValues[B];
-						if (KeyA != KeyB)
-						{
-							return KeyA < KeyB;
-						}
-					}
-					return A < B; // Stable tiebreaker by original index
-				});
-
-			// Scan for partition boundaries
-			PartitionRanges.Empty();
-			if (NumPoints > 0)
+			ComputeKeyBounds();
+			if (!BuildDensePartitions())
 			{
-				int32 CurrentStart = 0;
-				for (int32 i = 1; i < NumPoints; i++)
-				{
-					if (KeysChanged(SortedIndices[i - 1], SortedIndices[i]))
-					{
-						PartitionRanges.Emplace(CurrentStart, i - CurrentStart);
-						CurrentStart = i;
-					}
-				}
-				// Add last partition
-				PartitionRanges.Emplace(CurrentStart, NumPoints - CurrentStart);
+				BuildSortedPartitions();
 			}
 
 			// Build key-to-partition-index maps for rules that need them
@@ -128,10 +128,7 @@ namespace PCGExSortPoints
 
 		if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 		{
-			Order.Sort([&](const int32 A, const int32 B)
-			{
-				return Cache->Compare(A, B);
-			});
+			Cache->Sort(Order);
 		}
 		else
 		{
@@ -141,11 +138,6 @@ namespace PCGExSortPoints
 			});
 		}
 
-		Order.Sort([&](const int32 A, const int32 B)
-		{
-			return Sorter->Sort(A, B);
-		});
-
 		PointDataFacade->Source->InheritPoints(Order, 0);
 
 		return true;
@@ -95,6 +95,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Mode == EPCGExUberNoiseMode::Mutate", EditConditionHides))
 	FPCGExInputShorthandSelectorDouble SourceValueWeight = FPCGExInputShorthandSelectorDouble(FName("Weight"), 1, false);
 
+	/** Sample noise on a world-space lattice cached across executions, interpolating in between. Unchanged noise stacks resample almost for free; values off the lattice become approximate. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bUseLatticeCache = false;
+
+	/** Distance between cached lattice samples. Smaller is more accurate but uses more memory. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bUseLatticeCache", ClampMin=0.01))
+	double LatticeSpacing = 100;
+
 #if WITH_EDITOR
 	FString GetDisplayName() const;
 #endif
@@ -139,6 +139,10 @@ namespace PCGExPartition
 		TArray<int64> FilteredValues;
 		TMap<int64, int32> KeyToPartitionIndex;
 
+		// Bounds of FilteredValues, once computed
+		int64 MinKey = 0;
+		int64 MaxKey = 0;
+
 		double FilterSize = 1.0;
 		double Upscale = 1.0;
 		double Offset = 0.0;
@@ -148,6 +148,12 @@ namespace PCGExPartitionByValuesBase
 
 	protected:
 		bool KeysChanged(int32 IndexA, int32 IndexB) const;
+		void ComputeKeyBounds();
+
+		/** Histogram partitioning over a dense composite key. Returns false if the key space is too sparse. */
+		bool BuildDensePartitions();
+		void BuildSortedPartitions();
+
 		void BuildKeyToPartitionIndexMaps();
 	};
 }
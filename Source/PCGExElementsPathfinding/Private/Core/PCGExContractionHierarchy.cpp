@@ -0,0 +1,371 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExContractionHierarchy.h"
+
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Core/PCGExMTCommon.h"
+#include "Utils/PCGExScoredQueue.h"
+
+#define LOCTEXT_NAMESPACE "PCGExContractionHierarchy"
+
+namespace PCGExPathfinding
+{
+#pragma region FContractionHierarchyCacheFactory
+
+	FText FContractionHierarchyCacheFactory::GetDisplayName() const
+	{
+		return LOCTEXT("DisplayName", "Contraction Hierarchy");
+	}
+
+	FText FContractionHierarchyCacheFactory::GetTooltip() const
+	{
+		return LOCTEXT("Tooltip", "Shortcut hierarchy over static edge scores, answering repeated shortest-path queries without exploring the whole cluster.");
+	}
+
+	TSharedPtr<PCGExClusters::ICachedClusterData> FContractionHierarchyCacheFactory::Build(const PCGExClusters::FClusterCacheBuildContext& Context) const
+	{
+		// Needs heuristics -- built by search operations through GetOrBuildContractionHierarchy
+		return nullptr;
+	}
+
+#pragma endregion
+
+#pragma region FContractionHierarchy
+
+	namespace ContractionInternal
+	{
+		// Bounds each witness search; an unfound witness only costs an unnecessary shortcut, never correctness.
+		constexpr int32 WitnessSettleLimit = 256;
+
+		class FContractor
+		{
+		public:
+			TArray<FHierarchyArc>& Arcs;
+
+			// Arcs of the remaining graph, by index into Arcs. Entries pointing at contracted nodes are skipped, not removed.
+			TArray<TArray<int32>> Out;
+			TArray<TArray<int32>> In;
+
+			TBitArray<> Contracted;
+			TArray<int32> DeletedNeighbors;
+
+			PCGEx::FScoredQueue WitnessQueue;
+
+			FContractor(TArray<FHierarchyArc>& InArcs, const int32 InNumNodes)
+				: Arcs(InArcs), WitnessQueue(InNumNodes)
+			{
+				Out.SetNum(InNumNodes);
+				In.SetNum(InNumNodes);
+				Contracted.Init(false, InNumNodes);
+				DeletedNeighbors.Init(0, InNumNodes);
+			}
+
+			void AddArc(const int32 ArcIndex)
+			{
+				const FHierarchyArc& Arc = Arcs[ArcIndex];
+				Out[Arc.From].Add(ArcIndex);
+				In[Arc.To].Add(ArcIndex);
+			}
+
+			/** Local Dijkstra from Source that ignores Excluded; distances are left in WitnessQueue.Scores. */
+			void WitnessSearch(const int32 Source, const int32 Excluded, const double MaxCost)
+			{
+				WitnessQueue.Reset();
+				WitnessQueue.Enqueue(Source, 0);
+
+				int32 Settled = 0;
+				int32 CurrentIndex;
+				double CurrentScore;
+				while (WitnessQueue.Dequeue(CurrentIndex, CurrentScore))
+				{
+					if (CurrentScore > MaxCost || ++Settled > WitnessSettleLimit)
+					{
+						break;
+					}
+
+					for (const int32 ArcIndex : Out[CurrentIndex])
+					{
+						const FHierarchyArc& Arc = Arcs[ArcIndex];
+						if (Arc.To == Excluded || Contracted[Arc.To])
+						{
+							continue;
+						}
+
+						WitnessQueue.Enqueue(Arc.To, CurrentScore + Arc.Weight);
+					}
+				}
+			}
+
+			/**
+			 * Finds the shortcuts contracting NodeIndex requires, adding them unless simulating.
+			 * @return Edge difference -- shortcuts added minus arcs removed.
+			 */
+			int32 Contract(const int32 NodeIndex, const bool bSimulate)
+			{
+				int32 NumIn = 0;
+				int32 NumOut = 0;
+				double MaxOut = 0;
+
+				for (const int32 ArcIndex : Out[NodeIndex])
+				{
+					const FHierarchyArc& Arc = Arcs[ArcIndex];
+					if (Contracted[Arc.To])
+					{
+						continue;
+					}
+
+					NumOut++;
+					MaxOut = FMath::Max(MaxOut, Arc.Weight);
+				}
+
+				int32 NumShortcuts = 0;
+
+				// Index loop: adding shortcuts may grow In/Out of neighbors, never of NodeIndex itself.
+				const TArray<int32>& InArcs = In[NodeIndex];
+				for (int32 i = 0; i < InArcs.Num(); i++)
+				{
+					const int32 InArcIndex = InArcs[i];
+					const int32 Source = Arcs[InArcIndex].From;
+					if (Contracted[Source])
+					{
+						continue;
+					}
+
+					NumIn++;
+
+					const double InWeight = Arcs[InArcIndex].Weight;
+					WitnessSearch(Source, NodeIndex, InWeight + MaxOut);
+
+					const TArray<int32>& OutArcs = Out[NodeIndex];
+					for (int32 j = 0; j < OutArcs.Num(); j++)
+					{
+						const int32 OutArcIndex = OutArcs[j];
+						const int32 Target = Arcs[OutArcIndex].To;
+						if (Target == Source || Contracted[Target])
+						{
+							continue;
+						}
+
+						const double ViaCost = InWeight + Arcs[OutArcIndex].Weight;
+						if (WitnessQueue.Scores[Target] <= ViaCost)
+						{
+							continue;
+						}
+
+						NumShortcuts++;
+
+						if (!bSimulate)
+						{
+							AddArc(Arcs.Emplace(Source, Target, ViaCost, -1, InArcIndex, OutArcIndex));
+						}
+					}
+				}
+
+				return NumShortcuts - (NumIn + NumOut);
+			}
+
+			FORCEINLINE int32 GetPriority(const int32 NodeIndex)
+			{
+				return Contract(NodeIndex, true) + DeletedNeighbors[NodeIndex];
+			}
+		};
+	}
+
+	void FContractionHierarchy::UnpackArc(const int32 ArcIndex, TArray<int32>& OutArcs) const
+	{
+		TArray<int32, TInlineAllocator<32>> Stack;
+		Stack.Add(ArcIndex);
+
+		while (!Stack.IsEmpty())
+		{
+			const FHierarchyArc& Arc = Arcs[Stack.Pop(EAllowShrinking::No)];
+			if (Arc.Edge != -1)
+			{
+				OutArcs.Add(&Arc - Arcs.GetData());
+				continue;
+			}
+
+			// ChildA must come out first
+			Stack.Add(Arc.ChildB);
+			Stack.Add(Arc.ChildA);
+		}
+	}
+
+	uint32 FContractionHierarchy::ComputeContextHash(const TArray<double>& InDirectedScores)
+	{
+		const uint32 Hash = HashCombineFast(FCrc::MemCrc32(InDirectedScores.GetData(), InDirectedScores.Num() * sizeof(double)), GetTypeHash(InDirectedScores.Num()));
+		return Hash == 0 ? 1 : Hash;
+	}
+
+	TSharedPtr<FContractionHierarchy> FContractionHierarchy::Build(const PCGExClusters::FCluster* InCluster, const TArray<double>& InDirectedScores)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FContractionHierarchy::Build);
+
+		const TArray<PCGExClusters::FNode>& NodesRef = *InCluster->Nodes;
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *InCluster->Edges;
+		const int32 NumNodes = NodesRef.Num();
+
+		TSharedPtr<FContractionHierarchy> Hierarchy = MakeShared<FContractionHierarchy>();
+		Hierarchy->ContextHash = ComputeContextHash(InDirectedScores);
+
+		TArray<FHierarchyArc>& Arcs = Hierarchy->Arcs;
+		Arcs.Reserve(EdgesRef.Num() * 4);
+
+		ContractionInternal::FContractor Contractor(Arcs, NumNodes);
+
+		// Each undirected edge shows up once in both endpoints' links -- one arc per direction.
+		for (const PCGExClusters::FNode& Node : NodesRef)
+		{
+			for (const PCGExGraphs::FLink Lk : Node.Links)
+			{
+				if (Lk.Node == Node.Index)
+				{
+					continue;
+				}
+
+				const bool bForward = EdgesRef[Lk.Edge].Start == static_cast<uint32>(Node.PointIndex);
+				Contractor.AddArc(Arcs.Emplace(Node.Index, Lk.Node, InDirectedScores[(Lk.Edge << 1) | (bForward ? 0 : 1)], Lk.Edge));
+			}
+		}
+
+		// Lazy-update ordering: a popped node is re-evaluated and pushed back if it's no longer the cheapest.
+		using FPriority = TPair<int32, int32>; // Priority, NodeIndex
+		const auto HeapLess = [](const FPriority& A, const FPriority& B) { return A.Key < B.Key; };
+
+		TArray<FPriority> Heap;
+		Heap.Reserve(NumNodes);
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			Heap.HeapPush(FPriority(Contractor.GetPriority(i), i), HeapLess);
+		}
+
+		TArray<int32>& Rank = Hierarchy->Rank;
+		Rank.Init(-1, NumNodes);
+
+		int32 NextRank = 0;
+		while (!Heap.IsEmpty())
+		{
+			FPriority Top;
+			Heap.HeapPop(Top, HeapLess, EAllowShrinking::No);
+
+			const int32 NodeIndex = Top.Value;
+			const int32 Priority = Contractor.GetPriority(NodeIndex);
+			if (!Heap.IsEmpty() && Priority > Heap[0].Key)
+			{
+				Heap.HeapPush(FPriority(Priority, NodeIndex), HeapLess);
+				continue;
+			}
+
+			Contractor.Contract(NodeIndex, false);
+			Contractor.Contracted[NodeIndex] = true;
+			Rank[NodeIndex] = NextRank++;
+
+			for (const int32 ArcIndex : Contractor.Out[NodeIndex])
+			{
+				Contractor.DeletedNeighbors[Arcs[ArcIndex].To]++;
+			}
+			for (const int32 ArcIndex : Contractor.In[NodeIndex])
+			{
+				Contractor.DeletedNeighbors[Arcs[ArcIndex].From]++;
+			}
+		}
+
+		// Split every arc by rank direction into the two CSR search graphs
+		const int32 NumArcs = Arcs.Num();
+
+		TArray<int32>& UpOffsets = Hierarchy->UpOffsets;
+		TArray<int32>& DownOffsets = Hierarchy->DownOffsets;
+		UpOffsets.Init(0, NumNodes + 1);
+		DownOffsets.Init(0, NumNodes + 1);
+
+		for (const FHierarchyArc& Arc : Arcs)
+		{
+			if (Rank[Arc.From] < Rank[Arc.To])
+			{
+				UpOffsets[Arc.From + 1]++;
+			}
+			else
+			{
+				DownOffsets[Arc.To + 1]++;
+			}
+		}
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			UpOffsets[i + 1] += UpOffsets[i];
+			DownOffsets[i + 1] += DownOffsets[i];
+		}
+
+		Hierarchy->UpArcs.SetNumUninitialized(UpOffsets[NumNodes]);
+		Hierarchy->DownArcs.SetNumUninitialized(DownOffsets[NumNodes]);
+
+		TArray<int32> UpCursors(UpOffsets.GetData(), NumNodes);
+		TArray<int32> DownCursors(DownOffsets.GetData(), NumNodes);
+
+		for (int32 i = 0; i < NumArcs; i++)
+		{
+			const FHierarchyArc& Arc = Arcs[i];
+			if (Rank[Arc.From] < Rank[Arc.To])
+			{
+				Hierarchy->UpArcs[UpCursors[Arc.From]++] = i;
+			}
+			else
+			{
+				Hierarchy->DownArcs[DownCursors[Arc.To]++] = i;
+			}
+		}
+
+		Arcs.Shrink();
+
+		return Hierarchy;
+	}
+
+#pragma endregion
+
+	void BuildDirectedEdgeScores(const PCGExClusters::FCluster* InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics, TArray<double>& OutDirectedScores)
+	{
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *InCluster->Edges;
+		OutDirectedScores.SetNumUninitialized(EdgesRef.Num() * 2);
+
+		PCGExMT::ParallelOrSequential(
+			EdgesRef.Num(),
+			[&](const int32 i)
+			{
+				const PCGExGraphs::FEdge& Edge = EdgesRef[i];
+				const PCGExClusters::FNode& Start = *InCluster->GetEdgeStart(Edge);
+				const PCGExClusters::FNode& End = *InCluster->GetEdgeEnd(Edge);
+
+				// Goal-independent by contract; endpoints stand in for seed/goal.
+				OutDirectedScores[i << 1] = Heuristics->GetEdgeScore(Start, End, Edge, Start, End);
+				OutDirectedScores[(i << 1) | 1] = Heuristics->GetEdgeScore(End, Start, Edge, End, Start);
+			});
+	}
+
+	TSharedPtr<FContractionHierarchy> GetOrBuildContractionHierarchy(PCGExClusters::FCluster* InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics)
+	{
+		if (!InCluster || !Heuristics || !Heuristics->HasGoalIndependentEdgeScores())
+		{
+			return nullptr;
+		}
+
+		TArray<double> DirectedScores;
+		BuildDirectedEdgeScores(InCluster, Heuristics, DirectedScores);
+
+		// Try cache first -- the hash makes sure it was contracted with the same scores
+		const uint32 ContextHash = FContractionHierarchy::ComputeContextHash(DirectedScores);
+		if (TSharedPtr<FContractionHierarchy> Cached = InCluster->GetCachedData<FContractionHierarchy>(FContractionHierarchyCacheFactory::CacheKey, ContextHash))
+		{
+			return Cached;
+		}
+
+		// Cache miss - build and cache
+		TSharedPtr<FContractionHierarchy> Hierarchy = FContractionHierarchy::Build(InCluster, DirectedScores);
+		InCluster->SetCachedData(FContractionHierarchyCacheFactory::CacheKey, Hierarchy);
+
+		return Hierarchy;
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -160,6 +160,16 @@ namespace PCGExPathfinding
 		}
 	}
 
+	void FPathQuery::FindPaths(const TArrayView<const TSharedPtr<FPathQuery>> InQueries, const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler)
+	{
+		SearchOperation->ResolveQueryBatch(InQueries, Allocations, HeuristicsHandler);
+
+		for (const TSharedPtr<FPathQuery>& Query : InQueries)
+		{
+			Query->SetResolution(Query->HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail);
+		}
+	}
+
 	void FPathQuery::AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart, const int32 TruncateEnd) const
 	{
 		const int32 Count = PathNodes.Num() - TruncateEnd;
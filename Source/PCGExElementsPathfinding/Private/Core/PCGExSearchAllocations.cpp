@@ -6,6 +6,7 @@
 #include "PCGExH.h"
 #include "Clusters/PCGExCluster.h"
 #include "Containers/PCGExHashLookup.h"
+#include "Utils/PCGExRadixQueue.h"
 #include "Utils/PCGExScoredQueue.h"
 
 namespace PCGExPathfinding
@@ -16,7 +17,15 @@ namespace PCGExPathfinding
 
 		Visited.Init(false, NumNodes);
 		TravelStack = MakeShared<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-		ScoredQueue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+
+		if (bUseRadixQueue)
+		{
+			RadixQueue = MakeShared<PCGEx::FRadixQueue>(NumNodes);
+		}
+		else
+		{
+			ScoredQueue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+		}
 	}
 
 	void FSearchAllocations::InitGScore(const double InInitValue)
@@ -27,19 +36,39 @@ namespace PCGExPathfinding
 
 	void FSearchAllocations::Reset()
 	{
-		ResetSearchState(ScoredQueue, Visited, GScore, GScoreInit, TravelStack);
+		if (RadixQueue)
+		{
+			ResetSearchState(RadixQueue, Visited, GScore, GScoreInit, TravelStack);
+		}
+		else
+		{
+			ResetSearchState(ScoredQueue, Visited, GScore, GScoreInit, TravelStack);
+		}
 	}
 
 	void FSearchAllocations::ResetSearchState(const TSharedPtr<PCGEx::FScoredQueue>& InQueue, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const
 	{
-		const TArray<int32>& Touched = InQueue->GetTouched();
+		ResetNodeState(InQueue->GetTouched(), InVisited, InGScore, InGScoreInit, InTravelStack);
+
+		// Last: Reset() consumes the touched list.
+		InQueue->Reset();
+	}
+
+	void FSearchAllocations::ResetSearchState(const TSharedPtr<PCGEx::FRadixQueue>& InQueue, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const
+	{
+		ResetNodeState(InQueue->GetTouched(), InVisited, InGScore, InGScoreInit, InTravelStack);
+		InQueue->Reset();
+	}
+
+	void FSearchAllocations::ResetNodeState(const TArray<int32>& InTouched, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const
+	{
 		const bool bHasGScore = !InGScore.IsEmpty();
 
 		// Restore only what the previous search dirtied, unless it visited most of the
 		// cluster -- a dense sweep is then cheaper than scattered writes.
-		if (Touched.Num() < NumNodes / 4)
+		if (InTouched.Num() < NumNodes / 4)
 		{
-			for (const int32 Index : Touched)
+			for (const int32 Index : InTouched)
 			{
 				InVisited[Index] = false;
 				InTravelStack->Unset(Index);
@@ -61,8 +90,5 @@ namespace PCGExPathfinding
 				}
 			}
 		}
-
-		// Last: Reset() consumes the touched list.
-		InQueue->Reset();
 	}
 }
@@ -346,6 +346,9 @@ namespace PCGExPathfindingEdges
 		SearchOperation->PrepareForCluster(Cluster.Get());
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
+
+		// Query cost ranges from a few hops to the whole cluster
+		LoopScheduling = PCGExMT::EScheduling::Guided;
 		if (bForceSingleThreadedProcessRange)
 		{
 			SearchAllocations = SearchOperation->NewAllocations();
@@ -360,6 +363,8 @@ namespace PCGExPathfindingEdges
 			HeuristicsHandler->BakeStaticEdgeScores();
 		}
 
+		SearchOperation->PrepareForHeuristics(HeuristicsHandler);
+
 		PCGExArrayHelpers::InitArray(Queries, NumQueries);
 
 		if (bVisited)
@@ -411,10 +416,97 @@ namespace PCGExPathfindingEdges
 			}
 		}
 
+		bBatchBySeed = Settings->bBatchQueriesBySeed && NumQueries > 1 && SearchOperation->SupportsQueryBatch() && HeuristicsHandler->HasGoalIndependentEdgeScores();
+		if (bBatchBySeed)
+		{
+			BuildSeedGroups();
+			StartParallelLoopForRange(SeedGroupOffsets.Num() - 1, bForceSingleThreadedProcessRange ? 12 : 1);
+			return true;
+		}
+
 		StartParallelLoopForRange(Queries.Num(), bForceSingleThreadedProcessRange ? 12 : 1);
 		return true;
 	}
 
+	void FProcessor::BuildSeedGroups()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdges::BuildSeedGroups);
+
+		const int32 NumQueries = Queries.Num();
+
+		// Picks only read the cluster; resolving them up-front is what lets queries be grouped by seed node.
+		PCGExMT::ParallelOrSequential(
+			NumQueries,
+			[&](const int32 i)
+			{
+				Queries[i]->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
+			});
+
+		// Counting sort by seed node, in first-appearance order so grouping is deterministic.
+		TMap<int32, int32> SeedToGroup;
+		TArray<int32> QueryGroup;
+		QueryGroup.Init(-1, NumQueries);
+
+		SeedGroupOffsets.Reset();
+		SeedGroupOffsets.Add(0);
+
+		for (int32 i = 0; i < NumQueries; i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[i];
+			if (!Query->HasValidEndpoints())
+			{
+				// Never reaches ProcessRange, so release it here as the per-query path would
+				Query->Cleanup();
+				continue;
+			}
+
+			const int32* GroupPtr = SeedToGroup.Find(Query->Seed.Node->Index);
+			const int32 GroupIndex = GroupPtr ? *GroupPtr : SeedToGroup.Add(Query->Seed.Node->Index, SeedGroupOffsets.Num() - 1);
+			if (!GroupPtr)
+			{
+				SeedGroupOffsets.Add(0);
+			}
+
+			QueryGroup[i] = GroupIndex;
+			SeedGroupOffsets[GroupIndex + 1]++;
+		}
+
+		const int32 NumGroups = SeedGroupOffsets.Num() - 1;
+		for (int32 g = 0; g < NumGroups; g++)
+		{
+			SeedGroupOffsets[g + 1] += SeedGroupOffsets[g];
+		}
+
+		TArray<int32> Cursors(SeedGroupOffsets.GetData(), NumGroups);
+		SeedGroups.SetNum(SeedGroupOffsets.Last());
+
+		for (int32 i = 0; i < NumQueries; i++)
+		{
+			if (QueryGroup[i] != -1)
+			{
+				SeedGroups[Cursors[QueryGroup[i]]++] = Queries[i];
+			}
+		}
+	}
+
+	void FProcessor::OutputQuery(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query, const bool bVisited)
+	{
+		if (!Query->IsQuerySuccessful())
+		{
+			return;
+		}
+
+		if (bVisited)
+		{
+			PCGExPathfinding::MarkQueryVisited(*Cluster, *Query, VisitedVtxData, VisitedEdgeData);
+		}
+		else
+		{
+			Context->BuildPath(Query, QueriesIO[Query->QueryIndex]);
+			QueriesIO[Query->QueryIndex]->IOIndex = EdgeDataFacade->Source->IOIndex * 100000 + Query->QueryIndex;
+		}
+	}
+
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		const bool bVisited = Settings->OutputMode == EPCGExPathfindingOutputMode::Visited;
@@ -436,6 +528,24 @@ namespace PCGExPathfindingEdges
 			}
 		};
 
+		if (bBatchBySeed)
+		{
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> Group(SeedGroups.GetData() + SeedGroupOffsets[Index], SeedGroupOffsets[Index + 1] - SeedGroupOffsets[Index]);
+
+				PCGExPathfinding::FPathQuery::FindPaths(Group, SearchOperation, ScopedAllocations, HeuristicsHandler);
+
+				for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Group)
+				{
+					OutputQuery(Query, bVisited);
+					Query->Cleanup();
+				}
+			}
+
+			return;
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
@@ -453,21 +563,7 @@ namespace PCGExPathfindingEdges
 			}
 
 			Query->FindPath(SearchOperation, ScopedAllocations, HeuristicsHandler, nullptr);
-
-			if (!Query->IsQuerySuccessful())
-			{
-				continue;
-			}
-
-			if (bVisited)
-			{
-				PCGExPathfinding::MarkQueryVisited(*Cluster, *Query, VisitedVtxData, VisitedEdgeData);
-			}
-			else
-			{
-				Context->BuildPath(Query, QueriesIO[Query->QueryIndex]);
-				QueriesIO[Query->QueryIndex]->IOIndex = EdgeDataFacade->Source->IOIndex * 100000 + Query->QueryIndex;
-			}
+			OutputQuery(Query, bVisited);
 		}
 	}
 
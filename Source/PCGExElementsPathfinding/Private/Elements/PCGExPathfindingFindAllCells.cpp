@@ -319,6 +319,8 @@ namespace PCGExFindAllCells
 				return false;
 			}
 
+			// Cells range from triangles to the outer hull
+			LoopScheduling = PCGExMT::EScheduling::WorkStealing;
 			StartParallelLoopForRange(NumCells);
 		}
 
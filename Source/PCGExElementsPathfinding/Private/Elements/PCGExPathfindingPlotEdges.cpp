@@ -543,6 +543,9 @@ namespace PCGExPathfindingPlotEdges
 		}
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
+
+		// Plot cost ranges from a few hops to the whole cluster
+		LoopScheduling = PCGExMT::EScheduling::Guided;
 		if (bForceSingleThreadedProcessRange)
 		{
 			SearchAllocations = SearchOperation->NewAllocations();
@@ -563,6 +566,8 @@ namespace PCGExPathfindingPlotEdges
 			HeuristicsHandler->BakeStaticEdgeScores();
 		}
 
+		SearchOperation->PrepareForHeuristics(HeuristicsHandler);
+
 		if (bForceSingleThreadedProcessRange)
 		{
 			// Chain FindPaths calls through OnCompleteCallback to ensure sequential execution with shared allocations
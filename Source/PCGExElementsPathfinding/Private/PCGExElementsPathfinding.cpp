@@ -3,15 +3,26 @@
 
 #include "PCGExElementsPathfinding.h"
 
+#include "Clusters/PCGExClusterCache.h"
+#include "Core/PCGExContractionHierarchy.h"
+
 #define LOCTEXT_NAMESPACE "FPCGExElementsPathfindingModule"
 
 void FPCGExElementsPathfindingModule::StartupModule()
 {
 	IPCGExLegacyModuleInterface::StartupModule();
+
+	// Register cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Register(
+		MakeShared<PCGExPathfinding::FContractionHierarchyCacheFactory>());
 }
 
 void FPCGExElementsPathfindingModule::ShutdownModule()
 {
+	// Unregister cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Unregister(
+		PCGExPathfinding::FContractionHierarchyCacheFactory::CacheKey);
+
 	IPCGExLegacyModuleInterface::ShutdownModule();
 }
 
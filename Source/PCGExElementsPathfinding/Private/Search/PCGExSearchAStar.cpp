@@ -32,6 +32,7 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+	const PCGExClusters::FFlatAdjacency& AdjacencyRef = *Adjacency;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
@@ -70,7 +71,7 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 		const double CurrentGScore = GScore[CurrentNodeIndex];
 		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		for (const PCGExGraphs::FLink Lk : Current.Links)
+		for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
@@ -46,6 +46,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+	const PCGExClusters::FFlatAdjacency& AdjacencyRef = *Adjacency;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
@@ -79,7 +80,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 			const PCGExClusters::FNode& CurrentNode = NodesRef[NodeIndex];
 
-			for (const PCGExGraphs::FLink Lk : CurrentNode.Links)
+			for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(NodeIndex))
 			{
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
@@ -119,7 +120,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 			const PCGExClusters::FNode& CurrentNode = NodesRef[NodeIndex];
 
-			for (const PCGExGraphs::FLink Lk : CurrentNode.Links)
+			for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(NodeIndex))
 			{
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
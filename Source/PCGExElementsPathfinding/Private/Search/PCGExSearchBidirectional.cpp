@@ -4,6 +4,7 @@
 #include "Search/PCGExSearchBidirectional.h"
 
 #include "PCGExHeuristicsHandler.h"
+#include "Async/ParallelFor.h"
 #include "Clusters/PCGExCluster.h"
 #include "Containers/PCGExHashLookup.h"
 #include "Core/PCGExPathQuery.h"
@@ -22,13 +23,86 @@ namespace PCGExPathfinding
 		GScoreBackward.Init(-1, NumNodes);
 		TravelStackBackward = MakeShared<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
 		ScoredQueueBackward = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+
+		if (bParallelFrontiers)
+		{
+			SettledForward.SetNum(NumNodes);
+			SettledBackward.SetNum(NumNodes);
+			for (int32 i = 0; i < NumNodes; i++)
+			{
+				SettledForward[i].store(TNumericLimits<double>::Max(), std::memory_order_relaxed);
+				SettledBackward[i].store(TNumericLimits<double>::Max(), std::memory_order_relaxed);
+			}
+		}
 	}
 
 	void FBidirectionalSearchAllocations::Reset()
 	{
+		// Settled entries are a subset of what each queue touched -- restore them before the queues drop their lists
+		if (bParallelFrontiers)
+		{
+			ResetSettled(ScoredQueue->GetTouched(), SettledForward);
+			ResetSettled(ScoredQueueBackward->GetTouched(), SettledBackward);
+		}
+
 		FSearchAllocations::Reset();
 		ResetSearchState(ScoredQueueBackward, VisitedBackward, GScoreBackward, -1, TravelStackBackward);
 	}
+
+	void FBidirectionalSearchAllocations::ResetSettled(const TArray<int32>& InTouched, TArray<std::atomic<double>>& InSettled) const
+	{
+		if (InTouched.Num() < NumNodes / 4)
+		{
+			for (const int32 Index : InTouched)
+			{
+				InSettled[Index].store(TNumericLimits<double>::Max(), std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			for (std::atomic<double>& Value : InSettled)
+			{
+				Value.store(TNumericLimits<double>::Max(), std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+namespace PCGExSearchBidirectional
+{
+	/** State shared by the two parallel frontiers. Index 0 is the forward (seed) frontier, 1 the backward (goal) one. */
+	struct FMeeting
+	{
+		// Best seed-to-goal cost found so far; only ever decreases
+		std::atomic<double> BestCost{TNumericLimits<double>::Max()};
+
+		// Last key each frontier dequeued; only ever increases. Max once a frontier is exhausted.
+		std::atomic<double> FrontierKey[2] = {0, 0};
+
+		std::atomic<bool> bDone{false};
+
+		FCriticalSection Lock;
+		int32 ForwardNode = -1;
+		int32 BackwardNode = -1;
+		int32 Edge = -1;
+
+		void Offer(const double Cost, const int32 InForwardNode, const int32 InBackwardNode, const int32 InEdge)
+		{
+			if (Cost >= BestCost.load())
+			{
+				return;
+			}
+
+			FScopeLock ScopeLock(&Lock);
+			if (Cost < BestCost.load())
+			{
+				BestCost.store(Cost);
+				ForwardNode = InForwardNode;
+				BackwardNode = InBackwardNode;
+				Edge = InEdge;
+			}
+		}
+	};
 }
 
 bool FPCGExSearchOperationBidirectional::ResolveQuery(
@@ -52,10 +126,16 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+	const PCGExClusters::FFlatAdjacency& AdjacencyRef = *Adjacency;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
 
+	if (bParallelFrontiers && LocalAllocations->bParallelFrontiers && NodesRef.Num() >= ParallelMinNodes)
+	{
+		return ResolveQueryParallel(InQuery, LocalAllocations, Heuristics, LocalFeedback.Get());
+	}
+
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationBidirectional::FindPath);
 
 	// Forward search structures
@@ -118,7 +198,7 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 				const double CurrentGScore = GScoreForward[CurrentNodeIndex];
 
-				for (const PCGExGraphs::FLink Lk : Current.Links)
+				for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(CurrentNodeIndex))
 				{
 					const uint32 NeighborIndex = Lk.Node;
 					const uint32 EdgeIndex = Lk.Edge;
@@ -177,7 +257,7 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 				const double CurrentGScore = GScoreBackward[CurrentNodeIndex];
 
-				for (const PCGExGraphs::FLink Lk : Current.Links)
+				for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(CurrentNodeIndex))
 				{
 					const uint32 NeighborIndex = Lk.Node;
 					const uint32 EdgeIndex = Lk.Edge;
@@ -226,6 +306,140 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 	return true;
 }
 
+bool FPCGExSearchOperationBidirectional::ResolveQueryParallel(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+	const PCGExHeuristics::FLocalFeedbackHandler* LocalFeedback) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationBidirectional::FindPathParallel);
+
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+	const PCGExClusters::FFlatAdjacency& AdjacencyRef = *Adjacency;
+
+	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
+	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
+
+	PCGExSearchBidirectional::FMeeting Meeting;
+
+	// Roots are published before either task starts, so a frontier reaching the other's root always sees it
+	Allocations->ScoredQueue->Enqueue(SeedNode.Index, 0);
+	Allocations->GScore[SeedNode.Index] = 0;
+	Allocations->SettledForward[SeedNode.Index].store(0);
+
+	Allocations->ScoredQueueBackward->Enqueue(GoalNode.Index, 0);
+	Allocations->GScoreBackward[GoalNode.Index] = 0;
+	Allocations->SettledBackward[GoalNode.Index].store(0);
+
+	// Settled distances use sequentially consistent atomics: when a frontier settles a node then reads its
+	// neighbor's status while the other frontier does the reverse, at least one of them sees the other's write.
+	// Every edge of the shortest path that straddles both settled sets is thus offered to Meeting, which makes
+	// FrontierKey[0] + FrontierKey[1] >= BestCost a valid stopping criterion.
+	ParallelFor(
+		2, [&](const int32 Direction)
+		{
+			const bool bForward = Direction == 0;
+
+			TBitArray<>& Visited = bForward ? Allocations->Visited : Allocations->VisitedBackward;
+			TArray<double>& GScore = bForward ? Allocations->GScore : Allocations->GScoreBackward;
+			PCGEx::FHashLookupArray* TravelStack = bForward ? Allocations->TravelStack.Get() : Allocations->TravelStackBackward.Get();
+			uint64* const TravelData = TravelStack->GetMutableData();
+			PCGEx::FScoredQueue* Queue = bForward ? Allocations->ScoredQueue.Get() : Allocations->ScoredQueueBackward.Get();
+
+			std::atomic<double>* const Settled = bForward ? Allocations->SettledForward.GetData() : Allocations->SettledBackward.GetData();
+			const std::atomic<double>* const OtherSettled = bForward ? Allocations->SettledBackward.GetData() : Allocations->SettledForward.GetData();
+
+			// Same seed/goal swap as the single-threaded backward step
+			const PCGExClusters::FNode& FromNode = bForward ? SeedNode : GoalNode;
+			const PCGExClusters::FNode& ToNode = bForward ? GoalNode : SeedNode;
+
+			int32 CurrentNodeIndex;
+			double CurrentScore;
+			while (!Meeting.bDone.load(std::memory_order_relaxed) && Queue->Dequeue(CurrentNodeIndex, CurrentScore))
+			{
+				if (Visited[CurrentNodeIndex])
+				{
+					continue;
+				}
+
+				Meeting.FrontierKey[Direction].store(CurrentScore);
+				if (CurrentScore + Meeting.FrontierKey[1 - Direction].load() >= Meeting.BestCost.load())
+				{
+					Meeting.bDone.store(true, std::memory_order_relaxed);
+					break;
+				}
+
+				Visited[CurrentNodeIndex] = true;
+				const double CurrentGScore = GScore[CurrentNodeIndex];
+				Settled[CurrentNodeIndex].store(CurrentGScore);
+
+				// Settled by both frontiers
+				const double OtherCurrent = OtherSettled[CurrentNodeIndex].load();
+				if (OtherCurrent != TNumericLimits<double>::Max())
+				{
+					Meeting.Offer(CurrentGScore + OtherCurrent, CurrentNodeIndex, CurrentNodeIndex, -1);
+				}
+
+				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
+
+				for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(CurrentNodeIndex))
+				{
+					const uint32 NeighborIndex = Lk.Node;
+					const uint32 EdgeIndex = Lk.Edge;
+
+					if (Visited[NeighborIndex])
+					{
+						continue;
+					}
+
+					const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
+					const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
+
+					const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, FromNode, ToNode, LocalFeedback, TravelStack);
+					const double TentativeGScore = CurrentGScore + EScore;
+
+					// Crossing into the other frontier's settled set closes a full seed-to-goal path
+					const double OtherNeighbor = OtherSettled[NeighborIndex].load();
+					if (OtherNeighbor != TNumericLimits<double>::Max())
+					{
+						if (bForward)
+						{
+							Meeting.Offer(TentativeGScore + OtherNeighbor, CurrentNodeIndex, NeighborIndex, EdgeIndex);
+						}
+						else
+						{
+							Meeting.Offer(TentativeGScore + OtherNeighbor, NeighborIndex, CurrentNodeIndex, EdgeIndex);
+						}
+					}
+
+					const double PreviousGScore = GScore[NeighborIndex];
+					if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore)
+					{
+						continue;
+					}
+
+					TravelData[NeighborIndex] = PCGEx::NH64(CurrentNodeIndex, EdgeIndex);
+					GScore[NeighborIndex] = TentativeGScore;
+
+					Queue->Enqueue(NeighborIndex, TentativeGScore);
+				}
+			}
+
+			// Exhausted frontiers settled everything they could reach; they no longer bound the other one.
+			Meeting.FrontierKey[Direction].store(TNumericLimits<double>::Max());
+		});
+
+	if (Meeting.ForwardNode == -1)
+	{
+		return false;
+	}
+
+	ReconstructPath(InQuery, Meeting.ForwardNode, Meeting.BackwardNode, Meeting.Edge, Allocations->TravelStack.Get(), Allocations->TravelStackBackward.Get(), SeedNode.Index, GoalNode.Index);
+
+	return true;
+}
+
 void FPCGExSearchOperationBidirectional::ReconstructPath(
 	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 	int32 MeetingNode,
@@ -233,6 +447,19 @@ void FPCGExSearchOperationBidirectional::ReconstructPath(
 	PCGEx::FHashLookup* BackwardStack,
 	int32 SeedIndex,
 	int32 GoalIndex) const
+{
+	ReconstructPath(InQuery, MeetingNode, MeetingNode, -1, ForwardStack, BackwardStack, SeedIndex, GoalIndex);
+}
+
+void FPCGExSearchOperationBidirectional::ReconstructPath(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	int32 ForwardMeeting,
+	int32 BackwardMeeting,
+	int32 MeetingEdge,
+	PCGEx::FHashLookup* ForwardStack,
+	PCGEx::FHashLookup* BackwardStack,
+	int32 SeedIndex,
+	int32 GoalIndex) const
 {
 	// Build paths in goal-to-seed order so FPathQuery::SetResolution's reverse
 	// produces the conventional seed-to-goal output (matching A*/Dijkstra/BellmanFord).
@@ -241,7 +468,14 @@ void FPCGExSearchOperationBidirectional::ReconstructPath(
 	TArray<int32> BackwardPath;
 	TArray<int32> BackwardEdges;
 
-	int32 CurrentNode = MeetingNode;
+	// Meeting across an edge: the backward endpoint leads the goal side, linked to the forward one by MeetingEdge
+	if (BackwardMeeting != ForwardMeeting)
+	{
+		BackwardPath.Add(BackwardMeeting);
+		BackwardEdges.Add(MeetingEdge);
+	}
+
+	int32 CurrentNode = BackwardMeeting;
 	while (CurrentNode != GoalIndex)
 	{
 		int32 NextNode, EdgeIndex;
@@ -262,7 +496,7 @@ void FPCGExSearchOperationBidirectional::ReconstructPath(
 	TArray<int32> ForwardPath;
 	TArray<int32> ForwardEdges;
 
-	CurrentNode = MeetingNode;
+	CurrentNode = ForwardMeeting;
 	while (CurrentNode != SeedIndex)
 	{
 		ForwardPath.Add(CurrentNode);
@@ -292,6 +526,17 @@ void FPCGExSearchOperationBidirectional::ReconstructPath(
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationBidirectional::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FBidirectionalSearchAllocations>();
+	Allocations->bParallelFrontiers = bParallelFrontiers && Cluster->Nodes->Num() >= ParallelMinNodes;
 	Allocations->Init(Cluster);
 	return Allocations;
 }
+
+void UPCGExSearchBidirectional::CopySettingsFrom(const UPCGExInstancedFactory* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchBidirectional* TypedOther = Cast<UPCGExSearchBidirectional>(Other))
+	{
+		bParallelFrontiers = TypedOther->bParallelFrontiers;
+		ParallelMinNodes = TypedOther->ParallelMinNodes;
+	}
+}
@@ -0,0 +1,207 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Search/PCGExSearchContractionHierarchy.h"
+
+#include "PCGExHeuristicsHandler.h"
+#include "Algo/Reverse.h"
+#include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExHashLookup.h"
+#include "Core/PCGExContractionHierarchy.h"
+#include "Core/PCGExPathQuery.h"
+#include "Core/PCGExPathfinding.h"
+#include "Core/PCGExSearchAllocations.h"
+#include "Search/PCGExSearchBidirectional.h"
+#include "Utils/PCGExScoredQueue.h"
+
+void FPCGExSearchOperationContractionHierarchy::PrepareForCluster(PCGExClusters::FCluster* InCluster)
+{
+	FPCGExSearchOperationDijkstra::PrepareForCluster(InCluster);
+	Hierarchy.Reset();
+}
+
+void FPCGExSearchOperationContractionHierarchy::PrepareForHeuristics(const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics)
+{
+	FPCGExSearchOperationDijkstra::PrepareForHeuristics(Heuristics);
+	Hierarchy = PCGExPathfinding::GetOrBuildContractionHierarchy(Cluster, Heuristics);
+}
+
+bool FPCGExSearchOperationContractionHierarchy::ResolveQuery(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+	const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const
+{
+	if (!Hierarchy)
+	{
+		return FPCGExSearchOperationDijkstra::ResolveQuery(InQuery, Allocations, Heuristics, LocalFeedback);
+	}
+
+	check(InQuery->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
+
+	TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> LocalAllocations;
+	if (Allocations)
+	{
+		LocalAllocations = StaticCastSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations>(Allocations);
+		LocalAllocations->Reset();
+	}
+	else
+	{
+		LocalAllocations = StaticCastSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations>(NewAllocations());
+	}
+
+	const PCGExPathfinding::FContractionHierarchy& HierarchyRef = *Hierarchy;
+	const TArray<PCGExPathfinding::FHierarchyArc>& ArcsRef = HierarchyRef.Arcs;
+
+	const int32 SeedIndex = InQuery->Seed.Node->Index;
+	const int32 GoalIndex = InQuery->Goal.Node->Index;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationContractionHierarchy::FindPath);
+
+	// Travel stacks store (previous node, hierarchy arc) rather than (previous node, edge)
+	uint64* const TravelDataForward = LocalAllocations->TravelStack->GetMutableData();
+	uint64* const TravelDataBackward = LocalAllocations->TravelStackBackward->GetMutableData();
+	PCGEx::FScoredQueue* QueueForward = LocalAllocations->ScoredQueue.Get();
+	PCGEx::FScoredQueue* QueueBackward = LocalAllocations->ScoredQueueBackward.Get();
+
+	// Queue scores outlive dequeues, so they double as each side's tentative distances
+	const TArray<double>& DistForward = QueueForward->Scores;
+	const TArray<double>& DistBackward = QueueBackward->Scores;
+
+	QueueForward->Enqueue(SeedIndex, 0);
+	QueueBackward->Enqueue(GoalIndex, 0);
+
+	int32 MeetingNode = -1;
+	double BestPathCost = TNumericLimits<double>::Max();
+
+	bool bForwardDone = false;
+	bool bBackwardDone = false;
+
+	// Both sides only climb ranks; each stops once its frontier can't beat the best meeting so far.
+	while (!bForwardDone || !bBackwardDone)
+	{
+		int32 CurrentNodeIndex;
+		double CurrentScore;
+
+		if (!bForwardDone)
+		{
+			if (!QueueForward->Dequeue(CurrentNodeIndex, CurrentScore) || CurrentScore >= BestPathCost)
+			{
+				bForwardDone = true;
+			}
+			else
+			{
+				const double Remaining = DistBackward[CurrentNodeIndex];
+				if (Remaining != TNumericLimits<double>::Max() && CurrentScore + Remaining < BestPathCost)
+				{
+					BestPathCost = CurrentScore + Remaining;
+					MeetingNode = CurrentNodeIndex;
+				}
+
+				for (const int32 ArcIndex : HierarchyRef.GetUpArcs(CurrentNodeIndex))
+				{
+					const PCGExPathfinding::FHierarchyArc& Arc = ArcsRef[ArcIndex];
+					if (QueueForward->Enqueue(Arc.To, CurrentScore + Arc.Weight))
+					{
+						TravelDataForward[Arc.To] = PCGEx::NH64(CurrentNodeIndex, ArcIndex);
+					}
+				}
+			}
+		}
+
+		if (!bBackwardDone)
+		{
+			if (!QueueBackward->Dequeue(CurrentNodeIndex, CurrentScore) || CurrentScore >= BestPathCost)
+			{
+				bBackwardDone = true;
+			}
+			else
+			{
+				const double Traveled = DistForward[CurrentNodeIndex];
+				if (Traveled != TNumericLimits<double>::Max() && CurrentScore + Traveled < BestPathCost)
+				{
+					BestPathCost = CurrentScore + Traveled;
+					MeetingNode = CurrentNodeIndex;
+				}
+
+				for (const int32 ArcIndex : HierarchyRef.GetDownArcs(CurrentNodeIndex))
+				{
+					const PCGExPathfinding::FHierarchyArc& Arc = ArcsRef[ArcIndex];
+					if (QueueBackward->Enqueue(Arc.From, CurrentScore + Arc.Weight))
+					{
+						TravelDataBackward[Arc.From] = PCGEx::NH64(CurrentNodeIndex, ArcIndex);
+					}
+				}
+			}
+		}
+	}
+
+	if (MeetingNode == -1)
+	{
+		return false;
+	}
+
+	// Hierarchy arcs from seed to goal: forward chain (walked back, then flipped), then backward chain
+	TArray<int32> HierarchyPath;
+
+	int32 PathNodeIndex = MeetingNode;
+	int32 NextNodeIndex;
+	int32 ArcIndex;
+
+	while (true)
+	{
+		PCGEx::NH64(TravelDataForward[PathNodeIndex], NextNodeIndex, ArcIndex);
+		if (NextNodeIndex == -1)
+		{
+			break;
+		}
+
+		HierarchyPath.Add(ArcIndex);
+		PathNodeIndex = NextNodeIndex;
+	}
+
+	Algo::Reverse(HierarchyPath);
+
+	PathNodeIndex = MeetingNode;
+	while (true)
+	{
+		PCGEx::NH64(TravelDataBackward[PathNodeIndex], NextNodeIndex, ArcIndex);
+		if (NextNodeIndex == -1)
+		{
+			break;
+		}
+
+		HierarchyPath.Add(ArcIndex);
+		PathNodeIndex = NextNodeIndex;
+	}
+
+	TArray<int32> PathArcs;
+	PathArcs.Reserve(HierarchyPath.Num() * 4);
+	for (const int32 HierarchyArcIndex : HierarchyPath)
+	{
+		HierarchyRef.UnpackArc(HierarchyArcIndex, PathArcs);
+	}
+
+	if (PathArcs.IsEmpty())
+	{
+		return false;
+	}
+
+	// Goal to seed, each node paired with the edge leading back toward the seed -- same as the travel-stack searches
+	InQuery->AddPathNode(GoalIndex, ArcsRef[PathArcs.Last()].Edge);
+	for (int32 i = PathArcs.Num() - 1; i > 0; i--)
+	{
+		InQuery->AddPathNode(ArcsRef[PathArcs[i]].From, ArcsRef[PathArcs[i - 1]].Edge);
+	}
+	InQuery->AddPathNode(SeedIndex, -1);
+
+	return true;
+}
+
+TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationContractionHierarchy::NewAllocations() const
+{
+	// Two-sided search state; the Dijkstra fallback only uses the forward half
+	TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FBidirectionalSearchAllocations>();
+	Allocations->Init(Cluster);
+	return Allocations;
+}
@@ -11,8 +11,72 @@
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExPathfinding.h"
 #include "Core/PCGExSearchAllocations.h"
+#include "Utils/PCGExRadixQueue.h"
 #include "Utils/PCGExScoredQueue.h"
 
+namespace PCGExSearchDijkstra
+{
+	// Shared by both queue flavors; TQueue is PCGEx::FScoredQueue or PCGEx::FRadixQueue.
+	template <typename TQueue>
+	void GrowTree(
+		TQueue* ScoredQueue,
+		const FPCGExSearchOperation& Operation,
+		PCGExPathfinding::FSearchAllocations& Allocations,
+		const PCGExClusters::FNode& SeedNode,
+		const PCGExClusters::FNode& GoalNode,
+		const PCGExHeuristics::FHandler* Heuristics,
+		const PCGExHeuristics::FLocalFeedbackHandler* Feedback)
+	{
+		const TArray<PCGExClusters::FNode>& NodesRef = *Operation.Cluster->Nodes;
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *Operation.Cluster->Edges;
+		const PCGExClusters::FFlatAdjacency& AdjacencyRef = *Operation.Adjacency;
+
+		TBitArray<>& Visited = Allocations.Visited;
+		PCGEx::FHashLookupArray* TravelStack = Allocations.TravelStack.Get();
+		uint64* const TravelData = TravelStack->GetMutableData();
+		ScoredQueue->Enqueue(SeedNode.Index, 0);
+
+		int32 CurrentNodeIndex;
+		double CurrentScore;
+		while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+		{
+			if (Operation.bEarlyExit && CurrentNodeIndex == GoalNode.Index)
+			{
+				break;
+			} // Exit early
+
+			if (Visited[CurrentNodeIndex])
+			{
+				continue;
+			}
+			Visited[CurrentNodeIndex] = true;
+
+			// Read the node only after the visited check -- stale queue entries skip the load.
+			const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
+
+			for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(CurrentNodeIndex))
+			{
+				const uint32 NeighborIndex = Lk.Node;
+				const uint32 EdgeIndex = Lk.Edge;
+
+				if (Visited[NeighborIndex])
+				{
+					continue;
+				}
+
+				const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
+				const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
+
+				const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+				if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
+				{
+					TravelData[NeighborIndex] = PCGEx::NH64(CurrentNodeIndex, EdgeIndex);
+				}
+			}
+		}
+	}
+}
+
 bool FPCGExSearchOperationDijkstra::ResolveQuery(
 	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
@@ -31,9 +95,6 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 		LocalAllocations->Reset();
 	}
 
-	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
-	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
-
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
 
@@ -41,54 +102,16 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 	// Basic Dijkstra implementation
 
-	TBitArray<>& Visited = LocalAllocations->Visited;
-	PCGEx::FHashLookupArray* TravelStack = LocalAllocations->TravelStack.Get();
-	uint64* const TravelData = TravelStack->GetMutableData();
-	PCGEx::FScoredQueue* ScoredQueue = LocalAllocations->ScoredQueue.Get();
-	ScoredQueue->Enqueue(SeedNode.Index, 0);
-
-	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
-
-	int32 VisitedNum = 0;
-	int32 CurrentNodeIndex;
-	double CurrentScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	if (LocalAllocations->RadixQueue)
 	{
-		if (bEarlyExit && CurrentNodeIndex == GoalNode.Index)
-		{
-			break;
-		} // Exit early
-
-		if (Visited[CurrentNodeIndex])
-		{
-			continue;
-		}
-		Visited[CurrentNodeIndex] = true;
-		VisitedNum++;
-
-		// Read the node only after the visited check -- stale queue entries skip the load.
-		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
-
-		for (const PCGExGraphs::FLink Lk : Current.Links)
-		{
-			const uint32 NeighborIndex = Lk.Node;
-			const uint32 EdgeIndex = Lk.Edge;
-
-			if (Visited[NeighborIndex])
-			{
-				continue;
-			}
-
-			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
-			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
-
-			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
-			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
-			{
-				TravelData[NeighborIndex] = PCGEx::NH64(CurrentNodeIndex, EdgeIndex);
-			}
-		}
+		PCGExSearchDijkstra::GrowTree(LocalAllocations->RadixQueue.Get(), *this, *LocalAllocations, SeedNode, GoalNode, Heuristics.Get(), LocalFeedback.Get());
 	}
+	else
+	{
+		PCGExSearchDijkstra::GrowTree(LocalAllocations->ScoredQueue.Get(), *this, *LocalAllocations, SeedNode, GoalNode, Heuristics.Get(), LocalFeedback.Get());
+	}
+
+	const uint64* const TravelData = LocalAllocations->TravelStack->GetMutableData();
 
 	bool bSuccess = false;
 
@@ -99,7 +122,6 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 	if (PathNodeIndex != -1)
 	{
 		bSuccess = true;
-		//InQuery->Reserve(VisitedNum);
 
 		InQuery->AddPathNode(GoalNode.Index, PathEdgeIndex);
 
@@ -114,3 +136,20 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 	return bSuccess;
 }
+
+TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationDijkstra::NewAllocations() const
+{
+	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FSearchAllocations>();
+	Allocations->bUseRadixQueue = bUseRadixQueue;
+	Allocations->Init(Cluster);
+	return Allocations;
+}
+
+void UPCGExSearchDijkstra::CopySettingsFrom(const UPCGExInstancedFactory* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchDijkstra* TypedOther = Cast<UPCGExSearchDijkstra>(Other))
+	{
+		bUseRadixQueue = TypedOther->bUseRadixQueue;
+	}
+}
@@ -3,11 +3,83 @@
 
 
 #include "Search/PCGExSearchOperation.h"
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExHashLookup.h"
+#include "Core/PCGExPathQuery.h"
 #include "Core/PCGExSearchAllocations.h"
+#include "Utils/PCGExRadixQueue.h"
+#include "Utils/PCGExScoredQueue.h"
+
+namespace PCGExSearchOperation
+{
+	// Plain Dijkstra: goal-independent edge scores make the seed's shortest-path tree valid for every goal,
+	// so the goal passed to GetEdgeScore is irrelevant and the seed stands in for it.
+	template <typename TQueue>
+	void GrowSharedTree(
+		TQueue* ScoredQueue,
+		const FPCGExSearchOperation& Operation,
+		PCGExPathfinding::FSearchAllocations& Allocations,
+		const PCGExClusters::FNode& SeedNode,
+		const PCGExHeuristics::FHandler* Heuristics,
+		int32 PendingGoals)
+	{
+		const TArray<PCGExClusters::FNode>& NodesRef = *Operation.Cluster->Nodes;
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *Operation.Cluster->Edges;
+		const PCGExClusters::FFlatAdjacency& AdjacencyRef = *Operation.Adjacency;
+
+		const TBitArray<>& GoalMask = Allocations.GoalMask;
+		TBitArray<>& Visited = Allocations.Visited;
+		PCGEx::FHashLookupArray* TravelStack = Allocations.TravelStack.Get();
+		uint64* const TravelData = TravelStack->GetMutableData();
+		ScoredQueue->Enqueue(SeedNode.Index, 0);
+
+		int32 CurrentNodeIndex;
+		double CurrentScore;
+		while (PendingGoals > 0 && ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+		{
+			if (Visited[CurrentNodeIndex])
+			{
+				continue;
+			}
+			Visited[CurrentNodeIndex] = true;
+
+			// A goal's predecessor is final once it settles.
+			if (GoalMask[CurrentNodeIndex])
+			{
+				PendingGoals--;
+			}
+
+			const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
+
+			for (const PCGExGraphs::FLink Lk : AdjacencyRef.GetLinks(CurrentNodeIndex))
+			{
+				const uint32 NeighborIndex = Lk.Node;
+				const uint32 EdgeIndex = Lk.Edge;
+
+				if (Visited[NeighborIndex])
+				{
+					continue;
+				}
+
+				const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, NodesRef[NeighborIndex], EdgesRef[EdgeIndex], SeedNode, SeedNode, nullptr, TravelStack);
+				if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
+				{
+					TravelData[NeighborIndex] = PCGEx::NH64(CurrentNodeIndex, EdgeIndex);
+				}
+			}
+		}
+	}
+}
 
 void FPCGExSearchOperation::PrepareForCluster(PCGExClusters::FCluster* InCluster)
 {
 	Cluster = InCluster;
+	Adjacency = Cluster->GetFlatAdjacency();
+}
+
+void FPCGExSearchOperation::PrepareForHeuristics(const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics)
+{
 }
 
 bool FPCGExSearchOperation::ResolveQuery(
@@ -19,6 +91,105 @@ bool FPCGExSearchOperation::ResolveQuery(
 	return false;
 }
 
+void FPCGExSearchOperation::ResolveQueryBatch(
+	const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const
+{
+	if (InQueries.IsEmpty())
+	{
+		return;
+	}
+
+	if (!SupportsQueryBatch() || InQueries.Num() == 1)
+	{
+		for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+		{
+			ResolveQuery(Query, Allocations, Heuristics);
+		}
+		return;
+	}
+
+	check(Heuristics->HasGoalIndependentEdgeScores())
+
+	TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = Allocations;
+	if (!LocalAllocations)
+	{
+		LocalAllocations = NewAllocations();
+	}
+	else
+	{
+		LocalAllocations->Reset();
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperation::ResolveQueryBatch);
+
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const PCGExClusters::FNode& SeedNode = *InQueries[0]->Seed.Node;
+
+	// Goals are flagged in a scratch mask and counted down as they settle; the mask is cleared
+	// on the way out so pooled allocations come back clean.
+	TBitArray<>& GoalMask = LocalAllocations->GoalMask;
+	if (GoalMask.Num() != NodesRef.Num())
+	{
+		GoalMask.Init(false, NodesRef.Num());
+	}
+
+	int32 PendingGoals = 0;
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		check(Query->PickResolution == PCGExPathfinding::EQueryPickResolution::Success && Query->Seed.Node == &SeedNode)
+		FBitReference GoalBit = GoalMask[Query->Goal.Node->Index];
+		if (!GoalBit)
+		{
+			GoalBit = true;
+			PendingGoals++;
+		}
+	}
+
+	if (LocalAllocations->RadixQueue)
+	{
+		PCGExSearchOperation::GrowSharedTree(LocalAllocations->RadixQueue.Get(), *this, *LocalAllocations, SeedNode, Heuristics.Get(), PendingGoals);
+	}
+	else
+	{
+		PCGExSearchOperation::GrowSharedTree(LocalAllocations->ScoredQueue.Get(), *this, *LocalAllocations, SeedNode, Heuristics.Get(), PendingGoals);
+	}
+
+	const TBitArray<>& Visited = LocalAllocations->Visited;
+	const uint64* const TravelData = LocalAllocations->TravelStack->GetMutableData();
+
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		const int32 GoalIndex = Query->Goal.Node->Index;
+		GoalMask[GoalIndex] = false;
+
+		if (!Visited[GoalIndex])
+		{
+			continue;
+		}
+
+		int32 PathNodeIndex;
+		int32 PathEdgeIndex;
+		PCGEx::NH64(TravelData[GoalIndex], PathNodeIndex, PathEdgeIndex);
+
+		if (PathNodeIndex == -1)
+		{
+			continue;
+		}
+
+		Query->AddPathNode(GoalIndex, PathEdgeIndex);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelData[CurrentIndex], PathNodeIndex, PathEdgeIndex);
+
+			Query->AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+	}
+}
+
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperation::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FSearchAllocations>();
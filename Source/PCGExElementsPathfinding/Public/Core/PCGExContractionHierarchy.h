@@ -0,0 +1,128 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+
+namespace PCGExHeuristics
+{
+	class FHandler;
+}
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExPathfinding
+{
+	/**
+	 * Directed arc of a contraction hierarchy.
+	 * Either an original cluster edge walked in one direction, or a shortcut standing for
+	 * ChildA (From -> contracted node) followed by ChildB (contracted node -> To).
+	 */
+	struct FHierarchyArc
+	{
+		int32 From = -1;
+		int32 To = -1;
+		double Weight = 0;
+		int32 Edge = -1;   // Original cluster edge, -1 for shortcuts
+		int32 ChildA = -1; // Shortcuts only
+		int32 ChildB = -1; // Shortcuts only
+
+		FHierarchyArc() = default;
+
+		FHierarchyArc(const int32 InFrom, const int32 InTo, const double InWeight, const int32 InEdge, const int32 InChildA = -1, const int32 InChildB = -1)
+			: From(InFrom), To(InTo), Weight(InWeight), Edge(InEdge), ChildA(InChildA), ChildB(InChildB)
+		{
+		}
+	};
+
+	/**
+	 * Contraction hierarchy over a cluster's directed edge scores.
+	 * Nodes are contracted one at a time in importance order, adding shortcuts wherever the contracted node
+	 * was the only shortest way between two of its neighbors. A query then only has to run two tiny searches
+	 * climbing ranks -- forward from the seed over Up arcs, backward from the goal over Down arcs.
+	 * Only valid for goal-independent scores; ContextHash fingerprints the scores it was built from.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FContractionHierarchy : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		/** Contraction order; higher rank = contracted later = more important. */
+		TArray<int32> Rank;
+
+		/** Original arcs first, then shortcuts. */
+		TArray<FHierarchyArc> Arcs;
+
+		/** Arcs leaving each node toward a higher rank, CSR-packed. */
+		TArray<int32> UpOffsets;
+		TArray<int32> UpArcs;
+
+		/** Arcs entering each node from a higher rank, CSR-packed -- walked From-ward by the backward search. */
+		TArray<int32> DownOffsets;
+		TArray<int32> DownArcs;
+
+		FORCEINLINE TConstArrayView<int32> GetUpArcs(const int32 NodeIndex) const
+		{
+			const int32 Start = UpOffsets[NodeIndex];
+			return TConstArrayView<int32>(UpArcs.GetData() + Start, UpOffsets[NodeIndex + 1] - Start);
+		}
+
+		FORCEINLINE TConstArrayView<int32> GetDownArcs(const int32 NodeIndex) const
+		{
+			const int32 Start = DownOffsets[NodeIndex];
+			return TConstArrayView<int32>(DownArcs.GetData() + Start, DownOffsets[NodeIndex + 1] - Start);
+		}
+
+		/** Expands an arc into the original arcs it stands for, appended in From -> To order. */
+		void UnpackArc(const int32 ArcIndex, TArray<int32>& OutArcs) const;
+
+		/** Fingerprint of a directed score array (see BuildDirectedEdgeScores); never 0. */
+		static uint32 ComputeContextHash(const TArray<double>& InDirectedScores);
+
+		/**
+		 * Contracts the whole cluster.
+		 * @param InDirectedScores Two entries per edge: [Index*2] start-to-end, [Index*2+1] end-to-start.
+		 */
+		static TSharedPtr<FContractionHierarchy> Build(const PCGExClusters::FCluster* InCluster, const TArray<double>& InDirectedScores);
+	};
+
+	/**
+	 * Factory for the contraction hierarchy cache.
+	 * Opportunistic only: the hierarchy depends on heuristics, which the pre-build context doesn't carry.
+	 * Search operations build it through GetOrBuildContractionHierarchy.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FContractionHierarchyCacheFactory : public PCGExClusters::IClusterCacheFactory
+	{
+	public:
+		static inline const FName CacheKey = FName("ContractionHierarchy");
+
+		virtual FName GetCacheKey() const override
+		{
+			return CacheKey;
+		}
+
+		virtual FText GetDisplayName() const override;
+		virtual FText GetTooltip() const override;
+
+		virtual EClusterCacheType GetCacheType() const override
+		{
+			return EClusterCacheType::Opportunistic;
+		}
+
+		virtual TSharedPtr<PCGExClusters::ICachedClusterData> Build(const PCGExClusters::FClusterCacheBuildContext& Context) const override;
+	};
+
+	/** Evaluates every directed edge score once. Heuristics must have goal-independent edge scores. */
+	PCGEXELEMENTSPATHFINDING_API void BuildDirectedEdgeScores(const PCGExClusters::FCluster* InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics, TArray<double>& OutDirectedScores);
+
+	/**
+	 * Get or build a contraction hierarchy for a cluster.
+	 * - Returns nullptr if heuristics have goal-dependent scores or feedback
+	 * - Checks cluster cache first, validated against the current scores
+	 * - If not cached, contracts synchronously and caches opportunistically
+	 */
+	PCGEXELEMENTSPATHFINDING_API TSharedPtr<FContractionHierarchy> GetOrBuildContractionHierarchy(PCGExClusters::FCluster* InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics);
+}
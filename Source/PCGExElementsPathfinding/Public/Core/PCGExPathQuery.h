@@ -83,6 +83,14 @@ namespace PCGExPathfinding
 			const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler,
 			const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback);
 
+		/** Resolves a group of queries sharing the same seed node in one go (see FPCGExSearchOperation::ResolveQueryBatch).
+		 * Picks must already be resolved successfully. Feedback-free by contract -- callers only batch goal-independent heuristics. */
+		static void FindPaths(
+			const TArrayView<const TSharedPtr<FPathQuery>> InQueries,
+			const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
+			const TSharedPtr<FSearchAllocations>& Allocations,
+			const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler);
+
 		void AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart = 0, const int32 TruncateEnd = 0) const;
 
 		void AppendEdgePoints(TArray<int32>& OutPoints) const;
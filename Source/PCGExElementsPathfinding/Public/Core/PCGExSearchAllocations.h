@@ -13,6 +13,7 @@ namespace PCGExClusters
 namespace PCGEx
 {
 	class FScoredQueue;
+	class FRadixQueue;
 	class FHashLookup;
 	class FHashLookupArray;
 }
@@ -36,6 +37,15 @@ namespace PCGExPathfinding
 		TSharedPtr<PCGEx::FHashLookupArray> TravelStack;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueue;
 
+		// Set before Init to allocate RadixQueue instead of ScoredQueue. Only searches that know how to drive it
+		// (monotone ones, see PCGEx::FRadixQueue) should request it; everything else expects ScoredQueue.
+		bool bUseRadixQueue = false;
+		TSharedPtr<PCGEx::FRadixQueue> RadixQueue;
+
+		// Goal flags for batched same-seed resolution. Lazily sized by the batch resolver, which clears
+		// the bits it sets before returning -- Reset() never needs to touch it.
+		TBitArray<> GoalMask;
+
 		virtual void Init(const PCGExClusters::FCluster* InCluster);
 
 		/** Allocates GScore and registers the sentinel Reset() must restore it to. */
@@ -47,5 +57,9 @@ namespace PCGExPathfinding
 		/** Sparse-resets one set of search state, driven by the queue's touched list.
 		 * Valid as long as the search only dirties per-node state alongside queue enqueues. */
 		void ResetSearchState(const TSharedPtr<PCGEx::FScoredQueue>& InQueue, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const;
+		void ResetSearchState(const TSharedPtr<PCGEx::FRadixQueue>& InQueue, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const;
+
+		/** Restores per-node state for the given touched indices; the queue itself is left to the caller. */
+		void ResetNodeState(const TArray<int32>& InTouched, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const;
 	};
 }
@@ -124,6 +124,12 @@ public:
 	/** If disabled, will share memory allocations between queries, forcing them to execute one after another. Much slower, but very conservative for memory.  Using global feedback forces this behavior under the hood.*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bGreedyQueries = true;
+
+	/** Resolve all queries sharing the same seed node with a single shortest-path tree, instead of one search per query.
+	 * Only kicks in when heuristics are goal-independent (no goal-dependent heuristic, no feedback) and the search supports it (A*, Dijkstra).
+	 * Batched queries always return a lowest-cost path; with an inadmissible A* heuristic this may differ from the per-query result. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bBatchQueriesBySeed = false;
 };
 
 struct FPCGExPathfindingEdgesContext final : FPCGExClustersProcessorContext
@@ -173,6 +179,12 @@ namespace PCGExPathfindingEdges
 		TArray<TSharedPtr<PCGExData::FPointIO>> QueriesIO;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
 
+		// Seed-batched mode: valid queries grouped by seed node, flattened.
+		// SeedGroups[SeedGroupOffsets[i]..SeedGroupOffsets[i+1]) are the queries of group i.
+		bool bBatchBySeed = false;
+		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> SeedGroups;
+		TArray<int32> SeedGroupOffsets;
+
 		// Visited mode: per-element counts written via atomic increments. The vtx buffer is owned
 		// by the batch (shared across the batch's clusters); the edge buffer is per-processor.
 		int32* VisitedVtxData = nullptr;
@@ -193,6 +205,10 @@ namespace PCGExPathfindingEdges
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void Write() override;
+
+	protected:
+		void BuildSeedGroups();
+		void OutputQuery(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query, const bool bVisited);
 	};
 
 	class FBatch final : public PCGExClusterMT::TBatch<FProcessor>
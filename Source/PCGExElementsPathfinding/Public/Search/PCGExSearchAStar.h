@@ -22,6 +22,8 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
 
+	virtual bool SupportsQueryBatch() const override { return true; }
+
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
 };
 
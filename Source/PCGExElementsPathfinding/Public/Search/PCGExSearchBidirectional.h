@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 #include "PCGExSearchOperation.h"
 #include "Core/PCGExSearchAllocations.h"
@@ -35,8 +37,18 @@ namespace PCGExPathfinding
 		TSharedPtr<PCGEx::FHashLookupArray> TravelStackBackward;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueueBackward;
 
+		// Set before Init to allocate the settled-distance arrays the parallel frontiers exchange.
+		bool bParallelFrontiers = false;
+
+		// Final distance of each node settled by a frontier, Max until then. The only state one frontier reads from the other.
+		TArray<std::atomic<double>> SettledForward;
+		TArray<std::atomic<double>> SettledBackward;
+
 		virtual void Init(const PCGExClusters::FCluster* InCluster) override;
 		virtual void Reset() override;
+
+	protected:
+		void ResetSettled(const TArray<int32>& InTouched, TArray<std::atomic<double>>& InSettled) const;
 	};
 }
 
@@ -47,6 +59,10 @@ namespace PCGExPathfinding
 class FPCGExSearchOperationBidirectional : public FPCGExSearchOperation
 {
 public:
+	/** Grow each frontier on its own task. Only used on clusters with at least ParallelMinNodes nodes. */
+	bool bParallelFrontiers = false;
+	int32 ParallelMinNodes = 20000;
+
 	virtual bool ResolveQuery(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
@@ -56,6 +72,17 @@ public:
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
 
 protected:
+	/**
+	 * Grows both frontiers concurrently, one task each. The frontiers only share their settled distances and an
+	 * atomic best meeting cost; each stops once the sum of both frontier keys reaches that cost.
+	 * Helps the few very long queries that remain on the critical path once the rest of a batch is done.
+	 */
+	bool ResolveQueryParallel(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+		const PCGExHeuristics::FLocalFeedbackHandler* LocalFeedback) const;
+
 	/** Reconstruct path from meeting point using both travel stacks */
 	void ReconstructPath(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
@@ -64,6 +91,17 @@ protected:
 		PCGEx::FHashLookup* BackwardStack,
 		int32 SeedIndex,
 		int32 GoalIndex) const;
+
+	/** Same as above, for frontiers that met across MeetingEdge (ForwardMeeting -> BackwardMeeting) rather than on a node */
+	void ReconstructPath(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		int32 ForwardMeeting,
+		int32 BackwardMeeting,
+		int32 MeetingEdge,
+		PCGEx::FHashLookup* ForwardStack,
+		PCGEx::FHashLookup* BackwardStack,
+		int32 SeedIndex,
+		int32 GoalIndex) const;
 };
 
 /**
@@ -78,10 +116,22 @@ class UPCGExSearchBidirectional : public UPCGExSearchInstancedFactory
 	GENERATED_BODY()
 
 public:
+	/** Grow the seed and goal frontiers on two separate tasks. Worth it for very long queries on huge clusters; smaller clusters keep the single-threaded search. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
+	bool bParallelFrontiers = false;
+
+	/** Minimum cluster node count before frontiers run in parallel. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bParallelFrontiers", ClampMin=0), AdvancedDisplay)
+	int32 ParallelMinNodes = 20000;
+
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationBidirectional)
 		NewOperation->bEarlyExit = bEarlyExit;
+		NewOperation->bParallelFrontiers = bParallelFrontiers;
+		NewOperation->ParallelMinNodes = ParallelMinNodes;
 		return NewOperation;
 	}
 };
@@ -0,0 +1,62 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExSearchDijkstra.h"
+#include "Factories/PCGExFactoryData.h"
+
+#include "UObject/Object.h"
+#include "PCGExSearchContractionHierarchy.generated.h"
+
+namespace PCGExPathfinding
+{
+	class FContractionHierarchy;
+}
+
+/**
+ * Contraction Hierarchy search operation.
+ * Answers queries with an upward search from each end over a hierarchy cached on the cluster.
+ * Falls back to plain Dijkstra when heuristics aren't goal-independent, since no hierarchy can be built then.
+ */
+class FPCGExSearchOperationContractionHierarchy : public FPCGExSearchOperationDijkstra
+{
+public:
+	/** Hierarchy for the current cluster, null when falling back to Dijkstra. */
+	TSharedPtr<PCGExPathfinding::FContractionHierarchy> Hierarchy;
+
+	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster) override;
+	virtual void PrepareForHeuristics(const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) override;
+
+	virtual bool ResolveQuery(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+
+	// Hierarchy queries are already cheaper than a shared tree
+	virtual bool SupportsQueryBatch() const override { return !Hierarchy; }
+
+	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
+};
+
+/**
+ * Contraction Hierarchy search.
+ * Preprocesses the cluster once into a hierarchy of shortcuts, after which each query only explores a handful of nodes.
+ * The hierarchy is cached on the cluster and reused downstream as long as edge scores don't change.
+ * Requires goal-independent heuristics (no feedback); otherwise behaves exactly like Dijkstra.
+ */
+UCLASS(MinimalAPI, meta=(DisplayName = "Contraction Hierarchy", ToolTip ="Contraction Hierarchy search. Expensive one-time preprocessing, then near-instant queries. Best for many queries on the same cluster with static heuristics.", PCGExNodeLibraryDoc="pathfinding/algorithms/search-contraction-hierarchy"))
+class UPCGExSearchContractionHierarchy : public UPCGExSearchInstancedFactory
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
+	{
+		PCGEX_FACTORY_NEW_OPERATION(SearchOperationContractionHierarchy)
+		NewOperation->bEarlyExit = bEarlyExit;
+		return NewOperation;
+	}
+};
@@ -14,11 +14,18 @@ class FPCGExHeuristicOperation;
 class FPCGExSearchOperationDijkstra : public FPCGExSearchOperation
 {
 public:
+	/** Allocations created by this operation use PCGEx::FRadixQueue instead of the binary heap. */
+	bool bUseRadixQueue = false;
+
 	virtual bool ResolveQuery(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+
+	virtual bool SupportsQueryBatch() const override { return true; }
+
+	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
 };
 
 /**
@@ -30,10 +37,17 @@ class UPCGExSearchDijkstra : public UPCGExSearchInstancedFactory
 	GENERATED_BODY()
 
 public:
+	/** Use a radix heap rather than a binary heap for the open list. Faster on large clusters whose edge scores are integer-ish or repeat a lot (uniform lattices). Edge scores must not be negative. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
+	bool bUseRadixQueue = false;
+
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationDijkstra)
 		NewOperation->bEarlyExit = bEarlyExit;
+		NewOperation->bUseRadixQueue = bUseRadixQueue;
 		return NewOperation;
 	}
 };
@@ -30,6 +30,7 @@ class FPCGExHeuristicOperation;
 namespace PCGExClusters
 {
 	class FCluster;
+	class FFlatAdjacency;
 }
 
 class FPCGExSearchOperation : public FPCGExOperation
@@ -38,13 +39,36 @@ public:
 	bool bEarlyExit = true;
 	PCGExClusters::FCluster* Cluster = nullptr;
 
+	/** Packed adjacency grabbed from the cluster in PrepareForCluster; neighbor walks read this instead of FNode::Links. */
+	TSharedPtr<PCGExClusters::FFlatAdjacency> Adjacency;
+
 	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster);
+
+	/** Called once the heuristics handler is ready for the cluster (static scores baked, if they were going to be).
+	 * Lets operations derive per-cluster data from edge scores before any query runs. */
+	virtual void PrepareForHeuristics(const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics);
+
 	virtual bool ResolveQuery(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
 
+	/** Whether ResolveQueryBatch grows a single shared tree for same-seed queries, rather than resolving them one by one. */
+	virtual bool SupportsQueryBatch() const { return false; }
+
+	/**
+	 * Resolves a group of queries that all share the same seed node.
+	 * Operations supporting batching grow one shortest-path tree from the seed until every goal is settled, then walk
+	 * each goal back through the shared TravelStack; others fall back to per-query ResolveQuery.
+	 * Shared trees are only valid when Heuristics->HasGoalIndependentEdgeScores(). Successful queries get their path nodes
+	 * appended in goal-to-seed order, exactly as ResolveQuery does.
+	 */
+	virtual void ResolveQueryBatch(
+		const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const;
+
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const;
 
 	/** Grabs allocations from the pool, or creates new ones if the pool is empty. Thread-safe.
@@ -171,6 +171,11 @@ namespace PCGExBlendPath
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
+		TArray<int32> TargetIndices;
+		TArray<double> Alphas;
+		TargetIndices.Reserve(Scope.Count);
+		Alphas.Reserve(Scope.Count);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			if ((Index == 0 && !Settings->bBlendFirstPoint) || (Index == MaxIndex && !Settings->bBlendLastPoint))
@@ -193,8 +198,16 @@ namespace PCGExBlendPath
 				Alpha = LerpGetter->Read(Index);
 			}
 
-			BlendOpsManager->Blend(Start, End, Index, Alpha);
+			TargetIndices.Add(Index);
+			Alphas.Add(Alpha);
 		}
+
+		TArray<int32> StartIndices;
+		TArray<int32> EndIndices;
+		StartIndices.Init(Start, TargetIndices.Num());
+		EndIndices.Init(End, TargetIndices.Num());
+
+		BlendOpsManager->BlendRange(StartIndices, EndIndices, TargetIndices, Alphas);
 	}
 
 	void FProcessor::CompleteWork()
@@ -930,7 +930,8 @@ namespace PCGExPathInsert
 			}
 		}
 
-		// Process edge inserts in parallel
+		// Process edge inserts in parallel; insert counts per edge can be very uneven
+		LoopScheduling = PCGExMT::EScheduling::WorkStealing;
 		StartParallelLoopForRange(Path->NumEdges);
 	}
 
@@ -276,12 +276,20 @@ namespace PCGExResamplePath
 		}
 		else
 		{
-			TArray<PCGEx::FOpStats> Trackers;
-			MetadataBlender->InitTrackers(Trackers);
+			// Collected per scope, then blended attribute by attribute in a single range call
+			TArray<int32> StartIndices;
+			TArray<int32> EndIndices;
+			TArray<int32> TargetIndices;
+			TArray<double> Weights;
+			StartIndices.SetNumUninitialized(Scope.Count);
+			EndIndices.SetNumUninitialized(Scope.Count);
+			TargetIndices.SetNumUninitialized(Scope.Count);
+			Weights.SetNumUninitialized(Scope.Count);
 
 			PCGEX_SCOPE_LOOP(Index)
 			{
 				const FPointSample& Sample = Samples[Index];
+				const int32 i = Index - Scope.Start;
 
 				OutTransforms[Index].SetLocation(Sample.Location);
 
@@ -295,8 +303,10 @@ namespace PCGExResamplePath
 
 				//if (SourcesRange == 1)
 				//{
-				const double Weight = SampleBreadth > 0 ? FVector::Dist(Start, Sample.Location) / SampleBreadth : 0.5;
-				MetadataBlender->Blend(Sample.Start, Sample.End, Index, Weight);
+				StartIndices[i] = Sample.Start;
+				EndIndices[i] = Sample.End;
+				TargetIndices[i] = Index;
+				Weights[i] = SampleBreadth > 0 ? FVector::Dist(Start, Sample.Location) / SampleBreadth : 0.5;
 				//}
 
 				/*
@@ -318,6 +328,8 @@ namespace PCGExResamplePath
 				}
 				*/
 			}
+
+			MetadataBlender->BlendRange(StartIndices, EndIndices, TargetIndices, Weights);
 		}
 	}
 
@@ -15,9 +15,94 @@
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Helpers/PCGExArrayHelpers.h"
+#include "Math/VectorRegister.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExProbing
 {
+	namespace ProbingInternal
+	{
+		/** Most generators sharing one candidate gather. */
+		constexpr int32 MaxBatchSize = 32;
+
+		/** A batch stops growing once its gather box would exceed this multiple of a single query box on any axis. */
+		constexpr double MaxBatchGrowth = 2;
+
+		constexpr int32 MortonBitsPerAxis = 21;
+
+		FORCEINLINE uint64 SpreadBits(uint64 V)
+		{
+			// 21 bits -> every third bit of 63
+			V &= 0x1FFFFF;
+			V = (V | (V << 32)) & 0x1F00000000FFFF;
+			V = (V | (V << 16)) & 0x1F0000FF0000FF;
+			V = (V | (V << 8)) & 0x100F00F00F00F00F;
+			V = (V | (V << 4)) & 0x10C30C30C30C30C3;
+			V = (V | (V << 2)) & 0x1249249249249249;
+			return V;
+		}
+
+		/** Candidates gathered once for a whole batch of generators, stored SoA and padded to a multiple of 4. */
+		struct FGather
+		{
+			TArray<int32> Indices;
+			TArray<double> X;
+			TArray<double> Y;
+			TArray<double> Z;
+
+			// Per-generator kernel output
+			TArray<double> DistSquared;
+			TArray<double> BoxDist;
+
+			void Reset()
+			{
+				Indices.Reset();
+				X.Reset();
+				Y.Reset();
+				Z.Reset();
+			}
+
+			FORCEINLINE void Add(const int32 Index, const FVector& Position)
+			{
+				Indices.Add(Index);
+				X.Add(Position.X);
+				Y.Add(Position.Y);
+				Z.Add(Position.Z);
+			}
+
+			void Finalize()
+			{
+				const int32 Padded = Align(Indices.Num(), 4);
+				X.SetNumZeroed(Padded);
+				Y.SetNumZeroed(Padded);
+				Z.SetNumZeroed(Padded);
+				DistSquared.SetNumUninitialized(Padded);
+				BoxDist.SetNumUninitialized(Padded);
+			}
+
+			/**
+			 * Squared distance and Chebyshev distance from Origin to every gathered position, four at a time.
+			 * Same operation order as FVector::DistSquared, so distances match the scalar path bit for bit.
+			 */
+			void Compute(const FVector& Origin)
+			{
+				const VectorRegister4Double OX = VectorSetFloat1(Origin.X);
+				const VectorRegister4Double OY = VectorSetFloat1(Origin.Y);
+				const VectorRegister4Double OZ = VectorSetFloat1(Origin.Z);
+
+				for (int32 j = 0; j < X.Num(); j += 4)
+				{
+					const VectorRegister4Double DX = VectorSubtract(VectorLoad(X.GetData() + j), OX);
+					const VectorRegister4Double DY = VectorSubtract(VectorLoad(Y.GetData() + j), OY);
+					const VectorRegister4Double DZ = VectorSubtract(VectorLoad(Z.GetData() + j), OZ);
+
+					VectorStore(VectorAdd(VectorAdd(VectorMultiply(DX, DX), VectorMultiply(DY, DY)), VectorMultiply(DZ, DZ)), DistSquared.GetData() + j);
+					VectorStore(VectorMax(VectorMax(VectorAbs(DX), VectorAbs(DY)), VectorAbs(DZ)), BoxDist.GetData() + j);
+				}
+			}
+		};
+	}
+
 	FProbingEngine::FProbingEngine(const TSharedRef<PCGExData::FFacade>& InDataFacade)
 		: DataFacade(InDataFacade)
 	{
@@ -150,7 +235,8 @@ namespace PCGExProbing
 
 		if (HasLocalWork())
 		{
-			const TSharedPtr<PCGExMT::FTaskGroup> LocalTask = InTaskManager ? InTaskManager->TryCreateTaskGroup(FName(TEXT("ProbingLocal"))) : nullptr;
+			// No generators means no local work; an empty loop would never complete
+			const TSharedPtr<PCGExMT::FTaskGroup> LocalTask = InTaskManager && !QueryOrder.IsEmpty() ? InTaskManager->TryCreateTaskGroup(FName(TEXT("ProbingLocal"))) : nullptr;
 			if (LocalTask)
 			{
 				LocalTask->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
@@ -171,7 +257,7 @@ namespace PCGExProbing
 					This->AdvanceRun();
 				};
 
-				LocalTask->StartSubLoops(NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
+				LocalTask->StartSubLoops(QueryOrder.Num(), PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 			}
 			else
 			{
@@ -248,7 +334,22 @@ namespace PCGExProbing
 				}
 			});
 
-		if (bWantsOctree)
+		if (bWantsOctree && PCGExSpatial::UseFlatIndex())
+		{
+			FlatIndex = MakeUnique<PCGExSpatial::FFlatIndex>();
+			FlatIndex->BuildPoints(
+				NumPoints, [&](const int32 i, FVector& OutPosition)
+				{
+					OutPosition = WorkingPositions[i];
+					return static_cast<bool>(AcceptConnections[i]);
+				});
+
+			for (const TSharedPtr<FPCGExProbeOperation>& Operation : AllOperations)
+			{
+				Operation->FlatIndex = FlatIndex.Get();
+			}
+		}
+		else if (bWantsOctree)
 		{
 			const FBox B = PointData->GetBounds();
 			Octree = MakeUnique<PCGExOctree::FItemOctree>(bUseProjection ? ProjectionDetails.ProjectFlat(B.GetCenter()) : B.GetCenter(), B.GetExtent().Length());
@@ -270,6 +371,67 @@ namespace PCGExProbing
 				Operation->Octree = Octree.Get();
 			}
 		}
+
+		PrepareQueryOrder();
+	}
+
+	void FProbingEngine::PrepareQueryOrder()
+	{
+		QueryOrder.Reset();
+
+		if (bOnlyGlobalOps)
+		{
+			return;
+		}
+
+		QueryOrder.Reserve(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (CanGenerate[i])
+			{
+				QueryOrder.Add(i);
+			}
+		}
+
+		if (RadiusSources.IsEmpty() || QueryOrder.Num() <= ProbingInternal::MaxBatchSize)
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExProbing::FProbingEngine::PrepareQueryOrder);
+
+		FBox Bounds(ForceInit);
+		for (const int32 Index : QueryOrder)
+		{
+			Bounds += WorkingPositions[Index];
+		}
+
+		const FVector Size = Bounds.GetSize();
+		constexpr double MaxCell = (1 << ProbingInternal::MortonBitsPerAxis) - 1;
+		const FVector Scale(
+			Size.X > UE_SMALL_NUMBER ? MaxCell / Size.X : 0,
+			Size.Y > UE_SMALL_NUMBER ? MaxCell / Size.Y : 0,
+			Size.Z > UE_SMALL_NUMBER ? MaxCell / Size.Z : 0);
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(QueryOrder.Num());
+		PCGEX_PARALLEL_FOR(
+			QueryOrder.Num(),
+			const int32 Index = QueryOrder[i];
+			const FVector Cell = (WorkingPositions[Index] - Bounds.Min) * Scale;
+			Keys[i] = PCGEx::FIndexKey(
+				Index,
+				ProbingInternal::SpreadBits(static_cast<uint64>(Cell.X))
+				| (ProbingInternal::SpreadBits(static_cast<uint64>(Cell.Y)) << 1)
+				| (ProbingInternal::SpreadBits(static_cast<uint64>(Cell.Z)) << 2));
+		)
+
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		for (int32 i = 0; i < Keys.Num(); i++)
+		{
+			QueryOrder[i] = Keys[i].Index;
+		}
 	}
 
 	void FProbingEngine::PrepareScopes(const TArray<PCGExMT::FScope>& Loops)
@@ -304,43 +466,30 @@ namespace PCGExProbing
 
 		const TArray<int32>* GroupIds = RequiresEdgePostFilter() ? PointGroupIds : nullptr;
 		const bool bWantsSameGroup = EdgeRelation == EEdgeRelation::SameGroup;
+		const bool bHasRadiusSources = !RadiusSources.IsEmpty();
 
-		FVector Origin = FVector::ZeroVector;
-		int32 CurrentIndex = 0;
-		int32 CurrentGroupId = -1;
+		ProbingInternal::FGather Gather;
+		double BatchRadii[ProbingInternal::MaxBatchSize];
 
-		auto ProcessPoint = [&](const PCGExOctree::FItem& InPositionRef)
+		// Raw world units, not squared -- this sizes the index query box. SharedSearchRadius is
+		// already raw, so the variable branch must read raw radii too.
+		auto GetMaxRadius = [&](const int32 Index)
 		{
-			const int32 OtherPointIndex = InPositionRef.Index;
-			if (OtherPointIndex == CurrentIndex)
+			if (!bUseVariableRadius)
 			{
-				return;
+				return SharedSearchRadius;
 			}
-			if (GroupIds && (((*GroupIds)[OtherPointIndex] == CurrentGroupId) != bWantsSameGroup))
-			{
-				return;
-			}
-
-			const FVector Position = WorkingPositions[OtherPointIndex];
-			const FVector Dir = (Origin - Position).GetSafeNormal();
-			const int32 EmplaceIndex = Candidates.Emplace(OtherPointIndex, Dir, FVector::DistSquared(Position, Origin), bPreventCoincidence ? PCGEx::SH3(Dir, CWCoincidenceTolerance) : 0);
 
-			if (NumChainedOps > 0)
+			double MaxRadius = 0;
+			for (int i = 0; i < NumRadiusSources; i++)
 			{
-				for (int i = 0; i < NumChainedOps; i++)
-				{
-					ChainedOperations[i]->ProcessCandidateChained(i, EmplaceIndex, Candidates[EmplaceIndex], BestCandidates[i], ChainedOpsContainers[i].Get());
-				}
+				MaxRadius = FMath::Max(MaxRadius, RadiusSources[i]->GetSearchRadiusRaw(Index));
 			}
+			return MaxRadius;
 		};
 
-		for (int Index = Scope.Start; Index < Scope.End; Index++)
+		auto ProcessQuery = [&](const int32 Index, const double MaxRadius)
 		{
-			if (!CanGenerate[Index])
-			{
-				continue;
-			} // Not a generator
-
 #define PCGEX_SCOPED_CONTAINERS_RESET(_NAME) for (const TSharedPtr<PCGExMT::FScopedContainer>& Container : _NAME##OpsContainers){ if(Container){ Container->Reset(); } }
 
 			PCGEX_SCOPED_CONTAINERS_RESET(Chained)
@@ -349,11 +498,7 @@ namespace PCGExProbing
 
 #undef PCGEX_SCOPED_CONTAINERS_RESET
 
-			CurrentIndex = Index;
-			if (GroupIds)
-			{
-				CurrentGroupId = (*GroupIds)[Index];
-			}
+			const int32 CurrentGroupId = GroupIds ? (*GroupIds)[Index] : -1;
 			Candidates.Reset();
 
 			if (LocalCoincidence)
@@ -370,27 +515,34 @@ namespace PCGExProbing
 				}
 			}
 
-			if (!RadiusSources.IsEmpty())
+			if (bHasRadiusSources)
 			{
-				// Raw world units, not squared -- this sizes the octree query box. SharedSearchRadius is
-				// already raw, so the variable branch must read raw radii too.
-				double MaxRadius = 0;
-				if (!bUseVariableRadius)
-				{
-					MaxRadius = SharedSearchRadius;
-				}
-				else
+				const FVector Origin = WorkingPositions[Index];
+				Gather.Compute(Origin);
+
+				// Keep what this generator's own query box would have found
+				const int32 NumGathered = Gather.Indices.Num();
+				for (int32 j = 0; j < NumGathered; j++)
 				{
-					for (int i = 0; i < NumRadiusSources; i++)
+					const int32 OtherPointIndex = Gather.Indices[j];
+					if (OtherPointIndex == Index || Gather.BoxDist[j] > MaxRadius)
 					{
-						MaxRadius = FMath::Max(MaxRadius, RadiusSources[i]->GetSearchRadiusRaw(Index));
+						continue;
+					}
+					if (GroupIds && (((*GroupIds)[OtherPointIndex] == CurrentGroupId) != bWantsSameGroup))
+					{
+						continue;
 					}
-				}
 
-				Origin = WorkingPositions[Index];
+					const FVector Dir = (Origin - WorkingPositions[OtherPointIndex]).GetSafeNormal();
+					const int32 EmplaceIndex = Candidates.Emplace(OtherPointIndex, Dir, Gather.DistSquared[j], bPreventCoincidence ? PCGEx::SH3(Dir, CWCoincidenceTolerance) : 0);
+
+					for (int i = 0; i < NumChainedOps; i++)
+					{
+						ChainedOperations[i]->ProcessCandidateChained(i, EmplaceIndex, Candidates[EmplaceIndex], BestCandidates[i], ChainedOpsContainers[i].Get());
+					}
+				}
 
-				// Find candidates within radius
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
 				Candidates.Sort([&](const FCandidate& A, const FCandidate& B)
 				{
 					return A.Distance < B.Distance;
@@ -411,6 +563,63 @@ namespace PCGExProbing
 			{
 				DirectOperations[i]->ProcessNode(Index, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalUniqueEdges, DirectOpsContainers[i].Get());
 			}
+		};
+
+		if (!bHasRadiusSources)
+		{
+			for (int32 q = Scope.Start; q < Scope.End; q++)
+			{
+				ProcessQuery(QueryOrder[q], 0);
+			}
+			return;
+		}
+
+		int32 BatchStart = Scope.Start;
+		while (BatchStart < Scope.End)
+		{
+			// Grow the batch along the Morton order while the shared box stays close to a single query box
+			FBox BatchBox(ForceInit);
+			int32 BatchEnd = BatchStart;
+
+			while (BatchEnd < Scope.End && BatchEnd - BatchStart < ProbingInternal::MaxBatchSize)
+			{
+				const double MaxRadius = GetMaxRadius(QueryOrder[BatchEnd]);
+				const FVector& Origin = WorkingPositions[QueryOrder[BatchEnd]];
+				const FBox QueryBox(Origin - FVector(MaxRadius), Origin + FVector(MaxRadius));
+
+				if (BatchEnd > BatchStart)
+				{
+					const FVector GrownSize = (BatchBox + QueryBox).GetSize();
+					const double Limit = QueryBox.GetSize().X * ProbingInternal::MaxBatchGrowth;
+					if (GrownSize.X > Limit || GrownSize.Y > Limit || GrownSize.Z > Limit)
+					{
+						break;
+					}
+				}
+
+				BatchBox += QueryBox;
+				BatchRadii[BatchEnd - BatchStart] = MaxRadius;
+				BatchEnd++;
+			}
+
+			// One gather for the whole batch
+			Gather.Reset();
+			if (FlatIndex)
+			{
+				FlatIndex->FindElementsWithBoundsTest(BatchBox, [&](const int32 Other) { Gather.Add(Other, WorkingPositions[Other]); });
+			}
+			else
+			{
+				Octree->FindElementsWithBoundsTest(BatchBox, [&](const PCGExOctree::FItem& Item) { Gather.Add(Item.Index, WorkingPositions[Item.Index]); });
+			}
+			Gather.Finalize();
+
+			for (int32 q = BatchStart; q < BatchEnd; q++)
+			{
+				ProcessQuery(QueryOrder[q], BatchRadii[q - BatchStart]);
+			}
+
+			BatchStart = BatchEnd;
 		}
 	}
 
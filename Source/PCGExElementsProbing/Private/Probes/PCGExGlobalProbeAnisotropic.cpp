@@ -111,11 +111,10 @@ void FPCGExProbeGlobalAnisotropic::ProcessAll(TSet<uint64>& OutEdges) const
 		// Collect candidates with GlobalAnisotropic distance
 		TArray<TPair<double, int32>> Candidates;
 
-		Octree->FindElementsWithBoundsTest(
+		FindPointsInBox(
 			FBox(Pos - FVector(LocalSearchRadius), Pos + FVector(LocalSearchRadius)),
-			[&](const PCGExOctree::FItem& Other)
+			[&](const int32 j)
 			{
-				const int32 j = Other.Index;
 				if (i == j || !AcceptConnectionsRef[j])
 				{
 					return;
@@ -73,11 +73,10 @@ void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
 		const double MaxDistSq = GetSearchRadius(i);
 		const double MaxDist = FMath::Sqrt(MaxDistSq);
 
-		Octree->FindElementsWithBoundsTest(
+		FindPointsInBox(
 			FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
+			[&](const int32 j)
 			{
-				const int32 j = Other.Index;
 				if (i == j)
 				{
 					return;
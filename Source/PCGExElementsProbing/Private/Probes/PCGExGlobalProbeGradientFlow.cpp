@@ -92,11 +92,10 @@ void FPCGExProbeGradientFlow::ProcessAll(TSet<uint64>& OutEdges) const
 		const FVector Pos = Positions[i];
 		const double CurrentFlow = FlowBuffer->Read(i);
 
-		Octree->FindElementsWithBoundsTest(
+		FindPointsInBox(
 			FBox(Positions[i] + FVector(-MaxDist), Positions[i] + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
+			[&](const int32 OtherIndex)
 			{
-				const int32 OtherIndex = Other.Index;
 				if (i == OtherIndex || !AcceptConnectionsRef[OtherIndex])
 				{
 					return;
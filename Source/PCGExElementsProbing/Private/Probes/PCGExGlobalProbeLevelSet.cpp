@@ -106,11 +106,10 @@ void FPCGExProbeLevelSet::ProcessAll(TSet<uint64>& OutEdges) const
 		// Collect candidates within level tolerance
 		TArray<TPair<double, int32>> Candidates;
 
-		Octree->FindElementsWithBoundsTest(
+		FindPointsInBox(
 			FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
+			[&](const int32 j)
 			{
-				const int32 j = Other.Index;
 				if (i == j || !AcceptConnectionsRef[j])
 				{
 					return;
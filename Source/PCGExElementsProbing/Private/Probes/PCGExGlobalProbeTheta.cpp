@@ -94,11 +94,10 @@ void FPCGExProbeTheta::ProcessAll(TSet<uint64>& OutEdges) const
 		BestPerCone.Init(INDEX_NONE, Config.NumCones);
 		BestDistPerCone.Init(TNumericLimits<double>::Max(), Config.NumCones);
 
-		Octree->FindElementsWithBoundsTest(
+		FindPointsInBox(
 			FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
+			[&](const int32 j)
 			{
-				const int32 j = Other.Index;
 				if (i == j || !AcceptConnectionsRef[j])
 				{
 					return;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExFlatIndex.h"
 #include "PCGExOctree.h"
 #include "Data/PCGExDataHelpers.h"
 #include "Details/PCGExSettingsMacros.h"
@@ -107,6 +108,20 @@ public:
 
 	FPCGExProbeConfigBase* BaseConfig = nullptr;
 	const PCGExOctree::FItemOctree* Octree = nullptr;
+	const PCGExSpatial::FFlatIndex* FlatIndex = nullptr; // Set instead of Octree when pcgex.SpatialIndex.Flat is on
+
+	/** Calls Func(PointIndex) for every connectable point inside InBox, through whichever index the engine built. */
+	template <typename FuncType>
+	void FindPointsInBox(const FBox& InBox, FuncType&& Func) const
+	{
+		if (FlatIndex)
+		{
+			FlatIndex->FindElementsWithBoundsTest(InBox, Func);
+			return;
+		}
+
+		Octree->FindElementsWithBoundsTest(InBox, [&](const PCGExOctree::FItem& Item) { Func(Item.Index); });
+	}
 	const TArray<FTransform>* WorkingTransforms = nullptr;
 	const TArray<FVector>* WorkingPositions = nullptr;
 	const TArray<int8>* CanGenerate = nullptr;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExFlatIndex.h"
 #include "PCGExOctree.h"
 #include "Math/PCGExProjectionDetails.h"
 #include "UObject/ObjectPtr.h"
@@ -52,6 +53,10 @@ namespace PCGExProbing
 	 * completion callback exactly once on the worker that finishes last. Callers never touch the
 	 * per-phase steps directly - keeping the completion/ordering contract in one place.
 	 *
+	 * Radius queries are batched: generators are visited in Morton order, runs of nearby generators
+	 * share a single index gather into SoA buffers, and each one filters that shared set with a
+	 * 4-wide distance kernel before its candidates reach the probes.
+	 *
 	 * With a group constraint (EEdgeRelation != Any), radius-based probes exclude non-matching
 	 * candidates at gathering time (so "closest"-style probes re-pick), while direct & global probe
 	 * outputs are post-filtered on accumulation - those probes name explicit targets and cannot re-pick.
@@ -114,10 +119,14 @@ namespace PCGExProbing
 		double SharedSearchRadius = 0;
 
 		TUniquePtr<PCGExOctree::FItemOctree> Octree;
+		TUniquePtr<PCGExSpatial::FFlatIndex> FlatIndex;
 
 		TArray<FTransform> WorkingTransforms;
 		TArray<FVector> WorkingPositions;
 
+		/** Generator indices, sorted along a Morton curve when radius probes run so neighbouring queries can share a gather. Local loops iterate this. */
+		TArray<int32> QueryOrder;
+
 		mutable FRWLock UniqueEdgesLock;
 		TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges;
 		TSet<uint64> UniqueEdges;
@@ -137,6 +146,7 @@ namespace PCGExProbing
 		bool HasGlobalWork() const { return !GlobalOperations.IsEmpty(); }
 
 		void PrepareWorkingData();
+		void PrepareQueryOrder();
 		void PrepareScopes(const TArray<PCGExMT::FScope>& Loops);
 		void ProcessScope(const PCGExMT::FScope& Scope);
 		void CollapseScopedEdges();
@@ -226,9 +226,9 @@ namespace PCGExFusePoints
 		{
 			// Octree-mode dedup is order-dependent: FindOrInsert mutates the running octree and
 			// running-centers, so concurrent calls would race AND produce non-deterministic insertion order.
-			// Sequential single-thread is the only deterministic option with the current FUnionRegistry.
-			// (Lifting this requires a separate parallel-octree-merge util.)
-			bForceSingleThreadedProcessPoints = true;
+			// Sequential single-thread is the only deterministic option for FindOrInsert. The parallel
+			// variant only fetches during the loop, and fuses the whole batch in CompleteWork.
+			bForceSingleThreadedProcessPoints = !FuseDetailsCopy.UseParallelOctree();
 
 			Registry = MakeShared<PCGExData::FUnionRegistry>(PointDataFacade->GetIn()->GetBounds().ExpandBy(10.0));
 			Registry->Reserve(NumIn);
@@ -281,7 +281,7 @@ namespace PCGExFusePoints
 				UnionTableBuilder->Emit(Scope.LoopIndex, Key, IOIndex, Index);
 			}
 		}
-		else
+		else if (!FuseDetailsCopy.UseParallelOctree())
 		{
 			// Octree: single scope, single-threaded by force flag. Sequential dedup against Registry.
 			PCGEX_SCOPE_LOOP(Index)
@@ -421,6 +421,27 @@ namespace PCGExFusePoints
 	{
 		// Finalize the build phase: compile the per-scope records into the immutable, packed FUnionTable.
 		check(UnionTableBuilder);
+
+		if (EffectiveMethod == EPCGExFuseMethod::Octree && FuseDetailsCopy.UseParallelOctree())
+		{
+			const int32 NumIn = PointDataFacade->GetNum();
+
+			TArray<PCGExData::FConstPoint> Points;
+			Points.SetNumUninitialized(NumIn);
+			for (int32 Index = 0; Index < NumIn; Index++)
+			{
+				Points[Index] = PointDataFacade->GetInPoint(Index);
+			}
+
+			TArray<int32> RepIndices;
+			Registry->FuseParallel(Points, FuseDetailsCopy, RepIndices);
+
+			for (int32 Index = 0; Index < NumIn; Index++)
+			{
+				UnionTableBuilder->Emit(0, static_cast<uint64>(RepIndices[Index]), IOIndex, Index);
+			}
+		}
+
 		UnionTableBuilder->Compile(*UnionTable);
 		UnionTableBuilder.Reset();
 		Registry.Reset();
@@ -0,0 +1,221 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExTensorBake.h"
+
+#include "Async/ParallelFor.h"
+
+namespace PCGExTensor
+{
+	namespace
+	{
+		FORCEINLINE int32 FloorDiv(const int32 A, const int32 B)
+		{
+			return A >= 0 ? A / B : (A - B + 1) / B;
+		}
+
+		FORCEINLINE FIntVector BrickOf(const FIntVector& InCoord)
+		{
+			return FIntVector(
+				FloorDiv(InCoord.X, FBakedField::BrickSize),
+				FloorDiv(InCoord.Y, FBakedField::BrickSize),
+				FloorDiv(InCoord.Z, FBakedField::BrickSize));
+		}
+
+		// Fills the per-axis weights for the nodes at Floor + Offset .. Floor + Offset + Num - 1
+		FORCEINLINE void AxisWeights(const EPCGExTensorBakeInterpolation Mode, const double T, double* OutWeights)
+		{
+			if (Mode == EPCGExTensorBakeInterpolation::Tricubic)
+			{
+				// Catmull-Rom
+				const double T2 = T * T;
+				const double T3 = T2 * T;
+				OutWeights[0] = 0.5 * (-T3 + 2 * T2 - T);
+				OutWeights[1] = 0.5 * (3 * T3 - 5 * T2 + 2);
+				OutWeights[2] = 0.5 * (-3 * T3 + 4 * T2 + T);
+				OutWeights[3] = 0.5 * (T3 - T2);
+			}
+			else
+			{
+				OutWeights[0] = 1 - T;
+				OutWeights[1] = T;
+			}
+		}
+	}
+
+	FBakedField::FBakedField(const FPCGExTensorBakeDetails& InDetails)
+		: VoxelSize(FMath::Max(0.01, InDetails.VoxelSize))
+		  , InvVoxelSize(1 / VoxelSize)
+		  , Interpolation(InDetails.Interpolation)
+		  , MaxNodes(FMath::Max(BrickNodes, InDetails.MaxNodes))
+	{
+	}
+
+	bool FBakedField::AddInfluence(const FBox& InBounds)
+	{
+		// Interpolation reads one node past the cell for trilinear, one more on each side for tricubic
+		const int32 Before = Interpolation == EPCGExTensorBakeInterpolation::Tricubic ? 1 : 0;
+		const int32 After = Interpolation == EPCGExTensorBakeInterpolation::Tricubic ? 2 : 1;
+
+		const FVector MinLocal = InBounds.Min * InvVoxelSize;
+		const FVector MaxLocal = InBounds.Max * InvVoxelSize;
+
+		// Reject up-front in floating point so oversized bounds can neither overflow coordinates nor loop for ages
+		const FVector BrickSpan = (MaxLocal - MinLocal) / BrickSize + FVector(2);
+		if (BrickSpan.X * BrickSpan.Y * BrickSpan.Z * BrickNodes > MaxNodes)
+		{
+			return false;
+		}
+
+		const FIntVector MinBrick = BrickOf(FIntVector(FMath::FloorToInt(MinLocal.X), FMath::FloorToInt(MinLocal.Y), FMath::FloorToInt(MinLocal.Z)) - FIntVector(Before));
+		const FIntVector MaxBrick = BrickOf(FIntVector(FMath::FloorToInt(MaxLocal.X), FMath::FloorToInt(MaxLocal.Y), FMath::FloorToInt(MaxLocal.Z)) + FIntVector(After));
+
+		for (int32 Z = MinBrick.Z; Z <= MaxBrick.Z; Z++)
+		{
+			for (int32 Y = MinBrick.Y; Y <= MaxBrick.Y; Y++)
+			{
+				for (int32 X = MinBrick.X; X <= MaxBrick.X; X++)
+				{
+					const FIntVector Brick(X, Y, Z);
+					if (BrickLookup.Contains(Brick))
+					{
+						continue;
+					}
+
+					if (Nodes.Num() + BrickNodes > MaxNodes)
+					{
+						return false;
+					}
+
+					BrickLookup.Add(Brick, BrickCoords.Add(Brick));
+					Nodes.AddDefaulted(BrickNodes);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FBakedField::Bake(TFunctionRef<FTensorSample(const FVector&)> InSampleFn)
+	{
+		ParallelFor(
+			BrickCoords.Num(), [&](const int32 BrickIndex)
+			{
+				const FIntVector Origin = BrickCoords[BrickIndex] * BrickSize;
+				FNode* BrickData = Nodes.GetData() + BrickIndex * BrickNodes;
+
+				int32 i = 0;
+				for (int32 Z = 0; Z < BrickSize; Z++)
+				{
+					for (int32 Y = 0; Y < BrickSize; Y++)
+					{
+						for (int32 X = 0; X < BrickSize; X++)
+						{
+							const FIntVector Coord = Origin + FIntVector(X, Y, Z);
+							const FTensorSample S = InSampleFn(FVector(Coord.X, Coord.Y, Coord.Z) * VoxelSize);
+
+							FNode& Node = BrickData[i++];
+							if (S.Effectors == 0)
+							{
+								continue;
+							}
+
+							Node.DirectionAndSize = FVector3f(S.DirectionAndSize);
+							Node.Rotation = FQuat4f(S.Rotation);
+							Node.Effectors = S.Effectors;
+							Node.Weight = S.Weight;
+						}
+					}
+				}
+			});
+	}
+
+	const FBakedField::FNode* FBakedField::GetNode(const FIntVector& InCoord) const
+	{
+		const FIntVector Brick = BrickOf(InCoord);
+		const int32* BrickIndex = BrickLookup.Find(Brick);
+		if (!BrickIndex)
+		{
+			return nullptr;
+		}
+
+		const FIntVector Local = InCoord - Brick * BrickSize;
+		return Nodes.GetData() + *BrickIndex * BrickNodes + (Local.Z * BrickSize + Local.Y) * BrickSize + Local.X;
+	}
+
+	FTensorSample FBakedField::Sample(const FVector& InPosition) const
+	{
+		const FVector Local = InPosition * InvVoxelSize;
+		const FIntVector Cell(FMath::FloorToInt(Local.X), FMath::FloorToInt(Local.Y), FMath::FloorToInt(Local.Z));
+
+		const bool bCubic = Interpolation == EPCGExTensorBakeInterpolation::Tricubic;
+		const int32 Num = bCubic ? 4 : 2;
+		const FIntVector First = Cell - FIntVector(bCubic ? 1 : 0);
+
+		double WX[4];
+		double WY[4];
+		double WZ[4];
+		AxisWeights(Interpolation, Local.X - Cell.X, WX);
+		AxisWeights(Interpolation, Local.Y - Cell.Y, WY);
+		AxisWeights(Interpolation, Local.Z - Cell.Z, WZ);
+
+		FVector DirectionAndSize = FVector::ZeroVector;
+		FQuat Rotation = FQuat(0, 0, 0, 0);
+		double Effectors = 0;
+		double Weight = 0;
+
+		for (int32 Z = 0; Z < Num; Z++)
+		{
+			for (int32 Y = 0; Y < Num; Y++)
+			{
+				const double WYZ = WY[Y] * WZ[Z];
+				for (int32 X = 0; X < Num; X++)
+				{
+					const double W = WX[X] * WYZ;
+					if (W == 0)
+					{
+						continue;
+					}
+
+					// Unallocated and empty nodes contribute nothing, which fades the field out at its edges
+					const FNode* Node = GetNode(First + FIntVector(X, Y, Z));
+					if (!Node || Node->Effectors <= 0)
+					{
+						continue;
+					}
+
+					DirectionAndSize += FVector(Node->DirectionAndSize) * W;
+					Effectors += Node->Effectors * W;
+					Weight += Node->Weight * W;
+
+					// Negative cubic lobes would flip rotations around; only positive weights steer them
+					if (W > 0)
+					{
+						FQuat Q = FQuat(Node->Rotation);
+						if ((Rotation | Q) < 0)
+						{
+							Q = FQuat(-Q.X, -Q.Y, -Q.Z, -Q.W);
+						}
+						Rotation += Q * W;
+					}
+				}
+			}
+		}
+
+		if (Effectors <= UE_KINDA_SMALL_NUMBER)
+		{
+			return FTensorSample();
+		}
+
+		return FTensorSample(
+			DirectionAndSize,
+			Rotation.SizeSquared() > UE_SMALL_NUMBER ? Rotation.GetNormalized() : FQuat::Identity,
+			FMath::CeilToInt(Effectors),
+			FMath::Max(0.0, Weight));
+	}
+}
+
+PCGExTensor::FTensorSample FPCGExTensorBaked::Sample(const int32 InSeedIndex, const FTransform& InProbe) const
+{
+	return Field->Sample(InProbe.GetLocation());
+}
@@ -4,6 +4,7 @@
 #include "Core/PCGExTensorHandler.h"
 
 #include "Containers/PCGExManagedObjects.h"
+#include "Core/PCGExTensorBake.h"
 #include "Core/PCGExTensorFactoryProvider.h"
 #include "Core/PCGExTensorOperation.h"
 #include "UObject/Package.h"
@@ -24,8 +25,54 @@ void FPCGExTensorHandlerDetails::RenamePins(const UPCGSettings* InSettings, UPCG
 
 namespace PCGExTensor
 {
-	FTensorsHandler::FTensorsHandler(const FPCGExTensorHandlerDetails& InConfig)
-		: Config(InConfig)
+	FBakedFieldCache::FKey::FKey(const TArray<TSharedPtr<PCGExTensorOperation>>& InBakedTensors, const FPCGExTensorBakeDetails& InDetails)
+		: VoxelSize(InDetails.VoxelSize), Interpolation(InDetails.Interpolation), MaxNodes(InDetails.MaxNodes)
+	{
+		// The bake always goes through the base RawSample, so the sampler class and its settings don't take part,
+		// nor do post-sampling settings (normalize, invert, scale)
+		Hash = HashCombineFast(GetTypeHash(VoxelSize), GetTypeHash(Interpolation));
+		Hash = HashCombineFast(Hash, GetTypeHash(MaxNodes));
+
+		Factories.Reserve(InBakedTensors.Num());
+		for (const TSharedPtr<PCGExTensorOperation>& Op : InBakedTensors)
+		{
+			const TObjectKey<UPCGExTensorFactoryData>& FactoryKey = Factories.Emplace_GetRef(Op->Factory.Get());
+			Hash = HashCombineFast(Hash, GetTypeHash(FactoryKey));
+		}
+	}
+
+	TSharedPtr<FBakedField> FBakedFieldCache::FindOrBake(const FKey& InKey, TFunctionRef<TSharedPtr<FBakedField>()> InBakeFn)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (FailedKeys.Contains(InKey))
+		{
+			return nullptr;
+		}
+
+		if (const TWeakPtr<FBakedField>* Cached = Fields.Find(InKey))
+		{
+			if (TSharedPtr<FBakedField> Field = Cached->Pin())
+			{
+				return Field;
+			}
+		}
+
+		TSharedPtr<FBakedField> Field = InBakeFn();
+		if (Field)
+		{
+			Fields.Add(InKey, Field);
+		}
+		else
+		{
+			FailedKeys.Add(InKey);
+		}
+
+		return Field;
+	}
+
+	FTensorsHandler::FTensorsHandler(const FPCGExTensorHandlerDetails& InConfig, const TSharedPtr<FBakedFieldCache>& InBakeCache)
+		: Config(InConfig), BakeCache(InBakeCache)
 	{
 	}
 
@@ -81,7 +128,85 @@ namespace PCGExTensor
 		SamplerInstance->ErrorTolerance = Config.SamplerSettings.ErrorTolerance;
 		SamplerInstance->MaxSubSteps = Config.SamplerSettings.MaxSubSteps;
 
-		return SamplerInstance->PrepareForData(InContext);
+		if (!SamplerInstance->PrepareForData(InContext))
+		{
+			return false;
+		}
+
+		if (Config.BakeSettings.bEnabled)
+		{
+			BakeTensors(InContext);
+		}
+
+		return true;
+	}
+
+	void FTensorsHandler::BakeTensors(FPCGExContext* InContext)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FTensorsHandler::BakeTensors);
+
+		TArray<TSharedPtr<PCGExTensorOperation>> BakedTensors;
+		TArray<TSharedPtr<PCGExTensorOperation>> LiveTensors;
+
+		for (const TSharedPtr<PCGExTensorOperation>& Op : Tensors)
+		{
+			if (Op->CanBake() && Op->Effectors && Op->Effectors->Num() > 0)
+			{
+				BakedTensors.Add(Op);
+			}
+			else
+			{
+				LiveTensors.Add(Op);
+			}
+		}
+
+		if (BakedTensors.IsEmpty())
+		{
+			return;
+		}
+
+		auto BakeField = [&]() -> TSharedPtr<FBakedField>
+		{
+			PCGEX_MAKE_SHARED(Field, FBakedField, Config.BakeSettings)
+
+			for (const TSharedPtr<PCGExTensorOperation>& Op : BakedTensors)
+			{
+				for (int32 i = 0; i < Op->Effectors->Num(); i++)
+				{
+					const FPackedEffector& Effector = Op->Effectors->GetPackedEffector(i);
+					const FVector Extent = FVector(FMath::Sqrt(Effector.RadiusSquared));
+
+					if (!Field->AddInfluence(FBox(Effector.Location - Extent, Effector.Location + Extent)))
+					{
+						PCGE_LOG_C(Warning, GraphAndLog, InContext, FTEXT("Tensor bake would exceed the max node budget; tensors will be sampled live instead. Try a larger voxel size."));
+						return nullptr;
+					}
+				}
+			}
+
+			// Bake the exact same blend the sampler would have performed live, minus anything orientation-dependent.
+			// The baked result then takes part in the regular blend as a single tensor.
+			const UPCGExTensorSampler* Sampler = SamplerInstance;
+			Field->Bake(
+				[&](const FVector& InPosition)
+				{
+					return Sampler->UPCGExTensorSampler::RawSample(BakedTensors, 0, FTransform(InPosition));
+				});
+
+			return Field;
+		};
+
+		const TSharedPtr<FBakedField> Field = BakeCache ? BakeCache->FindOrBake(FBakedFieldCache::FKey(BakedTensors, Config.BakeSettings), BakeField) : BakeField();
+		if (!Field)
+		{
+			return;
+		}
+
+		PCGEX_MAKE_SHARED(BakedOp, FPCGExTensorBaked)
+		BakedOp->Field = Field;
+		LiveTensors.Add(BakedOp);
+
+		Tensors = MoveTemp(LiveTensors);
 	}
 
 	bool FTensorsHandler::Init(FPCGExContext* InContext, const FName InPin, const TSharedPtr<PCGExData::FFacade>& InDataFacade)
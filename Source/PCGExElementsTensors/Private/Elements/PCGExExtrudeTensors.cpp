@@ -265,7 +265,7 @@ namespace PCGExExtrudeTensors
 		InitExtrusionConfigFromSettings(Context->ExtrusionConfig, Context, Settings, StopFilters.IsValid());
 
 		// Initialize tensor handler
-		TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(Settings->TensorHandlerDetails);
+		TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(Settings->TensorHandlerDetails, Context->TensorBakeCache);
 		if (!TensorsHandler->Init(Context, Context->TensorFactories, PointDataFacade))
 		{
 			return false;
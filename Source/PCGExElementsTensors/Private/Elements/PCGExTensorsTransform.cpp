@@ -137,7 +137,7 @@ namespace PCGExTensorsTransform
 			}
 		}
 
-		TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(Settings->TensorHandlerDetails);
+		TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(Settings->TensorHandlerDetails, Context->TensorBakeCache);
 		if (!TensorsHandler->Init(Context, Context->TensorFactories, PointDataFacade))
 		{
 			return false;
@@ -15,7 +15,7 @@
 void FPCGExHeuristicTensor::PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster)
 {
 	FPCGExHeuristicOperation::PrepareForCluster(InCluster);
-	TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(TensorHandlerDetails);
+	TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(TensorHandlerDetails, BakeCache);
 	TensorsHandler->Init(Context, *TensorFactories, PrimaryDataFacade);
 }
 
@@ -48,6 +48,7 @@ TSharedPtr<FPCGExHeuristicOperation> UPCGExHeuristicsFactoryTensor::CreateOperat
 	NewOperation->bAbsoluteTensor = Config.bAbsolute;
 	NewOperation->TensorHandlerDetails = Config.TensorHandlerDetails;
 	NewOperation->TensorFactories = &TensorFactories;
+	NewOperation->BakeCache = BakeCache;
 	return NewOperation;
 }
 
@@ -70,6 +71,8 @@ PCGExFactories::EPreparationResult UPCGExHeuristicsFactoryTensor::Prepare(FPCGEx
 		PCGEX_LOG_MISSING_INPUT(InContext, FTEXT("Missing tensors."))
 		return PCGExFactories::EPreparationResult::Fail;
 	}
+
+	BakeCache = MakeShared<PCGExTensor::FBakedFieldCache>();
 	return Result;
 }
 
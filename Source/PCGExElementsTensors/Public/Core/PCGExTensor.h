@@ -271,6 +271,11 @@ namespace PCGExTensor
 		virtual void PrepareSinglePoint(const int32 Index, const FTransform& InTransform, FPackedEffector& OutPackedEffector);
 
 	public:
+		FORCEINLINE int32 Num() const
+		{
+			return PackedEffectors.Num();
+		}
+
 		FORCEINLINE const PCGExOctree::FItemOctree* GetOctree() const
 		{
 			return Octree.Get();
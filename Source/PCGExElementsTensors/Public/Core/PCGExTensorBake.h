@@ -0,0 +1,70 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExTensor.h"
+#include "PCGExTensorHandler.h"
+#include "PCGExTensorOperation.h"
+
+namespace PCGExTensor
+{
+	/**
+	 * Sparse grid of pre-computed tensor samples.
+	 * Nodes sit on a global lattice of VoxelSize spacing and are allocated in bricks of BrickSize^3,
+	 * only where an influence was registered. Unallocated nodes read as empty samples.
+	 */
+	class PCGEXELEMENTSTENSORS_API FBakedField : public TSharedFromThis<FBakedField>
+	{
+	public:
+		static constexpr int32 BrickSize = 8;
+		static constexpr int32 BrickNodes = BrickSize * BrickSize * BrickSize;
+
+		struct FNode
+		{
+			FVector3f DirectionAndSize = FVector3f::ZeroVector;
+			FQuat4f Rotation = FQuat4f::Identity;
+			float Effectors = 0;
+			float Weight = 0;
+		};
+
+		explicit FBakedField(const FPCGExTensorBakeDetails& InDetails);
+
+		/** Allocates the bricks covering the given bounds. Returns false if that would exceed the node budget. */
+		bool AddInfluence(const FBox& InBounds);
+
+		/** Fills every allocated node. InSampleFn is called concurrently. */
+		void Bake(TFunctionRef<FTensorSample(const FVector&)> InSampleFn);
+
+		FTensorSample Sample(const FVector& InPosition) const;
+
+		FORCEINLINE int32 NumNodes() const
+		{
+			return Nodes.Num();
+		}
+
+	protected:
+		double VoxelSize = 50;
+		double InvVoxelSize = 0.02;
+		EPCGExTensorBakeInterpolation Interpolation = EPCGExTensorBakeInterpolation::Trilinear;
+		int32 MaxNodes = 0;
+
+		TMap<FIntVector, int32> BrickLookup;
+		TArray<FIntVector> BrickCoords;
+		TArray<FNode> Nodes;
+
+		const FNode* GetNode(const FIntVector& InCoord) const;
+	};
+}
+
+/**
+ * Stands in for every bakeable tensor of a handler, and samples them from a pre-computed grid.
+ */
+class PCGEXELEMENTSTENSORS_API FPCGExTensorBaked : public PCGExTensorOperation
+{
+public:
+	TSharedPtr<PCGExTensor::FBakedField> Field;
+
+	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const override;
+};
@@ -6,6 +6,7 @@
 #include "Core/PCGExTensorSampler.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Details/PCGExInputShorthandsDetails.h"
+#include "UObject/ObjectKey.h"
 
 #include "PCGExTensorHandler.generated.h"
 
@@ -61,6 +62,43 @@ struct PCGEXELEMENTSTENSORS_API FPCGExTensorSamplerDetails
 	int32 MaxSubSteps = 4;
 };
 
+UENUM()
+enum class EPCGExTensorBakeInterpolation : uint8
+{
+	Trilinear = 0 UMETA(DisplayName = "Trilinear", ToolTip="Blends the 8 surrounding grid nodes. Fastest."),
+	Tricubic  = 1 UMETA(DisplayName = "Tricubic", ToolTip="Catmull-Rom over the 64 surrounding grid nodes. Smoother across cells, at a higher lookup cost."),
+};
+
+USTRUCT(BlueprintType)
+struct PCGEXELEMENTSTENSORS_API FPCGExTensorBakeDetails
+{
+	GENERATED_BODY()
+
+	FPCGExTensorBakeDetails()
+	{
+	}
+
+	virtual ~FPCGExTensorBakeDetails()
+	{
+	}
+
+	/** If enabled, tensors that only depend on the sampled position are rasterized once into a sparse grid and sampled from it,
+	 * instead of querying their effectors every time. Tensors that depend on the probe orientation or seed are still sampled live. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	bool bEnabled = false;
+
+	/** Grid spacing, in world units. Smaller is more accurate but bakes more nodes. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bEnabled", ClampMin=0.01))
+	double VoxelSize = 50;
+
+	/** How the grid is interpolated between nodes. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bEnabled"))
+	EPCGExTensorBakeInterpolation Interpolation = EPCGExTensorBakeInterpolation::Trilinear;
+
+	/** Maximum number of grid nodes. If the baked tensors would need more, they are sampled live instead. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bEnabled", ClampMin=512), AdvancedDisplay)
+	int32 MaxNodes = 2097152;
+};
 
 USTRUCT(BlueprintType)
 struct PCGEXELEMENTSTENSORS_API FPCGExTensorHandlerDetails
@@ -109,6 +147,10 @@ struct PCGEXELEMENTSTENSORS_API FPCGExTensorHandlerDetails
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTensorSamplerDetails SamplerSettings;
 
+	/** Optional pre-sampling of the tensor field into a grid, for nodes that sample it many times (extrusion, pathfinding heuristics). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	FPCGExTensorBakeDetails BakeSettings;
+
 #if WITH_EDITOR
 	void ApplyDeprecation();
 	void RenamePins(const UPCGSettings* InSettings, UPCGNode* InOutNode) const;
@@ -117,16 +159,66 @@ struct PCGEXELEMENTSTENSORS_API FPCGExTensorHandlerDetails
 
 namespace PCGExTensor
 {
+	class FBakedField;
+
+	/**
+	 * Shares baked fields between handlers, so that handlers created per data or per cluster from the same tensors
+	 * and bake settings bake once. Fields are held weakly and live as long as a handler samples them.
+	 */
+	class PCGEXELEMENTSTENSORS_API FBakedFieldCache : public TSharedFromThis<FBakedFieldCache>
+	{
+	public:
+		/** What a bake rasterizes: the baked tensor factories, in order, and the grid settings. The hash only buckets, equality decides. */
+		struct FKey
+		{
+			TArray<TObjectKey<UPCGExTensorFactoryData>> Factories;
+			double VoxelSize = 0;
+			EPCGExTensorBakeInterpolation Interpolation = EPCGExTensorBakeInterpolation::Trilinear;
+			int32 MaxNodes = 0;
+			uint32 Hash = 0;
+
+			FKey(const TArray<TSharedPtr<PCGExTensorOperation>>& InBakedTensors, const FPCGExTensorBakeDetails& InDetails);
+
+			bool operator==(const FKey& Other) const
+			{
+				return Hash == Other.Hash && VoxelSize == Other.VoxelSize && Interpolation == Other.Interpolation && MaxNodes == Other.MaxNodes && Factories == Other.Factories;
+			}
+
+			friend uint32 GetTypeHash(const FKey& Key)
+			{
+				return Key.Hash;
+			}
+		};
+
+	protected:
+		FCriticalSection Lock;
+		TMap<FKey, TWeakPtr<FBakedField>> Fields;
+		TSet<FKey> FailedKeys;
+
+	public:
+		/**
+		 * Returns the field cached under InKey, or builds it with InBakeFn. Concurrent requests wait for the bake in flight
+		 * instead of duplicating it. A null result is remembered so a failing bake isn't retried.
+		 */
+		TSharedPtr<FBakedField> FindOrBake(const FKey& InKey, TFunctionRef<TSharedPtr<FBakedField>()> InBakeFn);
+	};
+
 	class PCGEXELEMENTSTENSORS_API FTensorsHandler : public TSharedFromThis<FTensorsHandler>
 	{
 		TArray<TSharedPtr<PCGExTensorOperation>> Tensors;
 		FPCGExTensorHandlerDetails Config;
 		TSharedPtr<PCGExDetails::TSettingValue<double>> Size;
+		TSharedPtr<FBakedFieldCache> BakeCache;
 
 		UPCGExTensorSampler* SamplerInstance = nullptr;
 
+		// Swaps bakeable tensors for a single grid-backed one; leaves Tensors untouched on failure
+		void BakeTensors(FPCGExContext* InContext);
+
+
 	public:
-		explicit FTensorsHandler(const FPCGExTensorHandlerDetails& InConfig);
+		/** InBakeCache is optional; when set, the baked field is shared with every other handler using the same cache. */
+		explicit FTensorsHandler(const FPCGExTensorHandlerDetails& InConfig, const TSharedPtr<FBakedFieldCache>& InBakeCache = nullptr);
 
 		bool Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories, const TSharedPtr<PCGExData::FFacade>& InDataFacade);
 		bool Init(FPCGExContext* InContext, const FName InPin, const TSharedPtr<PCGExData::FFacade>& InDataFacade);
@@ -38,6 +38,12 @@ public:
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const;
 
+	/** Whether Sample only depends on the probe location, and is bounded by Effectors -- i.e, whether it can be pre-sampled into a grid. */
+	virtual bool CanBake() const
+	{
+		return false;
+	}
+
 	virtual bool PrepareForData(const TSharedPtr<PCGExData::FFacade>& InDataFacade);
 
 	template <bool bFast = false>
@@ -340,6 +340,9 @@ struct FPCGExExtrudeTensorsContext final : FPCGExPathProcessorContext
 	TArray<TObjectPtr<const UPCGExTensorFactoryData>> TensorFactories;
 	TArray<TObjectPtr<const UPCGExPointFilterFactoryData>> StopFilterFactories;
 
+	// Lets every processor's tensor handler share a single baked field
+	TSharedPtr<PCGExTensor::FBakedFieldCache> TensorBakeCache = MakeShared<PCGExTensor::FBakedFieldCache>();
+
 	// Cached configuration (uses imported type)
 	PCGExExtrudeTensors::FExtrusionConfig ExtrusionConfig;
 
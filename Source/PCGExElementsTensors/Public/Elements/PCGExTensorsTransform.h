@@ -144,6 +144,9 @@ struct FPCGExTensorsTransformContext final : FPCGExPointsProcessorContext
 	TArray<TObjectPtr<const UPCGExTensorFactoryData>> TensorFactories;
 	TArray<TObjectPtr<const UPCGExPointFilterFactoryData>> StopFilterFactories;
 
+	// Lets every processor's tensor handler share a single baked field
+	TSharedPtr<PCGExTensor::FBakedFieldCache> TensorBakeCache = MakeShared<PCGExTensor::FBakedFieldCache>();
+
 	PCGEX_FOREACH_FIELD_TRTENSOR(PCGEX_OUTPUT_DECL_TOGGLE)
 
 protected:
@@ -56,6 +56,7 @@ protected:
 	TSharedPtr<PCGExTensor::FTensorsHandler> TensorsHandler;
 	FPCGExTensorHandlerDetails TensorHandlerDetails;
 	const TArray<TObjectPtr<const UPCGExTensorFactoryData>>* TensorFactories = nullptr;
+	TSharedPtr<PCGExTensor::FBakedFieldCache> BakeCache;
 	bool bAbsoluteTensor = true;
 
 	double GetDot(int32 InSeedIndex, const FVector& From, const FVector& To) const;
@@ -73,6 +74,9 @@ public:
 	UPROPERTY()
 	TArray<TObjectPtr<const UPCGExTensorFactoryData>> TensorFactories;
 
+	// Shared by the operations created for each cluster, so the tensor field is baked once rather than per cluster
+	TSharedPtr<PCGExTensor::FBakedFieldCache> BakeCache;
+
 	virtual TSharedPtr<FPCGExHeuristicOperation> CreateOperation(FPCGExContext* InContext) const override;
 	PCGEX_HEURISTIC_FACTORY_BOILERPLATE
 
@@ -5,6 +5,7 @@
 
 #include "PCGExFiltersSubSystem.h"
 #include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 #include "Clusters/PCGExCluster.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -41,6 +42,30 @@ bool UPCGExFilterFactoryData::Init(FPCGExContext* InContext)
 
 namespace PCGExPointFilter
 {
+	namespace
+	{
+		TAutoConsoleVariable<bool> CVarAdaptiveOrder(
+			TEXT("pcgex.Filters.AdaptiveOrder"),
+			false,
+			TEXT("Reorder filter stacks by measured cost and pass rate, sampled on the first batch each manager evaluates. Results are unaffected."),
+			ECVF_Default);
+
+		// Smaller first batches are skipped rather than trusted as a sample
+		constexpr int32 MinCalibrationSamples = 64;
+
+		enum EAdaptiveState : int32
+		{
+			Pending     = 0,
+			Calibrating = 1,
+			Ready       = 2
+		};
+	}
+
+	bool UseAdaptiveOrder()
+	{
+		return CVarAdaptiveOrder.GetValueOnAnyThread();
+	}
+
 	bool IFilter::Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade)
 	{
 		PointDataFacade = InPointDataFacade;
@@ -76,6 +101,14 @@ namespace PCGExPointFilter
 		return Test(Edge.PointIndex);
 	}
 
+	void IFilter::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+	{
+		for (int32 i = 0; i < Indices.Num(); i++)
+		{
+			OutResults[i] = Test(Indices[i]);
+		}
+	}
+
 	bool IFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 	{
 		return bCollectionTestResult;
@@ -132,10 +165,16 @@ namespace PCGExPointFilter
 		return bCollectionTestResult;
 	}
 
+	void ICollectionFilter::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+	{
+		FMemory::Memset(OutResults.GetData(), bCollectionTestResult, OutResults.Num());
+	}
+
 	bool ICollectionFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const PCGEX_NOT_IMPLEMENTED_RET(FCollectionFilter::Test(FPCGExContext* InContext, const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection), false)
 
 	FManager::FManager(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
-		: PointDataFacade(InPointDataFacade)
+		: bAdaptiveOrder(UseAdaptiveOrder())
+		  , PointDataFacade(InPointDataFacade)
 	{
 	}
 
@@ -309,60 +348,76 @@ namespace PCGExPointFilter
 
 #define PCGEX_TEST_STACK(_ITEM, _INDEX) bool bResult = true; for (const IFilter* Filter : Stack){if (!Filter->Test(_ITEM)){ bResult = false; break; }} OutResults[_INDEX] = bResult;
 
-	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults, const bool bParallel)
+	// Cuts Scope into BatchSize runs and narrows each one with Narrow(Indices).
+	// OnBatch(Start, Count, Passing) receives every run along with its surviving indices.
+	template <typename NarrowFuncType, typename FuncType>
+	static int32 TestScopeBatched(const PCGExMT::FScope& Scope, const bool bParallel, NarrowFuncType&& Narrow, FuncType&& OnBatch)
 	{
 		int32 NumPass = 0;
 
+		auto RunBatch = [&](const int32 BatchIndex)
+		{
+			const int32 Start = Scope.Start + BatchIndex * BatchSize;
+			const int32 Count = FMath::Min(BatchSize, Scope.End - Start);
+
+			TBatchArray<int32> Passing;
+			Passing.SetNumUninitialized(Count);
+			for (int32 i = 0; i < Count; i++)
+			{
+				Passing[i] = Start + i;
+			}
+
+			Narrow(Passing);
+			OnBatch(Start, Count, TConstArrayView<int32>(Passing));
+
+			return Passing.Num();
+		};
+
+		const int32 NumBatches = FMath::DivideAndRoundUp(Scope.Count, BatchSize);
+
 		if (bParallel)
 		{
-			ParallelFor(Scope.Count, [&](const int32 i)
+			ParallelFor(NumBatches, [&](const int32 BatchIndex)
 			{
-				const int32 Index = Scope.Start + i;
-				PCGEX_TEST_STACK(Index, Index)
-				if (bResult)
+				if (const int32 NumBatchPass = RunBatch(BatchIndex))
 				{
-					FPlatformAtomics::InterlockedIncrement(&NumPass);
+					FPlatformAtomics::InterlockedAdd(&NumPass, NumBatchPass);
 				}
 			});
 		}
 		else
 		{
-			PCGEX_SCOPE_LOOP(Index)
+			for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
 			{
-				PCGEX_TEST_STACK(Index, Index)
-				NumPass += bResult;
+				NumPass += RunBatch(BatchIndex);
 			}
 		}
 
 		return NumPass;
 	}
 
-	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults, const bool bParallel)
+	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults, const bool bParallel)
 	{
-		int32 NumPass = 0;
-
-		if (bParallel)
+		return TestScopeBatched(Scope, bParallel, [&](TBatchArray<int32>& Indices) { NarrowScopeBatch(Indices); }, [&](const int32 Start, const int32 Count, TConstArrayView<int32> Passing)
 		{
-			ParallelFor(Scope.Count, [&](const int32 i)
+			FMemory::Memzero(OutResults.GetData() + Start, Count);
+			for (const int32 Index : Passing)
 			{
-				const int32 Index = Scope.Start + i;
-				PCGEX_TEST_STACK(Index, Index)
-				if (bResult)
-				{
-					FPlatformAtomics::InterlockedIncrement(&NumPass);
-				}
-			});
-		}
-		else
+				OutResults[Index] = true;
+			}
+		});
+	}
+
+	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults, const bool bParallel)
+	{
+		return TestScopeBatched(Scope, bParallel, [&](TBatchArray<int32>& Indices) { NarrowScopeBatch(Indices); }, [&](const int32 Start, const int32 Count, TConstArrayView<int32> Passing)
 		{
-			PCGEX_SCOPE_LOOP(Index)
+			OutResults.SetRange(Start, Count, false);
+			for (const int32 Index : Passing)
 			{
-				PCGEX_TEST_STACK(Index, Index)
-				NumPass += bResult;
+				OutResults[Index] = true;
 			}
-		}
-
-		return NumPass;
+		});
 	}
 
 	int32 FManager::Test(const TArrayView<PCGExClusters::FNode> Items, const TArrayView<int8> OutResults, const bool bParallel)
@@ -438,6 +493,36 @@ namespace PCGExPointFilter
 		return NumPass;
 	}
 
+	void FManager::NarrowScopeBatch(TBatchArray<int32>& InOutIndices)
+	{
+		if (bAdaptiveOrder)
+		{
+			int32 State = AdaptiveState.load(std::memory_order_acquire);
+
+			if (State == Ready)
+			{
+				NarrowBatch(AdaptiveStack, InOutIndices);
+				return;
+			}
+
+			// First fair-sized batch through claims the calibration; batches racing it run the authored order
+			if (State == Pending && InOutIndices.Num() >= MinCalibrationSamples && AdaptiveState.compare_exchange_strong(State, Calibrating))
+			{
+				// Composites settle their own order first, so they are measured as they will run
+				for (const TSharedPtr<IFilter>& Filter : ManagedFilters)
+				{
+					Filter->Calibrate(InOutIndices);
+				}
+
+				CalibrateBatch(Stack, InOutIndices, AdaptiveStack);
+				AdaptiveState.store(Ready, std::memory_order_release);
+				return;
+			}
+		}
+
+		NarrowBatch(Stack, InOutIndices);
+	}
+
 	void FManager::SetSupportedTypes(const TSet<FPCGDataTypeBaseId>* InTypes)
 	{
 		SupportedFactoriesTypes = InTypes;
@@ -500,6 +585,100 @@ namespace PCGExPointFilter
 		Results.Init(false, NumResults);
 	}
 
+	void NarrowBatch(TConstArrayView<const IFilter*> InStack, TBatchArray<int32>& InOutIndices, const bool bKeep)
+	{
+		TBatchArray<int8> Mask;
+
+		for (const IFilter* Filter : InStack)
+		{
+			const int32 NumIndices = InOutIndices.Num();
+			if (!NumIndices)
+			{
+				return;
+			}
+
+			Mask.SetNumUninitialized(NumIndices, EAllowShrinking::No);
+			Filter->TestBatch(InOutIndices, Mask);
+
+			// Branchless compaction; order is preserved so the batch stays ascending
+			int32 WriteIndex = 0;
+			for (int32 i = 0; i < NumIndices; i++)
+			{
+				InOutIndices[WriteIndex] = InOutIndices[i];
+				WriteIndex += (Mask[i] != 0) == bKeep;
+			}
+
+			InOutIndices.SetNum(WriteIndex, EAllowShrinking::No);
+		}
+	}
+
+	void CalibrateBatch(TConstArrayView<const IFilter*> InStack, TBatchArray<int32>& InOutIndices, TArray<const IFilter*>& OutStack, const bool bKeep)
+	{
+		const int32 NumFilters = InStack.Num();
+		const int32 NumIndices = InStack.IsEmpty() ? 0 : InOutIndices.Num();
+
+		OutStack.Reset(NumFilters);
+		OutStack.Append(InStack.GetData(), NumFilters);
+
+		if (!NumIndices)
+		{
+			return;
+		}
+
+		// Expected cost of running a filter before the others: per-point cost over the share of points it settles
+		TArray<double> ExpectedCost;
+		ExpectedCost.SetNumUninitialized(NumFilters);
+
+		// Combined verdict for the batch, accumulated across the full masks
+		TBatchArray<int8> Keep;
+		Keep.Init(1, NumIndices);
+
+		TBatchArray<int8> Mask;
+		Mask.SetNumUninitialized(NumIndices);
+
+		for (int32 f = 0; f < NumFilters; f++)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			InStack[f]->TestBatch(InOutIndices, Mask);
+			const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+			int32 NumSettled = 0;
+			for (int32 i = 0; i < NumIndices; i++)
+			{
+				const bool bKept = (Mask[i] != 0) == bKeep;
+				NumSettled += !bKept;
+				Keep[i] &= bKept;
+			}
+
+			// A filter that never settles anything still costs its time; push it behind every filter that does
+			const double CostPerPoint = (static_cast<double>(Cycles) + 1) / NumIndices;
+			const double SettledRate = static_cast<double>(NumSettled) / NumIndices;
+			ExpectedCost[f] = SettledRate > 0 ? CostPerPoint / SettledRate : TNumericLimits<double>::Max();
+		}
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumFilters);
+		for (int32 f = 0; f < NumFilters; f++)
+		{
+			Order[f] = f;
+		}
+
+		Order.StableSort([&](const int32 A, const int32 B) { return ExpectedCost[A] < ExpectedCost[B]; });
+
+		for (int32 f = 0; f < NumFilters; f++)
+		{
+			OutStack[f] = InStack[Order[f]];
+		}
+
+		int32 WriteIndex = 0;
+		for (int32 i = 0; i < NumIndices; i++)
+		{
+			InOutIndices[WriteIndex] = InOutIndices[i];
+			WriteIndex += Keep[i];
+		}
+
+		InOutIndices.SetNum(WriteIndex, EAllowShrinking::No);
+	}
 
 	void RegisterBuffersDependencies(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExPointFilterFactoryData>>& InFactories, PCGExData::FFacadePreloader& FacadePreloader)
 	{
@@ -34,6 +34,11 @@ bool PCGExPointFilter::FConstantFilter::Test(const int32 PointIndex) const
 	return ConstantValue;
 }
 
+void PCGExPointFilter::FConstantFilter::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+{
+	FMemory::Memset(OutResults.GetData(), ConstantValue, OutResults.Num());
+}
+
 bool PCGExPointFilter::FConstantFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	return ConstantValue;
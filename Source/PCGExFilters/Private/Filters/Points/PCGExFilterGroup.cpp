@@ -179,11 +179,46 @@ namespace PCGExFilterGroup
 		return true;
 	}
 
+	void FFilterGroup::CalibrateOrder(TConstArrayView<int32> Indices, const bool bKeep)
+	{
+		if (bAdaptiveReady.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters)
+		{
+			Filter->Calibrate(Indices);
+		}
+
+		PCGExPointFilter::TBatchArray<int32> Sample(Indices.GetData(), Indices.Num());
+		PCGExPointFilter::CalibrateBatch(Stack, Sample, AdaptiveStack, bKeep);
+		bAdaptiveReady.store(true, std::memory_order_release);
+	}
+
 	void FFilterGroup::PostInitManagedFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::IFilter>& InFilter)
 	{
 		InFilter->PostInit();
 	}
 
+	// Narrows Indices through Stack, keeping entries whose result equals bKeep, then writes
+	// bSurvivorResult for the ones left and its opposite for the rest.
+	static void TestBatchNarrowed(TConstArrayView<const PCGExPointFilter::IFilter*> Stack, TConstArrayView<int32> Indices, TArrayView<int8> OutResults, const bool bKeep, const bool bSurvivorResult)
+	{
+		PCGExPointFilter::TBatchArray<int32> Survivors(Indices.GetData(), Indices.Num());
+		PCGExPointFilter::NarrowBatch(Stack, Survivors, bKeep);
+
+		// Survivors are an ordered subsequence of Indices
+		const int32 NumSurvivors = Survivors.Num();
+		int32 Cursor = 0;
+		for (int32 i = 0; i < Indices.Num(); i++)
+		{
+			const bool bSurvived = Cursor < NumSurvivors && Survivors[Cursor] == Indices[i];
+			Cursor += bSurvived;
+			OutResults[i] = bSurvived == bSurvivorResult;
+		}
+	}
+
 	bool FFilterGroupAND::Test(const int32 Index) const
 	{
 		for (const PCGExPointFilter::IFilter* Filter : Stack)
@@ -196,6 +231,17 @@ namespace PCGExFilterGroup
 		return !bInvert;
 	}
 
+	void FFilterGroupAND::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+	{
+		// Survivors passed every filter
+		TestBatchNarrowed(GetBatchStack(), Indices, OutResults, true, !bInvert);
+	}
+
+	void FFilterGroupAND::Calibrate(TConstArrayView<int32> Indices)
+	{
+		CalibrateOrder(Indices, true);
+	}
+
 	bool FFilterGroupAND::Test(const PCGExClusters::FNode& Node) const
 	{
 		for (const PCGExPointFilter::IFilter* Filter : Stack)
@@ -256,6 +302,17 @@ namespace PCGExFilterGroup
 		return bInvert;
 	}
 
+	void FFilterGroupOR::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+	{
+		// Survivors failed every filter
+		TestBatchNarrowed(GetBatchStack(), Indices, OutResults, false, bInvert);
+	}
+
+	void FFilterGroupOR::Calibrate(TConstArrayView<int32> Indices)
+	{
+		CalibrateOrder(Indices, false);
+	}
+
 	bool FFilterGroupOR::Test(const PCGExClusters::FNode& Node) const
 	{
 		for (const PCGExPointFilter::IFilter* Filter : Stack)
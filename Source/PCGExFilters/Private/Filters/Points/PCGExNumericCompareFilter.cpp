@@ -79,6 +79,21 @@ bool PCGExPointFilter::FNumericCompareFilter::Test(const int32 PointIndex) const
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 }
 
+void PCGExPointFilter::FNumericCompareFilter::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+{
+	if (Indices.IsEmpty())
+	{
+		return;
+	}
+
+	TBatchArray<double> A;
+	TBatchArray<double> B;
+	GatherBatch(Indices, A, [&](const int32 Start, TArrayView<double> OutValues) { OperandA->Read(Start, OutValues); });
+	GatherBatch(Indices, B, [&](const int32 Start, TArrayView<double> OutValues) { OperandB->ReadScope(Start, OutValues); });
+
+	PCGExCompare::CompareSpan<double>(TypedFilterFactory->Config.Comparison, A, B, OutResults, TypedFilterFactory->Config.Tolerance);
+}
+
 bool PCGExPointFilter::FNumericCompareFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
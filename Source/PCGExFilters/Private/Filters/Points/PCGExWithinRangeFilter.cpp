@@ -109,6 +109,47 @@ bool PCGExPointFilter::FWithinRangeFilter::Test(const int32 PointIndex) const
 	return bInvert;
 }
 
+void PCGExPointFilter::FWithinRangeFilter::TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const
+{
+	if (Indices.IsEmpty())
+	{
+		return;
+	}
+
+	TBatchArray<double> A;
+	GatherBatch(Indices, A, [&](const int32 Start, TArrayView<double> OutValues) { OperandA->Read(Start, OutValues); });
+
+	// Range-major: one pass over the batch per range, accumulating hits
+	const int32 NumIndices = Indices.Num();
+	FMemory::Memzero(OutResults.GetData(), NumIndices);
+
+	for (const FPCGExPickerConstantRangeConfig& Range : Ranges)
+	{
+		if (bInclusive)
+		{
+			for (int32 i = 0; i < NumIndices; i++)
+			{
+				OutResults[i] |= Range.IsWithinInclusive(A[i]);
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < NumIndices; i++)
+			{
+				OutResults[i] |= Range.IsWithin(A[i]);
+			}
+		}
+	}
+
+	if (bInvert)
+	{
+		for (int32 i = 0; i < NumIndices; i++)
+		{
+			OutResults[i] = !OutResults[i];
+		}
+	}
+}
+
 bool PCGExPointFilter::FWithinRangeFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
@@ -122,6 +122,15 @@ public:
 
 namespace PCGExPointFilter
 {
+	// Points per columnar batch handed to TestBatch by the managers
+	constexpr int32 BatchSize = 1024;
+
+	template <typename T>
+	using TBatchArray = TArray<T, TInlineAllocator<BatchSize>>;
+
+	/** Whether filter managers reorder their stacks by measured cost and pass rate by default. Backed by pcgex.Filters.AdaptiveOrder. */
+	PCGEXFILTERS_API bool UseAdaptiveOrder();
+
 	/**
 	 * Base runtime filter instance. Created by a factory and evaluated by the FManager.
 	 * Lightweight (TSharedFromThis, not UObject) for efficient per-point evaluation.
@@ -134,6 +143,7 @@ namespace PCGExPointFilter
 	 * - Test(FPointIO, FPointIOCollection) is for collection-level evaluation only
 	 *
 	 * The FManager calls Test() in an AND-stack: all filters must pass for a point to pass.
+	 * Scope-level manager tests go through TestBatch() instead, one batch of points per call.
 	 * Results can be cached in the Results array when bCacheResults is true.
 	 */
 	class PCGEXFILTERS_API IFilter : public TSharedFromThis<IFilter>
@@ -176,6 +186,17 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExClusters::FNode& Node) const;
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const;
 
+		// Columnar evaluation: OutResults[i] receives Test(Indices[i]). Indices are ascending -- a contiguous run on
+		// a fresh batch, the survivors of earlier filters after that. The default dispatches Test(int32) per index;
+		// filters reading plain buffers override it to fetch the covered span once and test it in a flat loop.
+		virtual void TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const;
+
+		// Adaptive-order hook, called at most once with a fetched batch before the owning manager settles its
+		// evaluation order. Composite filters reorder their own stack here; leaf filters have nothing to do.
+		virtual void Calibrate(TConstArrayView<int32> Indices)
+		{
+		}
+
 		// Collection-level evaluation. MUST be self-contained: read everything from IO (and the
 		// owning factory's config), never from per-point state built in Init(). In collection mode
 		// the manager keeps filters whose per-point Init() failed (the seed facade may lack the
@@ -188,6 +209,38 @@ namespace PCGExPointFilter
 		}
 
 		virtual ~IFilter() = default;
+
+	protected:
+		/**
+		 * Fills OutValues with one value per entry of Indices, using a single ReadSpan(Start, View) over the
+		 * range the batch covers -- straight into OutValues when the batch is contiguous, gathered otherwise.
+		 */
+		template <typename ArrayType, typename ReadSpanFunc>
+		static void GatherBatch(TConstArrayView<int32> Indices, ArrayType& OutValues, ReadSpanFunc&& ReadSpan)
+		{
+			using T = typename ArrayType::ElementType;
+
+			const int32 NumIndices = Indices.Num();
+			const int32 First = Indices[0];
+			const int32 NumCovered = Indices.Last() - First + 1;
+
+			OutValues.SetNumUninitialized(NumIndices);
+
+			if (NumCovered == NumIndices)
+			{
+				ReadSpan(First, TArrayView<T>(OutValues.GetData(), NumIndices));
+				return;
+			}
+
+			TBatchArray<T> Covered;
+			Covered.SetNumUninitialized(NumCovered);
+			ReadSpan(First, TArrayView<T>(Covered.GetData(), NumCovered));
+
+			for (int32 i = 0; i < NumIndices; i++)
+			{
+				OutValues[i] = Covered[Indices[i] - First];
+			}
+		}
 	};
 
 	/**
@@ -239,6 +292,7 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
 		virtual bool Test(const PCGExClusters::FNode& Node) const override final;
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override final;
+		virtual void TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const override final;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
 	};
 
@@ -252,6 +306,12 @@ namespace PCGExPointFilter
 	 *
 	 * Batch Test() overloads accept a scope/range and optionally run in parallel via ParallelFor.
 	 * They return the number of passing items. Parallel paths use InterlockedIncrement for the count.
+	 * Scope overloads are columnar: the scope is cut into BatchSize runs and each run goes through
+	 * NarrowBatch, so every filter sees a whole run at once and only what survived the filters before it.
+	 *
+	 * With bAdaptiveOrder, the first batch large enough to be a fair sample calibrates the stack: every filter
+	 * is timed over it and its pass rate recorded, and later batches run the stack cheapest-expected-first.
+	 * An AND stack gives the same answer in any order, so results are unaffected.
 	 *
 	 * Extension points:
 	 * - Override InitFilter() to customize how filters are initialized (see PCGExClusterFilter::FManager)
@@ -270,6 +330,8 @@ namespace PCGExPointFilter
 		bool bCacheResults = false;
 		TArray<int8> Results;
 
+		bool bAdaptiveOrder = false;
+
 		bool bValid = false;
 
 		TSharedRef<PCGExData::FFacade> PointDataFacade;
@@ -305,6 +367,12 @@ namespace PCGExPointFilter
 		TArray<TSharedPtr<IFilter>> ManagedFilters; // Owns the filter instances
 		TArray<const IFilter*> Stack;               // Raw pointers for cache-friendly iteration in Test()
 
+		// Calibrated order used by scope tests once AdaptiveState reaches Ready; written once, before that
+		TArray<const IFilter*> AdaptiveStack;
+		std::atomic<int32> AdaptiveState{0};
+
+		void NarrowScopeBatch(TBatchArray<int32>& InOutIndices);
+
 		virtual bool InitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& Filter);
 		virtual bool PostInit(FPCGExContext* InContext);
 		virtual void PostInitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& InFilter);
@@ -312,6 +380,22 @@ namespace PCGExPointFilter
 		virtual void InitCache();
 	};
 
+	/**
+	 * Columnar pass over a filter stack: each filter runs TestBatch over InOutIndices, which is then compacted
+	 * down to the entries whose result equals bKeep -- later filters only see what is left. Stops once empty.
+	 * bKeep = true narrows to the points passing every filter (AND), false to those failing every filter (OR).
+	 */
+	PCGEXFILTERS_API
+	void NarrowBatch(TConstArrayView<const IFilter*> InStack, TBatchArray<int32>& InOutIndices, const bool bKeep = true);
+
+	/**
+	 * Calibrating form of NarrowBatch: every filter is timed over the full batch instead of the survivors, and
+	 * OutStack receives InStack ordered by expected cost -- per-point cost over the rate at which a filter ends
+	 * evaluation (failing for AND, passing for OR). InOutIndices is narrowed exactly as NarrowBatch would.
+	 */
+	PCGEXFILTERS_API
+	void CalibrateBatch(TConstArrayView<const IFilter*> InStack, TBatchArray<int32>& InOutIndices, TArray<const IFilter*>& OutStack, const bool bKeep = true);
+
 	PCGEXFILTERS_API
 	void RegisterBuffersDependencies(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExPointFilterFactoryData>>& InFactories, PCGExData::FFacadePreloader& FacadePreloader);
 
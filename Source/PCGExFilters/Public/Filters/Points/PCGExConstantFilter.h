@@ -73,6 +73,7 @@ namespace PCGExPointFilter
 
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 		virtual bool Test(const int32 PointIndex) const override;
+		virtual void TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
 
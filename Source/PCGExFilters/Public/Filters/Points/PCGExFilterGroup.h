@@ -112,6 +112,18 @@ namespace PCGExFilterGroup
 		TArray<TSharedPtr<PCGExPointFilter::IFilter>> ManagedFilters;
 		TArray<const PCGExPointFilter::IFilter*> Stack;
 
+		// Calibrated order used by TestBatch once bAdaptiveReady is set; written once, before that
+		TArray<const PCGExPointFilter::IFilter*> AdaptiveStack;
+		std::atomic<bool> bAdaptiveReady{false};
+
+		TConstArrayView<const PCGExPointFilter::IFilter*> GetBatchStack() const
+		{
+			return bAdaptiveReady.load(std::memory_order_acquire) ? AdaptiveStack : Stack;
+		}
+
+		// Orders AdaptiveStack for this group's semantics: bKeep = true for AND, false for OR (see CalibrateBatch)
+		void CalibrateOrder(TConstArrayView<int32> Indices, const bool bKeep);
+
 		virtual bool InitManaged(FPCGExContext* InContext);
 		bool InitManagedFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::IFilter>& Filter, const bool bQuiet = false) const;
 		virtual bool PostInitManaged(FPCGExContext* InContext);
@@ -127,6 +139,8 @@ namespace PCGExFilterGroup
 		}
 
 		virtual bool Test(const int32 Index) const override;
+		virtual void TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const override;
+		virtual void Calibrate(TConstArrayView<int32> Indices) override;
 		virtual bool Test(const PCGExClusters::FNode& Node) const override;
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override;
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
@@ -142,6 +156,8 @@ namespace PCGExFilterGroup
 		}
 
 		virtual bool Test(const int32 Index) const override;
+		virtual void TestBatch(TConstArrayView<int32> Indices, TArrayView<int8> OutResults) const override;
+		virtual void Calibrate(TConstArrayView<int32> Indices) override;
 		virtual bool Test(const PCGExClusters::FNode& Node) const override;
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override;
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
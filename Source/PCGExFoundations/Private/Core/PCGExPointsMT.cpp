@@ -146,8 +146,7 @@ namespace PCGExPointsMT
 		const int32 PLI = PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize(PerLoopIterations);
 
 		TArray<PCGExMT::FScope> Loops;
-		const int32 NumScopes = PCGExMT::SubLoopScopes(
-			Loops, NumPoints, FMath::Max(1, PCGExMT::GetSanitizedBatchSize(NumPoints, PLI)));
+		const int32 NumScopes = PCGExMT::ScheduleLoopScopes(Loops, NumPoints, PLI, LoopScheduling);
 
 		PrepareLoopScopesForPoints(Loops);
 
@@ -164,17 +163,17 @@ namespace PCGExPointsMT
 		}
 		else
 		{
-			PCGExMT::ParallelOrSequential(
-				NumScopes,
-				[this, &Loops](const int32 i)
+			PCGExMT::ExecuteScopes(
+				Loops,
+				[this](const PCGExMT::FScope& Scope)
 				{
 					if (!WorkHandle.IsValid())
 					{
 						return;
 					}
-					ProcessPoints(Loops[i]);
+					ProcessPoints(Scope);
 				},
-				/*Threshold=*/2, EParallelForFlags::Unbalanced);
+				LoopScheduling, FName("ProcessPoints"));
 		}
 
 		OnPointsProcessingComplete();
@@ -213,8 +212,7 @@ namespace PCGExPointsMT
 		const int32 PLI = PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize(PerLoopIterations);
 
 		TArray<PCGExMT::FScope> Loops;
-		const int32 NumScopes = PCGExMT::SubLoopScopes(
-			Loops, NumIterations, FMath::Max(1, PCGExMT::GetSanitizedBatchSize(NumIterations, PLI)));
+		const int32 NumScopes = PCGExMT::ScheduleLoopScopes(Loops, NumIterations, PLI, LoopScheduling);
 
 		PrepareLoopScopesForRanges(Loops);
 
@@ -231,17 +229,17 @@ namespace PCGExPointsMT
 		}
 		else
 		{
-			PCGExMT::ParallelOrSequential(
-				NumScopes,
-				[this, &Loops](const int32 i)
+			PCGExMT::ExecuteScopes(
+				Loops,
+				[this](const PCGExMT::FScope& Scope)
 				{
 					if (!WorkHandle.IsValid())
 					{
 						return;
 					}
-					ProcessRange(Loops[i]);
+					ProcessRange(Scope);
 				},
-				/*Threshold=*/2, EParallelForFlags::Unbalanced);
+				LoopScheduling, FName("ProcessRange"));
 		}
 
 		OnRangeProcessingComplete();
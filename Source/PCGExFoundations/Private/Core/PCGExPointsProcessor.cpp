@@ -149,11 +149,13 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 	PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExPointsMT::MTState_PointsProcessing)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExPointsProcessorContext::ProcessPointsBatch::InitialProcessingDone);
+		PCGEX_PROFILE_PHASE_END(BatchPhase)
 		BatchProcessing_InitialProcessingDone();
 
 		SetState(PCGExPointsMT::MTState_PointsCompletingWork);
 		if (!MainBatch->bSkipCompletion)
 		{
+			PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "PointsBatch::CompleteWork")
 			{
 				PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
 				MainBatch->CompleteWork();
@@ -168,6 +170,7 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 	PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExPointsMT::MTState_PointsCompletingWork)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExPointsProcessorContext::ProcessPointsBatch::WorkComplete);
+		PCGEX_PROFILE_PHASE_END(BatchPhase)
 		if (!MainBatch->bSkipCompletion)
 		{
 			BatchProcessing_WorkComplete();
@@ -176,6 +179,7 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 		if (MainBatch->bRequiresWriteStep)
 		{
 			SetState(PCGExPointsMT::MTState_PointsWriting);
+			PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "PointsBatch::Write")
 			{
 				PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
 				MainBatch->Write();
@@ -200,6 +204,7 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 	PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExPointsMT::MTState_PointsWriting)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExPointsProcessorContext::ProcessPointsBatch::WritingDone);
+		PCGEX_PROFILE_PHASE_END(BatchPhase)
 		BatchProcessing_WritingDone();
 
 		bBatchProcessingEnabled = false;
@@ -258,6 +263,7 @@ bool FPCGExPointsProcessorContext::StartBatchProcessingPoints(FBatchProcessingVa
 	if (MainBatch->PrepareProcessing())
 	{
 		SetState(PCGExPointsMT::MTState_PointsProcessing);
+		PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "PointsBatch::Process")
 		PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), bBatchProcessingEnabled)
 		MainBatch->Process(GetTaskManager());
 	}
@@ -85,6 +85,9 @@ namespace PCGExPointsMT
 		bool bForceSingleThreadedProcessPoints = false;
 		bool bForceSingleThreadedProcessRange = false;
 
+		/** Scope split and dispatch for the parallel loops; opt into Guided or WorkStealing when per-item cost is uneven */
+		PCGExMT::EScheduling LoopScheduling = PCGExMT::EScheduling::Static;
+
 		int32 LocalPointProcessingChunkSize = -1;
 
 	public:
@@ -13,6 +13,7 @@
 #include "PCGExPointsMT.h"
 #include "Core/PCGExContext.h"
 #include "Core/PCGExElement.h"
+#include "Core/PCGExProfiling.h"
 #include "Core/PCGExSettings.h"
 #include "Core/PCGExFilterTypeSets.h" // Factory acceptance sets used by PCGEX_NODE_POINT_FILTER
 
@@ -175,6 +176,9 @@ struct PCGEXFOUNDATIONS_API FPCGExPointsProcessorContext : FPCGExContext
 	TSharedPtr<PCGExPointsMT::IBatch> MainBatch;
 	TMap<PCGExData::FPointIO*, TSharedRef<PCGExPointsMT::IProcessor>> SubProcessorMap;
 
+	/** Batch step currently in flight, closed once its async work has drained. */
+	PCGExProfiling::FPendingPhase BatchPhase;
+
 	bool StartBatchProcessingPoints(FBatchProcessingValidateEntry&& ValidateEntry, FBatchProcessingInitPointBatch&& InitBatch);
 
 	virtual void BatchProcessing_InitialProcessingDone();
@@ -268,6 +268,8 @@ namespace PCGExClusters
 			This->Chains[Index]->BuildChain(This->Cluster, This->Breakpoints);
 		};
 
+		// Chains run from a single edge to most of the cluster
+		ChainSearchTask->Scheduling = PCGExMT::EScheduling::WorkStealing;
 		ChainSearchTask->StartIterations(Chains.Num(), 64, false);
 		return true;
 	}
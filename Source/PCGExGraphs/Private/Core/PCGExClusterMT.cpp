@@ -327,8 +327,7 @@ namespace PCGExClusterMT
 		const int32 PLI = PCGEX_CORE_SETTINGS.GetClusterBatchChunkSize(PerLoopIterations);
 
 		TArray<PCGExMT::FScope> Loops;
-		const int32 NumScopes = PCGExMT::SubLoopScopes(
-			Loops, NumNodes, FMath::Max(1, PCGExMT::GetSanitizedBatchSize(NumNodes, PLI)));
+		const int32 NumScopes = PCGExMT::ScheduleLoopScopes(Loops, NumNodes, PLI, LoopScheduling);
 
 		PrepareLoopScopesForNodes(Loops);
 
@@ -345,17 +344,17 @@ namespace PCGExClusterMT
 		}
 		else
 		{
-			PCGExMT::ParallelOrSequential(
-				NumScopes,
-				[this, &Loops](const int32 i)
+			PCGExMT::ExecuteScopes(
+				Loops,
+				[this](const PCGExMT::FScope& Scope)
 				{
 					if (!WorkHandle.IsValid())
 					{
 						return;
 					}
-					ProcessNodes(Loops[i]);
+					ProcessNodes(Scope);
 				},
-				2, EParallelForFlags::Unbalanced);
+				LoopScheduling, FName("ProcessNodes"));
 		}
 
 		OnNodesProcessingComplete();
@@ -394,8 +393,7 @@ namespace PCGExClusterMT
 		const int32 PLI = PCGEX_CORE_SETTINGS.GetClusterBatchChunkSize(PerLoopIterations);
 
 		TArray<PCGExMT::FScope> Loops;
-		const int32 NumScopes = PCGExMT::SubLoopScopes(
-			Loops, NumEdges, FMath::Max(1, PCGExMT::GetSanitizedBatchSize(NumEdges, PLI)));
+		const int32 NumScopes = PCGExMT::ScheduleLoopScopes(Loops, NumEdges, PLI, LoopScheduling);
 
 		PrepareLoopScopesForEdges(Loops);
 
@@ -412,17 +410,17 @@ namespace PCGExClusterMT
 		}
 		else
 		{
-			PCGExMT::ParallelOrSequential(
-				NumScopes,
-				[this, &Loops](const int32 i)
+			PCGExMT::ExecuteScopes(
+				Loops,
+				[this](const PCGExMT::FScope& Scope)
 				{
 					if (!WorkHandle.IsValid())
 					{
 						return;
 					}
-					ProcessEdges(Loops[i]);
+					ProcessEdges(Scope);
 				},
-				2, EParallelForFlags::Unbalanced);
+				LoopScheduling, FName("ProcessEdges"));
 		}
 
 		OnEdgesProcessingComplete();
@@ -461,8 +459,7 @@ namespace PCGExClusterMT
 		const int32 PLI = PCGEX_CORE_SETTINGS.GetClusterBatchChunkSize(PerLoopIterations);
 
 		TArray<PCGExMT::FScope> Loops;
-		const int32 NumScopes = PCGExMT::SubLoopScopes(
-			Loops, NumIterations, FMath::Max(1, PCGExMT::GetSanitizedBatchSize(NumIterations, PLI)));
+		const int32 NumScopes = PCGExMT::ScheduleLoopScopes(Loops, NumIterations, PLI, LoopScheduling);
 
 		PrepareLoopScopesForRanges(Loops);
 
@@ -479,17 +476,17 @@ namespace PCGExClusterMT
 		}
 		else
 		{
-			PCGExMT::ParallelOrSequential(
-				NumScopes,
-				[this, &Loops](const int32 i)
+			PCGExMT::ExecuteScopes(
+				Loops,
+				[this](const PCGExMT::FScope& Scope)
 				{
 					if (!WorkHandle.IsValid())
 					{
 						return;
 					}
-					ProcessRange(Loops[i]);
+					ProcessRange(Scope);
 				},
-				2, EParallelForFlags::Unbalanced);
+				LoopScheduling, FName("ProcessRange"));
 		}
 
 		OnRangeProcessingComplete();
@@ -936,6 +933,7 @@ namespace PCGExClusterMT
 			return;
 		}
 
+
 		if (bForceSingleThreadedWrite)
 		{
 			for (TSharedRef<IProcessor>& Processor : Processors)
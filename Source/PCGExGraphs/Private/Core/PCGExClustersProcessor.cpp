@@ -193,9 +193,11 @@ bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextS
 
 		PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExClusterMT::MTState_ClusterProcessing)
 		{
+			PCGEX_PROFILE_PHASE_END(BatchPhase)
 			SetState(PCGExClusterMT::MTState_ClusterCompletingWork);
 			if (!CurrentBatch->bSkipCompletion)
 			{
+				PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "ClusterBatch::CompleteWork")
 				{
 					PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
 					CurrentBatch->CompleteWork();
@@ -209,6 +211,7 @@ bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextS
 
 		PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExClusterMT::MTState_ClusterCompletingWork)
 		{
+			PCGEX_PROFILE_PHASE_END(BatchPhase)
 			{
 				PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
 				AdvanceBatch(NextStateId);
@@ -225,10 +228,12 @@ bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextS
 	{
 		PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExClusterMT::MTState_ClusterProcessing)
 		{
+			PCGEX_PROFILE_PHASE_END(BatchPhase)
 			ClusterProcessing_InitialProcessingDone();
 			SetState(PCGExClusterMT::MTState_ClusterCompletingWork);
 			if (!bSkipClusterBatchCompletionStep)
 			{
+				PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "ClusterBatch::CompleteWork")
 				{
 					PCGEX_ASYNC_SCHEDULING_SCOPE(TaskManager, true)
 					for (const TSharedPtr<PCGExClusterMT::IBatch>& Batch : Batches)
@@ -245,6 +250,7 @@ bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextS
 
 		PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExClusterMT::MTState_ClusterCompletingWork)
 		{
+			PCGEX_PROFILE_PHASE_END(BatchPhase)
 			if (!bSkipClusterBatchCompletionStep)
 			{
 				ClusterProcessing_WorkComplete();
@@ -253,6 +259,7 @@ bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextS
 			if (bDoClusterBatchWritingStep)
 			{
 				SetState(PCGExClusterMT::MTState_ClusterWriting);
+				PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "ClusterBatch::Write")
 				{
 					PCGEX_ASYNC_SCHEDULING_SCOPE(TaskManager, true)
 					for (const TSharedPtr<PCGExClusterMT::IBatch>& Batch : Batches)
@@ -279,6 +286,7 @@ bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextS
 
 		PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExClusterMT::MTState_ClusterWriting)
 		{
+			PCGEX_PROFILE_PHASE_END(BatchPhase)
 			ClusterProcessing_WritingDone();
 
 			bBatchProcessingEnabled = false;
@@ -387,6 +395,7 @@ bool FPCGExClustersProcessorContext::StartProcessingClusters(FBatchProcessingVal
 	if (!bDaisyChainClusterBatches)
 	{
 		SetState(PCGExClusterMT::MTState_ClusterProcessing);
+		PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "ClusterBatch::Process")
 		PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), true)
 
 		PCGExMT::ParallelOrSequential(Batches.Num(), [&](const int32 i)
@@ -431,6 +440,7 @@ void FPCGExClustersProcessorContext::AdvanceBatch(const PCGExCommon::ContextStat
 	{
 		CurrentBatch = Batches[CurrentBatchIndex];
 		SetState(PCGExClusterMT::MTState_ClusterProcessing);
+		PCGEX_PROFILE_PHASE_BEGIN(BatchPhase, GetTaskManager(), "ClusterBatch::Process")
 		PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(),)
 		ScheduleBatch(GetTaskManager(), CurrentBatch, bScopedIndexLookupBuild);
 	}
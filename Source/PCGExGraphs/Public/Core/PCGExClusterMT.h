@@ -88,6 +88,9 @@ namespace PCGExClusterMT
 		bool bForceSingleThreadedProcessEdges = false;
 		bool bForceSingleThreadedProcessRange = false;
 
+		/** Scope split and dispatch for the parallel loops; opt into Guided or WorkStealing when per-item cost is uneven */
+		PCGExMT::EScheduling LoopScheduling = PCGExMT::EScheduling::Static;
+
 		int32 NumNodes = 0;
 		int32 NumEdges = 0;
 
@@ -0,0 +1,267 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Heuristics/PCGExHeuristicLandmarks.h"
+
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExManagedObjects.h"
+#include "Utils/PCGExScoredQueue.h"
+
+#define LOCTEXT_NAMESPACE "PCGExHeuristicLandmarks"
+
+namespace PCGExHeuristics
+{
+#pragma region FLandmarkCacheFactory
+
+	FText FLandmarkCacheFactory::GetDisplayName() const
+	{
+		return LOCTEXT("DisplayName", "Heuristic Landmarks");
+	}
+
+	FText FLandmarkCacheFactory::GetTooltip() const
+	{
+		return LOCTEXT("Tooltip", "Shortest distances from and to a few landmark nodes, bounding the remaining cost of any A* query.");
+	}
+
+	TSharedPtr<PCGExClusters::ICachedClusterData> FLandmarkCacheFactory::Build(const PCGExClusters::FClusterCacheBuildContext& Context) const
+	{
+		// Needs heuristics -- built by FPCGExHeuristicLandmarks::PrepareForHandler
+		return nullptr;
+	}
+
+#pragma endregion
+
+#pragma region FLandmarkTable
+
+	namespace LandmarksInternal
+	{
+		/** Full Dijkstra from Root. bReverse walks arcs backward, yielding distances *to* Root. */
+		void Sweep(const PCGExClusters::FCluster* InCluster, const TArray<double>& InDirectedScores, const int32 Root, const bool bReverse, PCGEx::FScoredQueue& Queue, double* OutDistances)
+		{
+			const TArray<PCGExClusters::FNode>& NodesRef = *InCluster->Nodes;
+			const TArray<PCGExGraphs::FEdge>& EdgesRef = *InCluster->Edges;
+
+			Queue.Reset();
+			Queue.Enqueue(Root, 0);
+
+			int32 Current;
+			double Score;
+			while (Queue.Dequeue(Current, Score))
+			{
+				const PCGExClusters::FNode& Node = NodesRef[Current];
+				for (const PCGExGraphs::FLink Lk : Node.Links)
+				{
+					if (Lk.Node == Current)
+					{
+						continue;
+					}
+
+					// Current -> Lk.Node when walking forward, Lk.Node -> Current when walking backward
+					const bool bStartIsCurrent = EdgesRef[Lk.Edge].Start == static_cast<uint32>(Node.PointIndex);
+					const bool bForward = bReverse ? !bStartIsCurrent : bStartIsCurrent;
+					Queue.Enqueue(Lk.Node, Score + InDirectedScores[(Lk.Edge << 1) | (bForward ? 0 : 1)]);
+				}
+			}
+
+			FMemory::Memcpy(OutDistances, Queue.Scores.GetData(), NodesRef.Num() * sizeof(double));
+		}
+	}
+
+	double FLandmarkTable::GetLowerBound(const int32 From, const int32 Goal) const
+	{
+		constexpr double Unreachable = TNumericLimits<double>::Max();
+
+		double Bound = 0;
+		for (int32 i = 0; i < Landmarks.Num(); i++)
+		{
+			const int32 Offset = i * NumNodes;
+
+			// d(From, Goal) >= d(L, Goal) - d(L, From)
+			const double LFrom = Forward[Offset + From];
+			const double LGoal = Forward[Offset + Goal];
+			if (LFrom != Unreachable && LGoal != Unreachable)
+			{
+				Bound = FMath::Max(Bound, LGoal - LFrom);
+			}
+
+			// d(From, Goal) >= d(From, L) - d(Goal, L)
+			const double FromL = Backward[Offset + From];
+			const double GoalL = Backward[Offset + Goal];
+			if (FromL != Unreachable && GoalL != Unreachable)
+			{
+				Bound = FMath::Max(Bound, FromL - GoalL);
+			}
+		}
+
+		return Bound;
+	}
+
+	uint32 FLandmarkTable::ComputeContextHash(const TArray<double>& InDirectedScores, const int32 InNumLandmarks)
+	{
+		const uint32 Hash = HashCombineFast(
+			FCrc::MemCrc32(InDirectedScores.GetData(), InDirectedScores.Num() * sizeof(double)),
+			HashCombineFast(GetTypeHash(InDirectedScores.Num()), GetTypeHash(InNumLandmarks)));
+		return Hash == 0 ? 1 : Hash;
+	}
+
+	TSharedPtr<FLandmarkTable> FLandmarkTable::Build(const PCGExClusters::FCluster* InCluster, const TArray<double>& InDirectedScores, const int32 InNumLandmarks)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FLandmarkTable::Build);
+
+		const int32 NumNodes = InCluster->Nodes->Num();
+
+		TSharedPtr<FLandmarkTable> Table = MakeShared<FLandmarkTable>();
+		Table->ContextHash = ComputeContextHash(InDirectedScores, InNumLandmarks);
+		Table->NumNodes = NumNodes;
+
+		if (NumNodes == 0)
+		{
+			return Table;
+		}
+
+		const int32 NumLandmarks = FMath::Clamp(InNumLandmarks, 1, NumNodes);
+		Table->Landmarks.Reserve(NumLandmarks);
+		Table->Forward.SetNumUninitialized(NumLandmarks * NumNodes);
+		Table->Backward.SetNumUninitialized(NumLandmarks * NumNodes);
+
+		PCGEx::FScoredQueue Queue(NumNodes);
+
+		// Distance from each node to its nearest landmark so far; the next landmark is the node that maximizes it.
+		// Seeded with a sweep from node 0 so the first landmark already sits on the cluster's periphery.
+		TArray<double> Nearest;
+		Nearest.SetNumUninitialized(NumNodes);
+		LandmarksInternal::Sweep(InCluster, InDirectedScores, 0, false, Queue, Nearest.GetData());
+
+		for (int32 i = 0; i < NumLandmarks; i++)
+		{
+			// Unreachable nodes (Max) win first, so disconnected parts still get a landmark
+			int32 Landmark = -1;
+			double Farthest = -1;
+			for (int32 v = 0; v < NumNodes; v++)
+			{
+				if (Nearest[v] > Farthest)
+				{
+					Farthest = Nearest[v];
+					Landmark = v;
+				}
+			}
+
+			if (Farthest <= 0)
+			{
+				// Every node is a landmark already
+				break;
+			}
+
+			Table->Landmarks.Add(Landmark);
+
+			double* Forward = Table->Forward.GetData() + i * NumNodes;
+			double* Backward = Table->Backward.GetData() + i * NumNodes;
+
+			LandmarksInternal::Sweep(InCluster, InDirectedScores, Landmark, false, Queue, Forward);
+			LandmarksInternal::Sweep(InCluster, InDirectedScores, Landmark, true, Queue, Backward);
+
+			if (i == 0)
+			{
+				// Drop the seeding sweep; node 0 isn't a landmark
+				FMemory::Memcpy(Nearest.GetData(), Forward, NumNodes * sizeof(double));
+			}
+			else
+			{
+				for (int32 v = 0; v < NumNodes; v++)
+				{
+					Nearest[v] = FMath::Min(Nearest[v], Forward[v]);
+				}
+			}
+		}
+
+		const int32 NumPicked = Table->Landmarks.Num();
+		Table->Forward.SetNum(NumPicked * NumNodes);
+		Table->Backward.SetNum(NumPicked * NumNodes);
+
+		return Table;
+	}
+
+#pragma endregion
+}
+
+void FPCGExHeuristicLandmarks::PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster)
+{
+	FPCGExHeuristicOperation::PrepareForCluster(InCluster);
+	Table.Reset();
+}
+
+void FPCGExHeuristicLandmarks::PrepareForHandler(const TSharedPtr<PCGExHeuristics::FHandler>& InHandler)
+{
+	Table.Reset();
+
+	PCGExClusters::FCluster* InCluster = InHandler->Cluster.Get();
+	if (!InCluster || !InHandler->HasGoalIndependentEdgeScores())
+	{
+		return;
+	}
+
+	const TArray<PCGExGraphs::FEdge>& EdgesRef = *InCluster->Edges;
+
+	// Distances must be measured with the same aggregated scores the search accumulates as G
+	TArray<double> DirectedScores;
+	DirectedScores.SetNumUninitialized(EdgesRef.Num() * 2);
+	for (int32 i = 0; i < EdgesRef.Num(); i++)
+	{
+		const PCGExGraphs::FEdge& Edge = EdgesRef[i];
+		const PCGExClusters::FNode& Start = *InCluster->GetEdgeStart(Edge);
+		const PCGExClusters::FNode& End = *InCluster->GetEdgeEnd(Edge);
+
+		// Goal-independent by contract; endpoints stand in for seed/goal.
+		DirectedScores[i << 1] = InHandler->GetEdgeScore(Start, End, Edge, Start, End);
+		DirectedScores[(i << 1) | 1] = InHandler->GetEdgeScore(End, Start, Edge, End, Start);
+	}
+
+	const uint32 ContextHash = PCGExHeuristics::FLandmarkTable::ComputeContextHash(DirectedScores, NumLandmarks);
+	Table = InCluster->GetCachedData<PCGExHeuristics::FLandmarkTable>(PCGExHeuristics::FLandmarkCacheFactory::CacheKey, ContextHash);
+
+	if (!Table)
+	{
+		Table = PCGExHeuristics::FLandmarkTable::Build(InCluster, DirectedScores, NumLandmarks);
+		InCluster->SetCachedData(PCGExHeuristics::FLandmarkCacheFactory::CacheKey, Table);
+	}
+}
+
+double FPCGExHeuristicLandmarks::GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const
+{
+	if (!Table)
+	{
+		return 0;
+	}
+
+	// ReferenceWeight carries WeightFactor, matching how the handler normalizes every other op
+	return Table->GetLowerBound(From.Index, Goal.Index) * ReferenceWeight;
+}
+
+TSharedPtr<FPCGExHeuristicOperation> UPCGExHeuristicsFactoryLandmarks::CreateOperation(FPCGExContext* InContext) const
+{
+	PCGEX_FACTORY_NEW_OPERATION(HeuristicLandmarks)
+	PCGEX_FORWARD_HEURISTIC_CONFIG
+	NewOperation->NumLandmarks = Config.NumLandmarks;
+	return NewOperation;
+}
+
+PCGEX_HEURISTIC_FACTORY_BOILERPLATE_IMPL(Landmarks, {})
+
+UPCGExFactoryData* UPCGExHeuristicsLandmarksProviderSettings::CreateFactory(FPCGExContext* InContext, UPCGExFactoryData* InFactory) const
+{
+	UPCGExHeuristicsFactoryLandmarks* NewFactory = InContext->ManagedObjects->New<UPCGExHeuristicsFactoryLandmarks>();
+	PCGEX_FORWARD_HEURISTIC_FACTORY
+	return Super::CreateFactory(InContext, NewFactory);
+}
+
+#if WITH_EDITOR
+FString UPCGExHeuristicsLandmarksProviderSettings::GetDisplayName() const
+{
+	return GetDefaultNodeTitle().ToString().Replace(TEXT("PCGEx | Heuristics"), TEXT("HX"))
+		+ FString::Printf(TEXT(" x%d @ %.3f"), Config.NumLandmarks, (static_cast<int32>(1000 * Config.WeightFactor) / 1000.0));
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -3,6 +3,9 @@
 
 #include "PCGExHeuristics.h"
 
+#include "Clusters/PCGExClusterCache.h"
+#include "Heuristics/PCGExHeuristicLandmarks.h"
+
 #if WITH_EDITOR
 #include "Core/PCGExHeuristicsFactoryProvider.h"
 #include "Data/Registry/PCGDataTypeRegistry.h"
@@ -14,10 +17,18 @@
 void FPCGExHeuristicsModule::StartupModule()
 {
 	IPCGExLegacyModuleInterface::StartupModule();
+
+	// Register cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Register(
+		MakeShared<PCGExHeuristics::FLandmarkCacheFactory>());
 }
 
 void FPCGExHeuristicsModule::ShutdownModule()
 {
+	// Unregister cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Unregister(
+		PCGExHeuristics::FLandmarkCacheFactory::CacheKey);
+
 	IPCGExLegacyModuleInterface::ShutdownModule();
 }
 
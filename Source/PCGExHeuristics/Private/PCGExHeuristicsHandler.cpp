@@ -147,6 +147,8 @@ namespace PCGExHeuristics
 	void FHandler::CompleteClusterPreparation()
 	{
 		TotalStaticWeight = 0;
+		TotalEdgeWeight = 0;
+		EdgeOps.Reset();
 		StaticEdgeOps.Reset();
 		DynamicEdgeOps.Reset();
 		BakedStaticEdgeScores.Empty();
@@ -156,6 +158,15 @@ namespace PCGExHeuristics
 		{
 			TotalStaticWeight += Op->WeightFactor;
 
+			if (!Op->HasEdgeScore())
+			{
+				// Global-only: neither aggregated nor weighted into edge scores
+				continue;
+			}
+
+			TotalEdgeWeight += Op->WeightFactor;
+			EdgeOps.Add(Op.Get());
+
 			if (Op->HasStaticEdgeScore())
 			{
 				StaticEdgeOps.Add(Op.Get());
@@ -165,6 +176,11 @@ namespace PCGExHeuristics
 				DynamicEdgeOps.Add(Op.Get());
 			}
 		}
+
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		{
+			Op->PrepareForHandler(SharedThis(this));
+		}
 	}
 
 	void FHandler::BakeStaticEdgeScores()
@@ -367,7 +383,7 @@ namespace PCGExHeuristics
 	double FHandlerWeightedAverage::GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback, PCGEx::FHashLookup* TravelStack) const
 	{
 		double EScore = 0;
-		double TotalWeight = TotalStaticWeight;
+		double TotalWeight = TotalEdgeWeight;
 
 		if (!bUseDynamicWeight)
 		{
@@ -381,7 +397,7 @@ namespace PCGExHeuristics
 			}
 			else
 			{
-				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+				for (const FPCGExHeuristicOperation* Op : EdgeOps)
 				{
 					EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
 				}
@@ -398,7 +414,7 @@ namespace PCGExHeuristics
 
 		// Dynamic weight path: apply per-edge custom weight multipliers
 		TotalWeight = 0;
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const FPCGExHeuristicOperation* Op : EdgeOps)
 		{
 			const double Multiplier = Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex);
 			EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack) * Multiplier;
@@ -449,7 +465,7 @@ namespace PCGExHeuristics
 		constexpr double MinScore = MinClampedScore;
 
 		double WeightedLogSum = 0;
-		double TotalWeight = TotalStaticWeight;
+		double TotalWeight = TotalEdgeWeight;
 
 		if (!bUseDynamicWeight)
 		{
@@ -464,7 +480,7 @@ namespace PCGExHeuristics
 			}
 			else
 			{
-				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+				for (const FPCGExHeuristicOperation* Op : EdgeOps)
 				{
 					const double Score = FMath::Max(MinScore, Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack));
 					WeightedLogSum += Op->WeightFactor * FMath::Loge(Score / Op->WeightFactor);
@@ -483,7 +499,7 @@ namespace PCGExHeuristics
 
 		// Dynamic weight path
 		TotalWeight = 0;
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const FPCGExHeuristicOperation* Op : EdgeOps)
 		{
 			const double Multiplier = Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex);
 			const double EffectiveWeight = Op->WeightFactor * Multiplier;
@@ -539,7 +555,7 @@ namespace PCGExHeuristics
 			}
 			else
 			{
-				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+				for (const FPCGExHeuristicOperation* Op : EdgeOps)
 				{
 					EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
 				}
@@ -554,7 +570,7 @@ namespace PCGExHeuristics
 		}
 
 		// Dynamic weight path: apply per-edge custom weight multipliers
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const FPCGExHeuristicOperation* Op : EdgeOps)
 		{
 			const double Multiplier = Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex);
 			EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack) * Multiplier;
@@ -603,7 +619,7 @@ namespace PCGExHeuristics
 		constexpr double MinScore = MinClampedScore;
 
 		double WeightedInverseSum = 0;
-		double TotalWeight = TotalStaticWeight;
+		double TotalWeight = TotalEdgeWeight;
 
 		if (!bUseDynamicWeight)
 		{
@@ -618,7 +634,7 @@ namespace PCGExHeuristics
 			}
 			else
 			{
-				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+				for (const FPCGExHeuristicOperation* Op : EdgeOps)
 				{
 					const double Score = FMath::Max(MinScore, Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack));
 					WeightedInverseSum += Op->WeightFactor / (Score / Op->WeightFactor);
@@ -637,7 +653,7 @@ namespace PCGExHeuristics
 
 		// Dynamic weight path
 		TotalWeight = 0;
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const FPCGExHeuristicOperation* Op : EdgeOps)
 		{
 			const double Multiplier = Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex);
 			const double EffectiveWeight = Op->WeightFactor * Multiplier;
@@ -698,7 +714,7 @@ namespace PCGExHeuristics
 			}
 			else
 			{
-				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+				for (const FPCGExHeuristicOperation* Op : EdgeOps)
 				{
 					const double Score = Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack) / Op->WeightFactor;
 					MinScore = FMath::Min(MinScore, Score);
@@ -715,7 +731,7 @@ namespace PCGExHeuristics
 		}
 
 		// Dynamic weight path
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const FPCGExHeuristicOperation* Op : EdgeOps)
 		{
 			const double Multiplier = Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex);
 			const double EffectiveWeight = Op->WeightFactor * Multiplier;
@@ -777,7 +793,7 @@ namespace PCGExHeuristics
 			}
 			else
 			{
-				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+				for (const FPCGExHeuristicOperation* Op : EdgeOps)
 				{
 					const double Score = Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack) / Op->WeightFactor;
 					MaxScore = FMath::Max(MaxScore, Score);
@@ -794,7 +810,7 @@ namespace PCGExHeuristics
 		}
 
 		// Dynamic weight path
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const FPCGExHeuristicOperation* Op : EdgeOps)
 		{
 			const double Multiplier = Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex);
 			const double EffectiveWeight = Op->WeightFactor * Multiplier;
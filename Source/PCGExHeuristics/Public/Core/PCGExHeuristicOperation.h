@@ -26,6 +26,11 @@ namespace PCGExClusters
 	class FCluster;
 }
 
+namespace PCGExHeuristics
+{
+	class FHandler;
+}
+
 /**
  *
  */
@@ -45,6 +50,12 @@ public:
 
 	bool bHasCustomLocalWeightMultiplier = false;
 
+	/** False for global-only operations: the handler leaves them out of edge-score aggregation and weighting. */
+	virtual bool HasEdgeScore() const
+	{
+		return true;
+	}
+
 	/** True when GetEdgeScore depends only on From/To/Edge -- no Seed/Goal/TravelStack, and no state
 	 * that mutates between queries -- so the handler can bake it once per directed edge. */
 	virtual bool HasStaticEdgeScore() const
@@ -54,6 +65,12 @@ public:
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster);
 
+	/** Called at the end of FHandler::CompleteClusterPreparation, once every op is prepared and the static/dynamic
+	 * split is known. Lets ops precompute data that depends on the aggregated edge scores (see Landmarks). */
+	virtual void PrepareForHandler(const TSharedPtr<PCGExHeuristics::FHandler>& InHandler)
+	{
+	}
+
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const;
 
 
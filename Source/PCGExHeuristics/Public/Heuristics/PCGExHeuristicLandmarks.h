@@ -0,0 +1,148 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Core/PCGExHeuristicOperation.h"
+#include "Core/PCGExHeuristicsFactoryProvider.h"
+#include "UObject/Object.h"
+
+
+#include "PCGExHeuristicLandmarks.generated.h"
+
+USTRUCT(BlueprintType)
+struct FPCGExHeuristicConfigLandmarks : public FPCGExHeuristicConfigBase
+{
+	GENERATED_BODY()
+
+	FPCGExHeuristicConfigLandmarks()
+		: FPCGExHeuristicConfigBase()
+	{
+		// The bound is a raw edge-score distance; remapping or inverting it would break admissibility.
+		bRawSettings = true;
+	}
+
+	/** Number of landmarks picked per cluster. Each one costs two full Dijkstra sweeps and two doubles per node, once per cluster. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1, ClampMax=64))
+	int32 NumLandmarks = 8;
+};
+
+namespace PCGExHeuristics
+{
+	/**
+	 * Exact shortest distances between a handful of landmark nodes and every other node, over the
+	 * handler's directed edge scores. Forward[L * NumNodes + v] = d(L, v), Backward[L * NumNodes + v] = d(v, L);
+	 * unreachable entries hold TNumericLimits<double>::Max(). ContextHash fingerprints the scores and landmark count.
+	 */
+	class PCGEXHEURISTICS_API FLandmarkTable : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		int32 NumNodes = 0;
+		TArray<int32> Landmarks;
+		TArray<double> Forward;
+		TArray<double> Backward;
+
+		/** Largest lower bound on d(From, Goal) the triangle inequality yields over all landmarks. */
+		double GetLowerBound(const int32 From, const int32 Goal) const;
+
+		static uint32 ComputeContextHash(const TArray<double>& InDirectedScores, const int32 InNumLandmarks);
+
+		/**
+		 * Picks landmarks by farthest-point selection and fills both tables.
+		 * @param InDirectedScores Two entries per edge: [Index*2] start-to-end, [Index*2+1] end-to-start.
+		 */
+		static TSharedPtr<FLandmarkTable> Build(const PCGExClusters::FCluster* InCluster, const TArray<double>& InDirectedScores, const int32 InNumLandmarks);
+	};
+
+	/**
+	 * Factory for the landmark table cache.
+	 * Opportunistic only: the tables depend on heuristics, which the pre-build context doesn't carry.
+	 */
+	class PCGEXHEURISTICS_API FLandmarkCacheFactory : public PCGExClusters::IClusterCacheFactory
+	{
+	public:
+		static inline const FName CacheKey = FName("HeuristicLandmarks");
+
+		virtual FName GetCacheKey() const override
+		{
+			return CacheKey;
+		}
+
+		virtual FText GetDisplayName() const override;
+		virtual FText GetTooltip() const override;
+
+		virtual EClusterCacheType GetCacheType() const override
+		{
+			return EClusterCacheType::Opportunistic;
+		}
+
+		virtual TSharedPtr<PCGExClusters::ICachedClusterData> Build(const PCGExClusters::FClusterCacheBuildContext& Context) const override;
+	};
+}
+
+/**
+ * ALT (A*, Landmarks, Triangle inequality) heuristic.
+ * Contributes no edge cost of its own; its global score is a lower bound on the remaining edge-score
+ * distance to the goal, read from landmark tables built once per cluster and shared through the cluster cache.
+ * The bound is expressed in the handler's aggregated edge-score units and weighted like any other op, so it
+ * stays admissible as long as it isn't mixed with heavier global estimates (Max mode, or sole global op).
+ * Goal-dependent edge scores or feedback make the tables meaningless -- the op then scores 0.
+ */
+class FPCGExHeuristicLandmarks : public FPCGExHeuristicOperation
+{
+public:
+	int32 NumLandmarks = 8;
+
+	virtual bool HasEdgeScore() const override
+	{
+		return false;
+	}
+
+	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
+	virtual void PrepareForHandler(const TSharedPtr<PCGExHeuristics::FHandler>& InHandler) override;
+
+	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const override;
+
+protected:
+	TSharedPtr<PCGExHeuristics::FLandmarkTable> Table;
+};
+
+////
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
+class UPCGExHeuristicsFactoryLandmarks : public UPCGExHeuristicsFactoryData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual TSharedPtr<FPCGExHeuristicOperation> CreateOperation(FPCGExContext* InContext) const override;
+	PCGEX_HEURISTIC_FACTORY_BOILERPLATE
+};
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph|Params", meta=(PCGExNodeLibraryDoc="pathfinding/heuristics/heuristics-landmarks"))
+class UPCGExHeuristicsLandmarksProviderSettings : public UPCGExHeuristicsFactoryProviderSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS_CUSTOM_SUBTITLE(HeuristicsLandmarks, "Heuristics : Landmarks", "Precomputed landmark distances giving a tight lower bound to the goal (ALT).", FName(GetDisplayName()))
+#endif
+	//~End UPCGSettings
+
+	/** Filter Config.*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ShowOnlyInnerProperties))
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual UPCGExFactoryData* CreateFactory(FPCGExContext* InContext, UPCGExFactoryData* InFactory) const override;
+
+#if WITH_EDITOR
+	virtual FString GetDisplayName() const override;
+#endif
+};
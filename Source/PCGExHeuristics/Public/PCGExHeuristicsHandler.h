@@ -70,6 +70,7 @@ namespace PCGExHeuristics
 
 		double ReferenceWeight = 1;
 		double TotalStaticWeight = 0;
+		double TotalEdgeWeight = 0; // TotalStaticWeight, minus global-only operations
 		bool bUseDynamicWeight = false;
 
 		bool IsValidHandler() const
@@ -110,6 +111,14 @@ namespace PCGExHeuristics
 			return bHasBakedEdgeScores;
 		}
 
+		/** True when every edge score depends only on From/To/Edge -- no seed/goal/travel-dependent op and no
+		 * feedback mutating scores between queries. A single shortest-path tree grown from a seed is then valid
+		 * for every goal. Only meaningful after CompleteClusterPreparation. */
+		FORCEINLINE bool HasGoalIndependentEdgeScores() const
+		{
+			return DynamicEdgeOps.IsEmpty() && !HasAnyFeedback();
+		}
+
 		/** Override in subclasses to implement different score aggregation modes */
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const = 0;
 
@@ -155,8 +164,9 @@ namespace PCGExHeuristics
 		/** Clamp floor shared by aggregation modes that divide by, or take the log of, scores */
 		static constexpr double MinClampedScore = 1e-10;
 
-		/** Operations split by HasStaticEdgeScore, built by CompleteClusterPreparation.
-		 * Raw pointers -- lifetime owned by Operations. */
+		/** Operations contributing edge scores (see HasEdgeScore), then those split by HasStaticEdgeScore.
+		 * Built by CompleteClusterPreparation. Raw pointers -- lifetime owned by Operations. */
+		TArray<FPCGExHeuristicOperation*> EdgeOps;
 		TArray<FPCGExHeuristicOperation*> StaticEdgeOps;
 		TArray<FPCGExHeuristicOperation*> DynamicEdgeOps;
 
@@ -9,6 +9,41 @@
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoNoise3D, UPCGExNoise3DFactoryData)
 
+namespace PCGExNoise3DFactoryInternal
+{
+	/** Appends the exported value of a property, resolving float curves to the keys they actually evaluate. */
+	void AppendPropertyIdentity(const FProperty* Property, const void* Container, FString& OutIdentity)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		if (!StructProperty)
+		{
+			Property->ExportText_InContainer(0, OutIdentity, Container, Container, nullptr, PPF_None);
+			return;
+		}
+
+		const void* StructData = StructProperty->ContainerPtrToValuePtr<void>(Container);
+
+		if (StructProperty->Struct == FRuntimeFloatCurve::StaticStruct())
+		{
+			// Exported text only names an external curve asset; editing that asset must change the identity too
+			const FRichCurve* Curve = static_cast<const FRuntimeFloatCurve*>(StructData)->GetRichCurveConst();
+			if (Curve)
+			{
+				FRichCurve::StaticStruct()->ExportText(OutIdentity, Curve, nullptr, nullptr, PPF_None, nullptr);
+			}
+			return;
+		}
+
+		OutIdentity.AppendChar(TEXT('('));
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			OutIdentity.AppendChar(TEXT(','));
+			AppendPropertyIdentity(*It, StructData, OutIdentity);
+		}
+		OutIdentity.AppendChar(TEXT(')'));
+	}
+}
+
 void FPCGExNoise3DConfigBase::Init()
 {
 	RemapLUT = RemapCurveLookup.MakeLookup(true, LocalRemapCurve, nullptr);
@@ -33,6 +68,26 @@ TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryData::CreateOperation(FPC
 	return Operation;
 }
 
+FString UPCGExNoise3DFactoryData::GetConfigIdentity() const
+{
+	FString Identity = GetClass()->GetName();
+
+	// Only properties declared by noise factories -- base data properties such as the UID change every execution
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (!Property->GetOwnerClass() || !Property->GetOwnerClass()->IsChildOf(UPCGExNoise3DFactoryData::StaticClass()))
+		{
+			continue;
+		}
+
+		Identity.AppendChar(TEXT('|'));
+		PCGExNoise3DFactoryInternal::AppendPropertyIdentity(Property, this, Identity);
+	}
+
+	return Identity;
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryData::CreateOperationInternal(FPCGExContext* InContext) const
 {
 	return nullptr;
@@ -32,6 +32,95 @@ double FPCGExNoise3DOperation::GenerateFractal(const FVector& Position) const
 	return Sum * FractalBounding;
 }
 
+void FPCGExNoise3DOperation::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutRaw[i] = GenerateRaw(FVector(X[i], Y[i], Z[i]));
+	}
+}
+
+void FPCGExNoise3DOperation::GenerateBatched(const FVector* Positions, const FVector& Offset, double* OutValues, const int32 OutStride, const int32 Count) const
+{
+	// Stack-sized chunks keep the SoA scratch in L1 regardless of batch size
+	constexpr int32 ChunkSize = 256;
+
+	double PX[ChunkSize];
+	double PY[ChunkSize];
+	double PZ[ChunkSize];
+	double SX[ChunkSize];
+	double SY[ChunkSize];
+	double SZ[ChunkSize];
+	double Raw[ChunkSize];
+	double Sum[ChunkSize];
+
+	const bool bOffset = !Offset.IsZero();
+
+	for (int32 ChunkStart = 0; ChunkStart < Count; ChunkStart += ChunkSize)
+	{
+		const int32 Num = FMath::Min(ChunkSize, Count - ChunkStart);
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const FVector P = TransformPosition(bOffset ? Positions[ChunkStart + i] + Offset : Positions[ChunkStart + i]);
+			PX[i] = P.X;
+			PY[i] = P.Y;
+			PZ[i] = P.Z;
+		}
+
+		// Same accumulation order as GenerateFractal
+		if (Octaves <= 1)
+		{
+			for (int32 i = 0; i < Num; ++i)
+			{
+				SX[i] = PX[i] * Frequency;
+				SY[i] = PY[i] * Frequency;
+				SZ[i] = PZ[i] * Frequency;
+			}
+
+			GenerateRawBatch(SX, SY, SZ, Sum, Num);
+		}
+		else
+		{
+			FMemory::Memzero(Sum, Num * sizeof(double));
+
+			double Amp = 1.0;
+			double Freq = Frequency;
+
+			for (int32 o = 0; o < Octaves; ++o)
+			{
+				for (int32 i = 0; i < Num; ++i)
+				{
+					SX[i] = PX[i] * Freq;
+					SY[i] = PY[i] * Freq;
+					SZ[i] = PZ[i] * Freq;
+				}
+
+				GenerateRawBatch(SX, SY, SZ, Raw, Num);
+
+				for (int32 i = 0; i < Num; ++i)
+				{
+					Sum[i] += Raw[i] * Amp;
+				}
+
+				Amp *= Persistence;
+				Freq *= Lacunarity;
+			}
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Sum[i] *= FractalBounding;
+			}
+		}
+
+		double* Out = OutValues + static_cast<int64>(ChunkStart) * OutStride;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Out[i * OutStride] = ApplyRemap(Sum[i]);
+		}
+	}
+}
+
 double FPCGExNoise3DOperation::GetDouble(const FVector& Position) const
 {
 	return ApplyRemap(GenerateFractal(TransformPosition(Position)));
@@ -66,6 +155,13 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
+
+	if (HasBatchRaw())
+	{
+		GenerateBatched(Positions.GetData(), FVector::ZeroVector, OutResults.GetData(), 1, Count);
+		return;
+	}
+
 	for (int32 i = 0; i < Count; ++i)
 	{
 		OutResults[i] = GetDouble(Positions[i]);
@@ -76,6 +172,15 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
+
+	if (HasBatchRaw())
+	{
+		// One pass per channel, same offsets as GetVector2D
+		GenerateBatched(Positions.GetData(), FVector::ZeroVector, &OutResults.GetData()->X, 2, Count);
+		GenerateBatched(Positions.GetData(), FVector(127.1, 311.7, 74.7), &OutResults.GetData()->Y, 2, Count);
+		return;
+	}
+
 	for (int32 i = 0; i < Count; ++i)
 	{
 		OutResults[i] = GetVector2D(Positions[i]);
@@ -86,6 +191,16 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
+
+	if (HasBatchRaw())
+	{
+		// One pass per channel, same offsets as GetVector
+		GenerateBatched(Positions.GetData(), FVector::ZeroVector, &OutResults.GetData()->X, 3, Count);
+		GenerateBatched(Positions.GetData(), FVector(127.1, 311.7, 74.7), &OutResults.GetData()->Y, 3, Count);
+		GenerateBatched(Positions.GetData(), FVector(269.5, 183.3, 246.1), &OutResults.GetData()->Z, 3, Count);
+		return;
+	}
+
 	for (int32 i = 0; i < Count; ++i)
 	{
 		OutResults[i] = GetVector(Positions[i]);
@@ -96,6 +211,17 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
+
+	if (HasBatchRaw())
+	{
+		// One pass per channel, same offsets as GetVector4
+		GenerateBatched(Positions.GetData(), FVector::ZeroVector, &OutResults.GetData()->X, 4, Count);
+		GenerateBatched(Positions.GetData(), FVector(127.1, 311.7, 74.7), &OutResults.GetData()->Y, 4, Count);
+		GenerateBatched(Positions.GetData(), FVector(269.5, 183.3, 246.1), &OutResults.GetData()->Z, 4, Count);
+		GenerateBatched(Positions.GetData(), FVector(419.2, 371.9, 168.2), &OutResults.GetData()->W, 4, Count);
+		return;
+	}
+
 	for (int32 i = 0; i < Count; ++i)
 	{
 		OutResults[i] = GetVector4(Positions[i]);
@@ -5,6 +5,8 @@
 #include "Core/PCGExMTCommon.h"
 #include "Core/PCGExNoise3DFactoryProvider.h"
 #include "Core/PCGExNoise3DOperation.h"
+#include "Helpers/PCGExNoiseLatticeCache.h"
+#include "PCGExNoise3DSubSystem.h"
 
 #define LOCTEXT_NAMESPACE "PCGExNoise3D"
 #define PCGEX_NAMESPACE Noise3D
@@ -26,6 +28,8 @@ namespace PCGExNoise3D
 		BlendModes.Reserve(Num);
 		BlendFactors.Reserve(Num);
 		TotalWeight = 0.0;
+		StackIdentity.Reset();
+		StackHash = 0;
 
 		for (const TObjectPtr<const UPCGExNoise3DFactoryData>& Factory : Factories)
 		{
@@ -45,8 +49,13 @@ namespace PCGExNoise3D
 
 			// Precompute blend factor: this operation's weight relative to accumulated total
 			BlendFactors.Add(Weight / TotalWeight);
+
+			StackIdentity.AppendChar(TEXT('\n'));
+			StackIdentity += Factory->GetConfigIdentity();
 		}
 
+		StackHash = GetTypeHash(StackIdentity);
+
 		return Operations.Num() > 0;
 	}
 
@@ -55,6 +64,25 @@ namespace PCGExNoise3D
 		return Init(InContext, Labels::SourceNoise3DLabel, bThrowError);
 	}
 
+	bool FNoiseGenerator::EnableLatticeCache(const double Spacing)
+	{
+		LatticeCache.Reset();
+
+		if (Operations.IsEmpty())
+		{
+			return false;
+		}
+
+		UPCGExNoise3DSubSystem* Subsystem = UPCGExNoise3DSubSystem::GetSubsystemForCurrentWorld();
+		if (!Subsystem)
+		{
+			return false;
+		}
+
+		LatticeCache = Subsystem->GetOrCreateLatticeCache(StackIdentity, StackHash, Spacing);
+		return LatticeCache.IsValid();
+	}
+
 	//
 	// Single-value blend implementation
 	//
@@ -333,6 +361,13 @@ namespace PCGExNoise3D
 			return 0.0;
 		}
 
+		if (LatticeCache)
+		{
+			double Result;
+			SampleLattice<double>(MakeArrayView(&Position, 1), MakeArrayView(&Result, 1));
+			return Result;
+		}
+
 		double Result = OperationsPtr[0]->GetDouble(Position);
 
 		for (int32 i = 1; i < Operations.Num(); ++i)
@@ -351,6 +386,13 @@ namespace PCGExNoise3D
 			return FVector2D::ZeroVector;
 		}
 
+		if (LatticeCache)
+		{
+			FVector2D Result;
+			SampleLattice<FVector2D>(MakeArrayView(&Position, 1), MakeArrayView(&Result, 1));
+			return Result;
+		}
+
 		FVector2D Result = OperationsPtr[0]->GetVector2D(Position);
 
 		for (int32 i = 1; i < Operations.Num(); ++i)
@@ -369,6 +411,13 @@ namespace PCGExNoise3D
 			return FVector::ZeroVector;
 		}
 
+		if (LatticeCache)
+		{
+			FVector Result;
+			SampleLattice<FVector>(MakeArrayView(&Position, 1), MakeArrayView(&Result, 1));
+			return Result;
+		}
+
 		FVector Result = OperationsPtr[0]->GetVector(Position);
 
 		for (int32 i = 1; i < Operations.Num(); ++i)
@@ -387,6 +436,13 @@ namespace PCGExNoise3D
 			return FVector4::Zero();
 		}
 
+		if (LatticeCache)
+		{
+			FVector4 Result;
+			SampleLattice<FVector4>(MakeArrayView(&Position, 1), MakeArrayView(&Result, 1));
+			return Result;
+		}
+
 		FVector4 Result = OperationsPtr[0]->GetVector4(Position);
 
 		for (int32 i = 1; i < Operations.Num(); ++i)
@@ -428,6 +484,18 @@ namespace PCGExNoise3D
 			return;
 		}
 
+		if (LatticeCache)
+		{
+			SampleLattice(Positions, OutResults);
+			return;
+		}
+
+		GenerateUncached(Positions, OutResults);
+	}
+
+	template <typename ValueType>
+	void FNoiseGenerator::GenerateUncached(const TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults) const
+	{
 		TArray<ValueType> Scratch;
 		if (Operations.Num() > 1)
 		{
@@ -437,6 +505,20 @@ namespace PCGExNoise3D
 		GenerateImpl<ValueType>(Positions, OutResults, Scratch);
 	}
 
+	template <typename ValueType>
+	void FNoiseGenerator::SampleLattice(const TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults) const
+	{
+		// Every supported value type is a packed run of doubles
+		constexpr int32 NumChannels = sizeof(ValueType) / sizeof(double);
+
+		LatticeCache->Sample(
+			NumChannels, Positions, reinterpret_cast<double*>(OutResults.GetData()),
+			[&](const TArrayView<const FVector> FillPositions, double* OutValues)
+			{
+				GenerateUncached<ValueType>(FillPositions, TArrayView<ValueType>(reinterpret_cast<ValueType*>(OutValues), FillPositions.Num()));
+			});
+	}
+
 	template <typename ValueType>
 	void FNoiseGenerator::GenerateParallelImpl(const TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults, const int32 MinBatchSize) const
 	{
@@ -449,6 +531,15 @@ namespace PCGExNoise3D
 			return;
 		}
 
+		if (LatticeCache)
+		{
+			PCGExMT::ParallelOrSequentialScoped(Count, [&](const PCGExMT::FScope& Scope)
+			{
+				SampleLattice(Positions.Slice(Scope.Start, Scope.Count), OutResults.Slice(Scope.Start, Scope.Count));
+			}, MinBatchSize * 2);
+			return;
+		}
+
 		// Single scratch allocation sliced per scope so every worker runs the batch path
 		TArray<ValueType> Scratch;
 		ValueType* ScratchData = nullptr;
@@ -0,0 +1,194 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExNoiseLatticeCache.h"
+
+#include "Helpers/PCGExNoise3DMath.h"
+
+namespace PCGExNoise3D
+{
+	FNoiseLatticeCache::FNoiseLatticeCache(const uint32 InStackHash, const double InSpacing, const int32 InMaxChunks)
+		: StackHash(InStackHash)
+		  , Spacing(FMath::Max(InSpacing, UE_KINDA_SMALL_NUMBER))
+		  , MaxChunks(FMath::Max(1, InMaxChunks))
+	{
+		InvSpacing = 1.0 / Spacing;
+	}
+
+	void FNoiseLatticeCache::Sample(const int32 NumChannels, const TArrayView<const FVector> Positions, double* OutValues, FFillFunc Fill)
+	{
+		check(NumChannels > 0 && NumChannels <= MaxChannels);
+
+		const uint32 Stamp = Epoch.fetch_add(1, std::memory_order_relaxed) + 1;
+
+		// Consecutive positions usually land in the same chunk, so keep the last one at hand
+		FIntVector CurrentCoord(MAX_int32);
+		FChunkPtr CurrentChunk;
+		const double* Samples = nullptr;
+
+		constexpr int32 StrideY = ChunkSamples;
+		constexpr int32 StrideZ = ChunkSamples * ChunkSamples;
+
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			const FVector L = Positions[i] * InvSpacing;
+
+			const int32 CX = PCGExNoise3D::Math::FastFloor(L.X);
+			const int32 CY = PCGExNoise3D::Math::FastFloor(L.Y);
+			const int32 CZ = PCGExNoise3D::Math::FastFloor(L.Z);
+
+			const FIntVector ChunkCoord(
+				FMath::FloorToInt32(static_cast<double>(CX) / ChunkCells),
+				FMath::FloorToInt32(static_cast<double>(CY) / ChunkCells),
+				FMath::FloorToInt32(static_cast<double>(CZ) / ChunkCells));
+
+			if (ChunkCoord != CurrentCoord)
+			{
+				CurrentCoord = ChunkCoord;
+				CurrentChunk = FindOrFillChunk(NumChannels, ChunkCoord, Fill);
+				CurrentChunk->LastUsed.store(Stamp, std::memory_order_relaxed);
+				Samples = CurrentChunk->Samples.GetData();
+			}
+
+			const double TX = L.X - CX;
+			const double TY = L.Y - CY;
+			const double TZ = L.Z - CZ;
+
+			const int32 Base = (CX - ChunkCoord.X * ChunkCells) + (CY - ChunkCoord.Y * ChunkCells) * StrideY + (CZ - ChunkCoord.Z * ChunkCells) * StrideZ;
+
+			const double* S000 = Samples + Base * NumChannels;
+			const double* S100 = S000 + NumChannels;
+			const double* S010 = S000 + StrideY * NumChannels;
+			const double* S110 = S010 + NumChannels;
+			const double* S001 = S000 + StrideZ * NumChannels;
+			const double* S101 = S001 + NumChannels;
+			const double* S011 = S001 + StrideY * NumChannels;
+			const double* S111 = S011 + NumChannels;
+
+			double* Out = OutValues + i * NumChannels;
+			for (int32 c = 0; c < NumChannels; c++)
+			{
+				const double X00 = PCGExNoise3D::Math::Lerp(S000[c], S100[c], TX);
+				const double X10 = PCGExNoise3D::Math::Lerp(S010[c], S110[c], TX);
+				const double X01 = PCGExNoise3D::Math::Lerp(S001[c], S101[c], TX);
+				const double X11 = PCGExNoise3D::Math::Lerp(S011[c], S111[c], TX);
+				Out[c] = PCGExNoise3D::Math::Lerp(
+					PCGExNoise3D::Math::Lerp(X00, X10, TY),
+					PCGExNoise3D::Math::Lerp(X01, X11, TY), TZ);
+			}
+		}
+	}
+
+	FNoiseLatticeCache::FChunkPtr FNoiseLatticeCache::FindOrFillChunk(const int32 NumChannels, const FIntVector& ChunkCoord, FFillFunc Fill)
+	{
+		TMap<FIntVector, FChunkPtr>& ChannelChunks = Chunks[NumChannels - 1];
+
+		{
+			FReadScopeLock ReadScopeLock(ChunksLock);
+			if (const FChunkPtr* Existing = ChannelChunks.Find(ChunkCoord))
+			{
+				return *Existing;
+			}
+		}
+
+		// Fill outside the lock; concurrent misses on the same chunk compute identical data and the first insert wins
+		TArray<FVector> LatticePositions;
+		LatticePositions.SetNumUninitialized(ChunkVolume);
+
+		const FIntVector Origin = ChunkCoord * ChunkCells;
+		int32 Index = 0;
+		for (int32 Z = 0; Z < ChunkSamples; Z++)
+		{
+			for (int32 Y = 0; Y < ChunkSamples; Y++)
+			{
+				for (int32 X = 0; X < ChunkSamples; X++)
+				{
+					LatticePositions[Index++] = FVector(Origin.X + X, Origin.Y + Y, Origin.Z + Z) * Spacing;
+				}
+			}
+		}
+
+		FChunkPtr NewChunk = MakeShared<FChunk, ESPMode::ThreadSafe>();
+		NewChunk->Samples.SetNumUninitialized(ChunkVolume * NumChannels);
+		Fill(LatticePositions, NewChunk->Samples.GetData());
+
+		{
+			FWriteScopeLock WriteScopeLock(ChunksLock);
+			if (const FChunkPtr* Existing = ChannelChunks.Find(ChunkCoord))
+			{
+				return *Existing;
+			}
+			ChannelChunks.Add(ChunkCoord, NewChunk);
+			TotalChunks++;
+
+			if (TotalChunks > MaxChunks)
+			{
+				// The new chunk is stamped by its caller right after; shield it until then
+				NewChunk->LastUsed.store(Epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				TrimUnsafe(MaxChunks - MaxChunks / 4);
+			}
+		}
+
+		return NewChunk;
+	}
+
+	int32 FNoiseLatticeCache::NumChunks() const
+	{
+		FReadScopeLock ReadScopeLock(ChunksLock);
+		return TotalChunks;
+	}
+
+	void FNoiseLatticeCache::TrimUnsafe(const int32 InMaxChunks)
+	{
+		if (TotalChunks <= InMaxChunks)
+		{
+			return;
+		}
+
+		TArray<uint32> Stamps;
+		Stamps.Reserve(TotalChunks);
+		for (const TMap<FIntVector, FChunkPtr>& ChannelChunks : Chunks)
+		{
+			for (const TPair<FIntVector, FChunkPtr>& Pair : ChannelChunks)
+			{
+				Stamps.Add(Pair.Value->LastUsed.load(std::memory_order_relaxed));
+			}
+		}
+
+		// Oldest stamps go first; chunks still held by a running Sample stay alive through their shared pointer
+		const int32 NumToRemove = TotalChunks - FMath::Max(0, InMaxChunks);
+		Stamps.Sort();
+		const uint32 Cutoff = Stamps[NumToRemove - 1];
+
+		// Stamps are coarse and often shared: everything older than the cutoff goes, but only as many
+		// chunks stamped with it as needed to reach the count
+		int32 NumAtCutoff = NumToRemove;
+		for (int32 i = 0; i < NumToRemove && Stamps[i] < Cutoff; i++)
+		{
+			NumAtCutoff--;
+		}
+
+		for (TMap<FIntVector, FChunkPtr>& ChannelChunks : Chunks)
+		{
+			for (auto It = ChannelChunks.CreateIterator(); It; ++It)
+			{
+				const uint32 LastUsed = It->Value->LastUsed.load(std::memory_order_relaxed);
+				if (LastUsed < Cutoff || (LastUsed == Cutoff && NumAtCutoff-- > 0))
+				{
+					It.RemoveCurrent();
+					TotalChunks--;
+				}
+			}
+		}
+	}
+
+	void FNoiseLatticeCache::Empty()
+	{
+		FWriteScopeLock WriteScopeLock(ChunksLock);
+		for (TMap<FIntVector, FChunkPtr>& ChannelChunks : Chunks)
+		{
+			ChannelChunks.Empty();
+		}
+		TotalChunks = 0;
+	}
+}
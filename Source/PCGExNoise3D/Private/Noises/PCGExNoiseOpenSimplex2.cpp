@@ -4,6 +4,7 @@
 #include "Noises/PCGExNoiseOpenSimplex2.h"
 #include "Containers/PCGExManagedObjects.h"
 #include "Helpers/PCGExNoise3DMath.h"
+#include "Helpers/PCGExNoise3DSimd.h"
 
 using namespace PCGExNoise3D::Math;
 using namespace PCGExOpenSimplex2;
@@ -59,6 +60,86 @@ double FPCGExNoiseOpenSimplex2::GenerateRaw(const FVector& Position) const
 	return Value / NORM_3D * 0.5 + 0.5;
 }
 
+void FPCGExNoiseOpenSimplex2::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const
+{
+	using namespace PCGExNoise3D::Simd;
+
+	// Lattice corners in GenerateRaw's accumulation order
+	constexpr int32 CornerX[8] = {0, 1, 0, 0, 1, 1, 0, 1};
+	constexpr int32 CornerY[8] = {0, 0, 1, 0, 1, 0, 1, 1};
+	constexpr int32 CornerZ[8] = {0, 0, 0, 1, 0, 1, 1, 1};
+
+	const FReg One = Splat(1.0);
+	const FReg Half = Splat(0.5);
+	const FReg Stretch[4] = {VectorZeroDouble(), Splat(STRETCH_3D), Splat(2 * STRETCH_3D), Splat(3 * STRETCH_3D)};
+
+	int32 i = 0;
+	for (; i + Lanes <= Count; i += Lanes)
+	{
+		const FReg PX = Load(X + i);
+		const FReg PY = Load(Y + i);
+		const FReg PZ = Load(Z + i);
+
+		// Skew input
+		const FReg S = Mul(Add(Add(PX, PY), PZ), Splat(SQUISH_3D));
+		const FReg XS = Add(PX, S);
+		const FReg YS = Add(PY, S);
+		const FReg ZS = Add(PZ, S);
+
+		int32 XSB[Lanes];
+		int32 YSB[Lanes];
+		int32 ZSB[Lanes];
+
+		const FReg XSI = Sub(XS, FloorToLattice(XS, XSB));
+		const FReg YSI = Sub(YS, FloorToLattice(YS, YSB));
+		const FReg ZSI = Sub(ZS, FloorToLattice(ZS, ZSB));
+
+		// Unskew
+		const FReg SQ = Mul(Add(Add(XSI, YSI), ZSI), Splat(STRETCH_3D));
+		const FReg DX0 = Add(XSI, SQ);
+		const FReg DY0 = Add(YSI, SQ);
+		const FReg DZ0 = Add(ZSI, SQ);
+
+		// Gradient gathers per lane
+		alignas(32) double GX[8][Lanes];
+		alignas(32) double GY[8][Lanes];
+		alignas(32) double GZ[8][Lanes];
+
+		for (int32 l = 0; l < Lanes; ++l)
+		{
+			for (int32 c = 0; c < 8; ++c)
+			{
+				const int32 GI = GradIndexTable.V[Hash3DSeed(XSB[l] + CornerX[c], YSB[l] + CornerY[c], ZSB[l] + CornerZ[c], Seed)];
+				GX[c][l] = Gradients3D[GI];
+				GY[c][l] = Gradients3D[GI + 1];
+				GZ[c][l] = Gradients3D[GI + 2];
+			}
+		}
+
+		FReg Value = VectorZeroDouble();
+		for (int32 c = 0; c < 8; ++c)
+		{
+			const FReg& KS = Stretch[CornerX[c] + CornerY[c] + CornerZ[c]];
+			const FReg DX = Sub(CornerX[c] ? Sub(DX0, One) : DX0, KS);
+			const FReg DY = Sub(CornerY[c] ? Sub(DY0, One) : DY0, KS);
+			const FReg DZ = Sub(CornerZ[c] ? Sub(DZ0, One) : DZ0, KS);
+
+			// Clamped attenuation zeroes the lanes Contrib would early-out on
+			FReg Attn = Falloff(2.0 / 3.0, DX, DY, DZ);
+			Attn = Mul(Attn, Attn);
+			Value = Add(Value, Mul(Mul(Attn, Attn), Dot3(Load(GX[c]), Load(GY[c]), Load(GZ[c]), DX, DY, DZ)));
+		}
+
+		Store(Add(Mul(VectorDivide(Value, Splat(NORM_3D)), Half), Half), OutRaw + i);
+	}
+
+	// Scalar tail
+	for (; i < Count; ++i)
+	{
+		OutRaw[i] = GenerateRaw(FVector(X[i], Y[i], Z[i]));
+	}
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryOpenSimplex2::CreateOperationInternal(FPCGExContext* InContext) const
 {
 	PCGEX_FACTORY_NEW_OPERATION(NoiseOpenSimplex2)
@@ -4,6 +4,7 @@
 #include "Noises/PCGExNoisePerlin.h"
 #include "Containers/PCGExManagedObjects.h"
 #include "Helpers/PCGExNoise3DMath.h"
+#include "Helpers/PCGExNoise3DSimd.h"
 
 using namespace PCGExNoise3D::Math;
 
@@ -12,6 +13,84 @@ double FPCGExNoisePerlin::GenerateRaw(const FVector& Position) const
 	return Perlin3D(Position, Seed) * 0.5 + 0.5;
 }
 
+void FPCGExNoisePerlin::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const
+{
+	using namespace PCGExNoise3D::Simd;
+
+	// Corner offsets, in the same AAA, BAA, ABA, BBA, AAB, BAB, ABB, BBB order Perlin3D interpolates them
+	constexpr int32 CornerX[8] = {0, 1, 0, 1, 0, 1, 0, 1};
+	constexpr int32 CornerY[8] = {0, 0, 1, 1, 0, 0, 1, 1};
+	constexpr int32 CornerZ[8] = {0, 0, 0, 0, 1, 1, 1, 1};
+
+	const FReg One = Splat(1.0);
+	const FReg Half = Splat(0.5);
+
+	int32 i = 0;
+	for (; i + Lanes <= Count; i += Lanes)
+	{
+		const FReg PX = Load(X + i);
+		const FReg PY = Load(Y + i);
+		const FReg PZ = Load(Z + i);
+
+		int32 X0[Lanes];
+		int32 Y0[Lanes];
+		int32 Z0[Lanes];
+
+		const FReg Xf = Sub(PX, FloorToLattice(PX, X0));
+		const FReg Yf = Sub(PY, FloorToLattice(PY, Y0));
+		const FReg Zf = Sub(PZ, FloorToLattice(PZ, Z0));
+
+		const FReg U = SmoothStep(Xf);
+		const FReg V = SmoothStep(Yf);
+		const FReg W = SmoothStep(Zf);
+
+		// Hash lookups are gathers; resolve them per lane, then dot all lanes at once
+		alignas(32) double GX[8][Lanes];
+		alignas(32) double GY[8][Lanes];
+		alignas(32) double GZ[8][Lanes];
+
+		for (int32 l = 0; l < Lanes; ++l)
+		{
+			const int32 X0S = (X0[l] + Seed) & 255;
+			for (int32 c = 0; c < 8; ++c)
+			{
+				const FVector& G = GetGrad3(Hash3D(X0S + CornerX[c], Y0[l] + CornerY[c], Z0[l] + CornerZ[c]));
+				GX[c][l] = G.X;
+				GY[c][l] = G.Y;
+				GZ[c][l] = G.Z;
+			}
+		}
+
+		const FReg Xf1 = Sub(Xf, One);
+		const FReg Yf1 = Sub(Yf, One);
+		const FReg Zf1 = Sub(Zf, One);
+
+		FReg G[8];
+		for (int32 c = 0; c < 8; ++c)
+		{
+			G[c] = Dot3(
+				Load(GX[c]), Load(GY[c]), Load(GZ[c]),
+				CornerX[c] ? Xf1 : Xf, CornerY[c] ? Yf1 : Yf, CornerZ[c] ? Zf1 : Zf);
+		}
+
+		const FReg X00 = Lerp(G[0], G[1], U);
+		const FReg X10 = Lerp(G[2], G[3], U);
+		const FReg X01 = Lerp(G[4], G[5], U);
+		const FReg X11 = Lerp(G[6], G[7], U);
+
+		const FReg XY0 = Lerp(X00, X10, V);
+		const FReg XY1 = Lerp(X01, X11, V);
+
+		Store(Add(Mul(Lerp(XY0, XY1, W), Half), Half), OutRaw + i);
+	}
+
+	// Scalar tail
+	for (; i < Count; ++i)
+	{
+		OutRaw[i] = GenerateRaw(FVector(X[i], Y[i], Z[i]));
+	}
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryPerlin::CreateOperationInternal(FPCGExContext* InContext) const
 {
 	PCGEX_FACTORY_NEW_OPERATION(NoisePerlin)
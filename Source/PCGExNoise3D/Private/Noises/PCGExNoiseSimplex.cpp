@@ -4,9 +4,78 @@
 #include "Noises/PCGExNoiseSimplex.h"
 #include "Containers/PCGExManagedObjects.h"
 #include "Helpers/PCGExNoise3DMath.h"
+#include "Helpers/PCGExNoise3DSimd.h"
 
 using namespace PCGExNoise3D::Math;
 
+namespace PCGExNoiseSimplex
+{
+	/** Offsets of the second and third simplex corners, from the position within the skewed cell */
+	FORCEINLINE void GetSimplexOffsets(const double X0, const double Y0, const double Z0, int32& I1, int32& J1, int32& K1, int32& I2, int32& J2, int32& K2)
+	{
+		if (X0 >= Y0)
+		{
+			if (Y0 >= Z0)
+			{
+				I1 = 1;
+				J1 = 0;
+				K1 = 0;
+				I2 = 1;
+				J2 = 1;
+				K2 = 0;
+			}
+			else if (X0 >= Z0)
+			{
+				I1 = 1;
+				J1 = 0;
+				K1 = 0;
+				I2 = 1;
+				J2 = 0;
+				K2 = 1;
+			}
+			else
+			{
+				I1 = 0;
+				J1 = 0;
+				K1 = 1;
+				I2 = 1;
+				J2 = 0;
+				K2 = 1;
+			}
+		}
+		else
+		{
+			if (Y0 < Z0)
+			{
+				I1 = 0;
+				J1 = 0;
+				K1 = 1;
+				I2 = 0;
+				J2 = 1;
+				K2 = 1;
+			}
+			else if (X0 < Z0)
+			{
+				I1 = 0;
+				J1 = 1;
+				K1 = 0;
+				I2 = 0;
+				J2 = 1;
+				K2 = 1;
+			}
+			else
+			{
+				I1 = 0;
+				J1 = 1;
+				K1 = 0;
+				I2 = 1;
+				J2 = 1;
+				K2 = 0;
+			}
+		}
+	}
+}
+
 double FPCGExNoiseSimplex::GenerateRaw(const FVector& Position) const
 {
 	// Skew input space to determine which simplex cell we're in
@@ -24,67 +93,7 @@ double FPCGExNoiseSimplex::GenerateRaw(const FVector& Position) const
 	// Determine which simplex we're in
 	int32 I1, J1, K1; // Offsets for second corner
 	int32 I2, J2, K2; // Offsets for third corner
-
-	if (X0 >= Y0)
-	{
-		if (Y0 >= Z0)
-		{
-			I1 = 1;
-			J1 = 0;
-			K1 = 0;
-			I2 = 1;
-			J2 = 1;
-			K2 = 0;
-		}
-		else if (X0 >= Z0)
-		{
-			I1 = 1;
-			J1 = 0;
-			K1 = 0;
-			I2 = 1;
-			J2 = 0;
-			K2 = 1;
-		}
-		else
-		{
-			I1 = 0;
-			J1 = 0;
-			K1 = 1;
-			I2 = 1;
-			J2 = 0;
-			K2 = 1;
-		}
-	}
-	else
-	{
-		if (Y0 < Z0)
-		{
-			I1 = 0;
-			J1 = 0;
-			K1 = 1;
-			I2 = 0;
-			J2 = 1;
-			K2 = 1;
-		}
-		else if (X0 < Z0)
-		{
-			I1 = 0;
-			J1 = 1;
-			K1 = 0;
-			I2 = 0;
-			J2 = 1;
-			K2 = 1;
-		}
-		else
-		{
-			I1 = 0;
-			J1 = 1;
-			K1 = 0;
-			I2 = 1;
-			J2 = 1;
-			K2 = 0;
-		}
-	}
+	PCGExNoiseSimplex::GetSimplexOffsets(X0, Y0, Z0, I1, J1, K1, I2, J2, K2);
 
 	// Offsets for remaining corners
 	const double X1 = X0 - I1 + G3;
@@ -119,6 +128,121 @@ double FPCGExNoiseSimplex::GenerateRaw(const FVector& Position) const
 	return 32.0 * (N0 + N1 + N2 + N3) * 0.5 + 0.5;
 }
 
+void FPCGExNoiseSimplex::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const
+{
+	using namespace PCGExNoise3D::Simd;
+
+	const FReg One = Splat(1.0);
+	const FReg Half = Splat(0.5);
+	const FReg VG3 = Splat(G3);
+	const FReg VG3x2 = Splat(2.0 * G3);
+	const FReg VG3x3 = Splat(3.0 * G3);
+
+	int32 i = 0;
+	for (; i + Lanes <= Count; i += Lanes)
+	{
+		const FReg PX = Load(X + i);
+		const FReg PY = Load(Y + i);
+		const FReg PZ = Load(Z + i);
+
+		// Skew, floor, unskew -- lanes stay in doubles, lattice coords go to ints for hashing
+		const FReg S = Mul(Add(Add(PX, PY), PZ), Splat(F3));
+
+		int32 I[Lanes];
+		int32 J[Lanes];
+		int32 K[Lanes];
+
+		const FReg FI = FloorToLattice(Add(PX, S), I);
+		const FReg FJ = FloorToLattice(Add(PY, S), J);
+		const FReg FK = FloorToLattice(Add(PZ, S), K);
+
+		const FReg T = Mul(Add(Add(FI, FJ), FK), VG3);
+		const FReg X0 = Sub(PX, Sub(FI, T));
+		const FReg Y0 = Sub(PY, Sub(FJ, T));
+		const FReg Z0 = Sub(PZ, Sub(FK, T));
+
+		alignas(32) double SX0[Lanes];
+		alignas(32) double SY0[Lanes];
+		alignas(32) double SZ0[Lanes];
+		Store(X0, SX0);
+		Store(Y0, SY0);
+		Store(Z0, SZ0);
+
+		// Simplex selection and hashing are per lane; everything else runs on all lanes at once
+		alignas(32) double O1[3][Lanes];
+		alignas(32) double O2[3][Lanes];
+		alignas(32) double GX[4][Lanes];
+		alignas(32) double GY[4][Lanes];
+		alignas(32) double GZ[4][Lanes];
+
+		for (int32 l = 0; l < Lanes; ++l)
+		{
+			int32 I1, J1, K1, I2, J2, K2;
+			PCGExNoiseSimplex::GetSimplexOffsets(SX0[l], SY0[l], SZ0[l], I1, J1, K1, I2, J2, K2);
+
+			O1[0][l] = I1;
+			O1[1][l] = J1;
+			O1[2][l] = K1;
+			O2[0][l] = I2;
+			O2[1][l] = J2;
+			O2[2][l] = K2;
+
+			const int32 II = (I[l] + Seed) & 255;
+			const int32 JJ = J[l] & 255;
+			const int32 KK = K[l] & 255;
+
+			const int32 Hashes[4] = {
+				Hash3D(II, JJ, KK),
+				Hash3D(II + I1, JJ + J1, KK + K1),
+				Hash3D(II + I2, JJ + J2, KK + K2),
+				Hash3D(II + 1, JJ + 1, KK + 1)
+			};
+
+			for (int32 c = 0; c < 4; ++c)
+			{
+				const FVector& G = GetGrad3(Hashes[c]);
+				GX[c][l] = G.X;
+				GY[c][l] = G.Y;
+				GZ[c][l] = G.Z;
+			}
+		}
+
+		const FReg X1 = Add(Sub(X0, Load(O1[0])), VG3);
+		const FReg Y1 = Add(Sub(Y0, Load(O1[1])), VG3);
+		const FReg Z1 = Add(Sub(Z0, Load(O1[2])), VG3);
+
+		const FReg X2 = Add(Sub(X0, Load(O2[0])), VG3x2);
+		const FReg Y2 = Add(Sub(Y0, Load(O2[1])), VG3x2);
+		const FReg Z2 = Add(Sub(Z0, Load(O2[2])), VG3x2);
+
+		const FReg X3 = Add(Sub(X0, One), VG3x3);
+		const FReg Y3 = Add(Sub(Y0, One), VG3x3);
+		const FReg Z3 = Add(Sub(Z0, One), VG3x3);
+
+		const FReg CX[4] = {X0, X1, X2, X3};
+		const FReg CY[4] = {Y0, Y1, Y2, Y3};
+		const FReg CZ[4] = {Z0, Z1, Z2, Z3};
+
+		FReg Sum = VectorZeroDouble();
+		for (int32 c = 0; c < 4; ++c)
+		{
+			// Clamped falloff zeroes the lanes Contrib would early-out on
+			const FReg T1 = Falloff(0.6, CX[c], CY[c], CZ[c]);
+			const FReg T2 = Mul(T1, T1);
+			const FReg N = Mul(Mul(T2, T2), Dot3(Load(GX[c]), Load(GY[c]), Load(GZ[c]), CX[c], CY[c], CZ[c]));
+			Sum = c == 0 ? N : Add(Sum, N);
+		}
+
+		Store(Add(Mul(Mul(Splat(32.0), Sum), Half), Half), OutRaw + i);
+	}
+
+	// Scalar tail
+	for (; i < Count; ++i)
+	{
+		OutRaw[i] = GenerateRaw(FVector(X[i], Y[i], Z[i]));
+	}
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactorySimplex::CreateOperationInternal(FPCGExContext* InContext) const
 {
 	PCGEX_FACTORY_NEW_OPERATION(NoiseSimplex)
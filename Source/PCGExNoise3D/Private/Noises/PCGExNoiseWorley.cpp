@@ -4,6 +4,7 @@
 #include "Noises/PCGExNoiseWorley.h"
 #include "Containers/PCGExManagedObjects.h"
 #include "Helpers/PCGExNoise3DMath.h"
+#include "Helpers/PCGExNoise3DSimd.h"
 
 using namespace PCGExNoise3D::Math;
 
@@ -66,32 +67,98 @@ double FPCGExNoiseWorley::GenerateRaw(const FVector& Position) const
 		return Hash32ToDouble01(Hash32(WinnerX + Seed, WinnerY, WinnerZ));
 	}
 
-	WF1 = FMath::Min(WF1 / MaxDist, 1.0);
-	WF2 = FMath::Min(WF2 / MaxDist, 1.0);
+	return ResolveDistances(WF1, WF2);
+}
+
+void FPCGExNoiseWorley::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const
+{
+	using namespace PCGExNoise3D::Simd;
 
-	double Result;
-	switch (ReturnType)
+	const FReg Infinity = Splat(TNumericLimits<double>::Max());
+
+	int32 i = 0;
+	for (; i + Lanes <= Count; i += Lanes)
 	{
-	case EPCGExWorleyReturnType::F1:
-		Result = WF1;
-		break;
-	case EPCGExWorleyReturnType::F2:
-		Result = WF2;
-		break;
-	case EPCGExWorleyReturnType::F2MinusF1:
-		Result = WF2 - WF1;
-		break;
-	case EPCGExWorleyReturnType::F1PlusF2:
-		Result = (WF1 + WF2) * 0.5;
-		break;
-	case EPCGExWorleyReturnType::F1TimesF2:
-		Result = WF1 * WF2;
-		break;
-	default:
-		Result = WF1;
+		const FReg PX = Load(X + i);
+		const FReg PY = Load(Y + i);
+		const FReg PZ = Load(Z + i);
+
+		int32 CellX[Lanes];
+		int32 CellY[Lanes];
+		int32 CellZ[Lanes];
+
+		FloorToLattice(PX, CellX);
+		FloorToLattice(PY, CellY);
+		FloorToLattice(PZ, CellZ);
+
+		FReg WF1 = Infinity;
+		FReg WF2 = Infinity;
+
+		// Search 3x3x3 neighborhood, same cell order as GenerateRaw
+		for (int32 DZ = -1; DZ <= 1; ++DZ)
+		{
+			for (int32 DY = -1; DY <= 1; ++DY)
+			{
+				for (int32 DX = -1; DX <= 1; ++DX)
+				{
+					// Feature points are hashed per lane
+					alignas(32) double FX[Lanes];
+					alignas(32) double FY[Lanes];
+					alignas(32) double FZ[Lanes];
+
+					for (int32 l = 0; l < Lanes; ++l)
+					{
+						const FVector FeaturePoint = GetCellPoint(CellX[l] + DX, CellY[l] + DY, CellZ[l] + DZ, Jitter, Seed);
+						FX[l] = FeaturePoint.X;
+						FY[l] = FeaturePoint.Y;
+						FZ[l] = FeaturePoint.Z;
+					}
+
+					const FReg OX = Sub(Load(FX), PX);
+					const FReg OY = Sub(Load(FY), PY);
+					const FReg OZ = Sub(Load(FZ), PZ);
+
+					FReg Dist;
+					switch (DistanceFunction)
+					{
+					default:
+					case EPCGExWorleyDistanceFunc::Euclidean:
+						Dist = Sqrt(Add(Add(Mul(OX, OX), Mul(OY, OY)), Mul(OZ, OZ)));
+						break;
+					case EPCGExWorleyDistanceFunc::EuclideanSq:
+						Dist = Add(Add(Mul(OX, OX), Mul(OY, OY)), Mul(OZ, OZ));
+						break;
+					case EPCGExWorleyDistanceFunc::Manhattan:
+						Dist = Add(Add(Abs(OX), Abs(OY)), Abs(OZ));
+						break;
+					case EPCGExWorleyDistanceFunc::Chebyshev:
+						Dist = Max(Max(Abs(OX), Abs(OY)), Abs(OZ));
+						break;
+					}
+
+					// Branchless equivalent of the scalar F1/F2 insertion
+					WF2 = Min(WF2, Max(WF1, Dist));
+					WF1 = Min(WF1, Dist);
+				}
+			}
+		}
+
+		alignas(32) double F1[Lanes];
+		alignas(32) double F2[Lanes];
+		Store(WF1, F1);
+		Store(WF2, F2);
+
+		for (int32 l = 0; l < Lanes; ++l)
+		{
+			OutRaw[i + l] = ResolveDistances(F1[l], F2[l]);
+		}
 	}
 
-	return Result;
+	// Scalar tail
+	for (; i < Count; ++i)
+	{
+		OutRaw[i] = GenerateRaw(FVector(X[i], Y[i], Z[i]));
+	}
 }
 
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryWorley::CreateOperationInternal(FPCGExContext* InContext) const
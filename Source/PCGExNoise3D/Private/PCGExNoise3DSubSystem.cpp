@@ -0,0 +1,150 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExNoise3DSubSystem.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Helpers/PCGExNoiseLatticeCache.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#else
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#endif
+
+namespace PCGExNoise3DCacheCVars
+{
+	TAutoConsoleVariable<int32> CVarMaxChunks(
+		TEXT("pcgex.NoiseCache.MaxChunks"),
+		4096,
+		TEXT("Chunk budget per PCGEx noise lattice cache (one chunk holds 9x9x9 samples). Applies to caches created afterward."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarMaxTotalChunks(
+		TEXT("pcgex.NoiseCache.MaxTotalChunks"),
+		16384,
+		TEXT("Chunk budget across all PCGEx noise lattice caches of a world. Past it, the least recently requested caches are dropped."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarMaxCaches(
+		TEXT("pcgex.NoiseCache.MaxCaches"),
+		32,
+		TEXT("Number of PCGEx noise lattice caches (one per noise stack and spacing) a world keeps around."),
+		ECVF_Default);
+}
+
+UPCGExNoise3DSubSystem::UPCGExNoise3DSubSystem()
+	: Super()
+{
+}
+
+void UPCGExNoise3DSubSystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+}
+
+void UPCGExNoise3DSubSystem::Deinitialize()
+{
+	ClearLatticeCaches();
+	Super::Deinitialize();
+}
+
+UPCGExNoise3DSubSystem* UPCGExNoise3DSubSystem::GetSubsystemForCurrentWorld()
+{
+	UWorld* World = nullptr;
+
+#if WITH_EDITOR
+	if (GEditor)
+	{
+		if (GEditor->PlayWorld)
+		{
+			World = GEditor->PlayWorld;
+		}
+		else
+		{
+			World = GEditor->GetEditorWorldContext().World();
+		}
+	}
+	else
+#endif
+		if (GEngine)
+		{
+			World = GEngine->GetCurrentPlayWorld();
+		}
+
+	return GetInstance(World);
+}
+
+UPCGExNoise3DSubSystem* UPCGExNoise3DSubSystem::GetInstance(UWorld* World)
+{
+	if (World)
+	{
+		return World->GetSubsystem<UPCGExNoise3DSubSystem>();
+	}
+	return nullptr;
+}
+
+TSharedPtr<PCGExNoise3D::FNoiseLatticeCache> UPCGExNoise3DSubSystem::GetOrCreateLatticeCache(const FString& StackIdentity, const uint32 StackHash, const double Spacing)
+{
+	FLatticeCacheKey Key;
+	Key.StackIdentity = StackIdentity;
+	Key.Spacing = Spacing;
+	Key.Hash = HashCombineFast(StackHash, GetTypeHash(Spacing));
+
+	// Requested once per sampler setup, not per sample: a write lock keeps the recency bookkeeping simple
+	FWriteScopeLock WriteScopeLock(LatticeCachesLock);
+
+	FLatticeCacheEntry& Entry = LatticeCaches.FindOrAdd(Key);
+	if (!Entry.Cache)
+	{
+		Entry.Cache = MakeShared<PCGExNoise3D::FNoiseLatticeCache>(StackHash, Spacing, PCGExNoise3DCacheCVars::CVarMaxChunks.GetValueOnAnyThread());
+	}
+	Entry.LastRequest = ++NumLatticeRequests;
+
+	TSharedPtr<PCGExNoise3D::FNoiseLatticeCache> Cache = Entry.Cache;
+	TrimLatticeCachesUnsafe(Key);
+
+	return Cache;
+}
+
+void UPCGExNoise3DSubSystem::TrimLatticeCachesUnsafe(const FLatticeCacheKey& KeepKey)
+{
+	const int32 MaxCaches = FMath::Max(1, PCGExNoise3DCacheCVars::CVarMaxCaches.GetValueOnAnyThread());
+	const int32 MaxTotalChunks = PCGExNoise3DCacheCVars::CVarMaxTotalChunks.GetValueOnAnyThread();
+
+	int32 TotalChunks = 0;
+	for (const TPair<FLatticeCacheKey, FLatticeCacheEntry>& Pair : LatticeCaches)
+	{
+		TotalChunks += Pair.Value.Cache->NumChunks();
+	}
+
+	while (LatticeCaches.Num() > 1 && (LatticeCaches.Num() > MaxCaches || TotalChunks > MaxTotalChunks))
+	{
+		// Samplers already holding the dropped cache keep it until they release it
+		const FLatticeCacheKey* OldestKey = nullptr;
+		uint64 OldestRequest = MAX_uint64;
+		for (const TPair<FLatticeCacheKey, FLatticeCacheEntry>& Pair : LatticeCaches)
+		{
+			if (Pair.Value.LastRequest < OldestRequest && !(Pair.Key == KeepKey))
+			{
+				OldestKey = &Pair.Key;
+				OldestRequest = Pair.Value.LastRequest;
+			}
+		}
+
+		if (!OldestKey)
+		{
+			break;
+		}
+
+		TotalChunks -= LatticeCaches[*OldestKey].Cache->NumChunks();
+		LatticeCaches.Remove(FLatticeCacheKey(*OldestKey));
+	}
+}
+
+void UPCGExNoise3DSubSystem::ClearLatticeCaches()
+{
+	FWriteScopeLock WriteScopeLock(LatticeCachesLock);
+	LatticeCaches.Empty();
+}
@@ -0,0 +1,155 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/PCGExNoise3DOperation.h"
+#include "Noises/PCGExNoiseOpenSimplex2.h"
+#include "Noises/PCGExNoisePerlin.h"
+#include "Noises/PCGExNoiseSimplex.h"
+#include "Noises/PCGExNoiseWorley.h"
+
+namespace PCGExNoise3DTests
+{
+	// Batch kernels may reorder floating point operations, so results are compared within a tolerance
+	constexpr double Tolerance = 1e-6;
+
+	// Deliberately not a multiple of the batch chunk size so the tail chunk is covered
+	constexpr int32 NumPositions = 1037;
+
+	static void BuildPositions(TArray<FVector>& OutPositions)
+	{
+		FRandomStream Stream(4242);
+		OutPositions.SetNumUninitialized(NumPositions);
+		for (int32 i = 0; i < NumPositions; i++)
+		{
+			OutPositions[i] = FVector(
+				Stream.FRandRange(-2048.0, 2048.0),
+				Stream.FRandRange(-2048.0, 2048.0),
+				Stream.FRandRange(-2048.0, 2048.0));
+		}
+
+		// Lattice boundaries are where rounding differences would show first
+		OutPositions[0] = FVector::ZeroVector;
+		OutPositions[1] = FVector(1.0, 1.0, 1.0);
+		OutPositions[2] = FVector(-1.0, 0.0, 1.0);
+	}
+
+	static void Configure(FPCGExNoise3DOperation& Noise, const int32 Octaves, const bool bTransform)
+	{
+		Noise.Seed = 1337;
+		Noise.Frequency = 0.0137;
+		Noise.Octaves = Octaves;
+		Noise.Lacunarity = 2.0;
+		Noise.Persistence = 0.5;
+		Noise.Contrast = 1.5;
+		Noise.bApplyTransform = bTransform;
+		Noise.Transform = FTransform(FRotator(17.0, 33.0, -8.0), FVector(12.5, -40.0, 3.0), FVector(1.0, 2.0, 0.5));
+	}
+
+	static double MaxError(const double A, const double B) { return FMath::Abs(A - B); }
+	static double MaxError(const FVector2D& A, const FVector2D& B) { return FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y)); }
+	static double MaxError(const FVector& A, const FVector& B) { return (A - B).GetAbsMax(); }
+
+	static double MaxError(const FVector4& A, const FVector4& B)
+	{
+		return FMath::Max(FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y)), FMath::Max(FMath::Abs(A.Z - B.Z), FMath::Abs(A.W - B.W)));
+	}
+
+	template <typename T, typename ScalarFunc>
+	static void CompareOutput(FAutomationTestBase& Test, const FString& Label, const FPCGExNoise3DOperation& Noise, const TArray<FVector>& Positions, ScalarFunc&& Scalar)
+	{
+		TArray<T> Batch;
+		Batch.SetNumUninitialized(Positions.Num());
+		Noise.Generate(Positions, Batch);
+
+		double WorstError = 0;
+		int32 WorstIndex = INDEX_NONE;
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			const double Error = MaxError(Batch[i], Scalar(Positions[i]));
+			if (!(Error <= WorstError))
+			{
+				WorstError = Error;
+				WorstIndex = i;
+			}
+		}
+
+		if (WorstIndex != INDEX_NONE && !(WorstError <= Tolerance))
+		{
+			Test.AddError(FString::Printf(TEXT("%s : batch output diverges from scalar by %g at %s"), *Label, WorstError, *Positions[WorstIndex].ToString()));
+		}
+	}
+
+	static void CompareNoise(FAutomationTestBase& Test, const FString& Name, FPCGExNoise3DOperation& Noise, const TArray<FVector>& Positions)
+	{
+		for (const int32 Octaves : {1, 5})
+		{
+			for (const bool bTransform : {false, true})
+			{
+				Configure(Noise, Octaves, bTransform);
+				Noise.PostInit();
+
+				const FString Label = FString::Printf(TEXT("%s (Octaves=%d, Transform=%d)"), *Name, Octaves, bTransform);
+				CompareOutput<double>(Test, Label + TEXT(" double"), Noise, Positions, [&](const FVector& P) { return Noise.GetDouble(P); });
+				CompareOutput<FVector2D>(Test, Label + TEXT(" Vector2D"), Noise, Positions, [&](const FVector& P) { return Noise.GetVector2D(P); });
+				CompareOutput<FVector>(Test, Label + TEXT(" Vector"), Noise, Positions, [&](const FVector& P) { return Noise.GetVector(P); });
+				CompareOutput<FVector4>(Test, Label + TEXT(" Vector4"), Noise, Positions, [&](const FVector& P) { return Noise.GetVector4(P); });
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExNoise3DBatchMatchesScalarTest,
+	"PCGEx.Noise3D.BatchMatchesScalar",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExNoise3DBatchMatchesScalarTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector> Positions;
+	PCGExNoise3DTests::BuildPositions(Positions);
+
+	{
+		const TSharedPtr<FPCGExNoisePerlin> Noise = MakeShared<FPCGExNoisePerlin>();
+		PCGExNoise3DTests::CompareNoise(*this, TEXT("Perlin"), *Noise, Positions);
+	}
+
+	{
+		const TSharedPtr<FPCGExNoiseSimplex> Noise = MakeShared<FPCGExNoiseSimplex>();
+		PCGExNoise3DTests::CompareNoise(*this, TEXT("Simplex"), *Noise, Positions);
+	}
+
+	{
+		const TSharedPtr<FPCGExNoiseOpenSimplex2> Noise = MakeShared<FPCGExNoiseOpenSimplex2>();
+		PCGExNoise3DTests::CompareNoise(*this, TEXT("OpenSimplex2"), *Noise, Positions);
+	}
+
+	const UEnum* DistanceEnum = StaticEnum<EPCGExWorleyDistanceFunc>();
+	const UEnum* ReturnEnum = StaticEnum<EPCGExWorleyReturnType>();
+
+	for (const EPCGExWorleyDistanceFunc DistanceFunction : {EPCGExWorleyDistanceFunc::Euclidean, EPCGExWorleyDistanceFunc::EuclideanSq, EPCGExWorleyDistanceFunc::Manhattan, EPCGExWorleyDistanceFunc::Chebyshev})
+	{
+		// CellValue stays on the scalar path and is compared anyway as a sanity check of the fallback
+		for (const EPCGExWorleyReturnType ReturnType : {EPCGExWorleyReturnType::F1, EPCGExWorleyReturnType::F2, EPCGExWorleyReturnType::F2MinusF1, EPCGExWorleyReturnType::F1PlusF2, EPCGExWorleyReturnType::F1TimesF2, EPCGExWorleyReturnType::CellValue})
+		{
+			const TSharedPtr<FPCGExNoiseWorley> Noise = MakeShared<FPCGExNoiseWorley>();
+			Noise->DistanceFunction = DistanceFunction;
+			Noise->ReturnType = ReturnType;
+			Noise->Jitter = 0.85;
+
+			const FString Name = FString::Printf(
+				TEXT("Worley %s/%s"),
+				*DistanceEnum->GetNameStringByValue(static_cast<int64>(DistanceFunction)),
+				*ReturnEnum->GetNameStringByValue(static_cast<int64>(ReturnType)));
+
+			PCGExNoise3DTests::CompareNoise(*this, Name, *Noise, Positions);
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif
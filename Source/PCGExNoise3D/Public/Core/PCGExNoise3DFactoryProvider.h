@@ -129,6 +129,9 @@ public:
 	/** Creates a fully initialized operation. Non-virtual so PostInit is guaranteed for every caller. */
 	TSharedPtr<FPCGExNoise3DOperation> CreateOperation(FPCGExContext* InContext) const;
 
+	/** Exact text of this noise's type and configuration; stable across executions, used to key lattice caches. */
+	FString GetConfigIdentity() const;
+
 protected:
 	virtual TSharedPtr<FPCGExNoise3DOperation> CreateOperationInternal(FPCGExContext* InContext) const;
 };
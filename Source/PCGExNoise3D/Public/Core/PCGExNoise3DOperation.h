@@ -123,6 +123,21 @@ protected:
 	{
 	}
 
+	/**
+	 * Whether GenerateRawBatch is implemented.
+	 * Enables the chunked batch path in Generate; only valid for noises relying on the base GetDouble.
+	 */
+	virtual bool HasBatchRaw() const
+	{
+		return false;
+	}
+
+	/**
+	 * SoA batch counterpart of GenerateRaw, for positions already in noise space and frequency-scaled.
+	 * Must produce the same values GenerateRaw would.
+	 */
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const;
+
 	/** Transform world position to noise space */
 	FORCEINLINE FVector TransformPosition(const FVector& Position) const
 	{
@@ -164,6 +179,12 @@ protected:
 	 */
 	double GenerateFractal(const FVector& Position) const;
 
+	/**
+	 * Batch equivalent of GetDouble(Positions[i] + Offset), chunked through GenerateRawBatch.
+	 * Results are written to OutValues[i * OutStride], so vector outputs can be filled one channel at a time.
+	 */
+	void GenerateBatched(const FVector* Positions, const FVector& Offset, double* OutValues, const int32 OutStride, const int32 Count) const;
+
 	/** Precomputed by PostInit */
 	double FractalBounding = 1.0;
 	bool bApplyContrast = false;
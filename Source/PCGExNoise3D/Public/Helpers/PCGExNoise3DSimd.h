@@ -0,0 +1,113 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+namespace PCGExNoise3D
+{
+	/**
+	 * 4-wide double helpers for batch noise kernels.
+	 * Built on UE's VectorRegister4Double, which maps to AVX/AVX2 or paired SSE registers depending on the
+	 * target, and to plain scalar math on platforms without vector intrinsics.
+	 * Each helper mirrors the operation order of its PCGExNoise3D::Math counterpart, so lanes reproduce
+	 * the scalar results (no fused multiply-add).
+	 */
+	namespace Simd
+	{
+		using FReg = VectorRegister4Double;
+
+		/** Lanes per register; batch kernels process this many positions per step and finish tails in scalar */
+		constexpr int32 Lanes = 4;
+
+		FORCEINLINE FReg Splat(const double V)
+		{
+			return VectorSetFloat1(V);
+		}
+
+		FORCEINLINE FReg Load(const double* Ptr)
+		{
+			return VectorLoad(Ptr);
+		}
+
+		FORCEINLINE void Store(const FReg& V, double* Ptr)
+		{
+			VectorStore(V, Ptr);
+		}
+
+		FORCEINLINE FReg Add(const FReg& A, const FReg& B)
+		{
+			return VectorAdd(A, B);
+		}
+
+		FORCEINLINE FReg Sub(const FReg& A, const FReg& B)
+		{
+			return VectorSubtract(A, B);
+		}
+
+		FORCEINLINE FReg Mul(const FReg& A, const FReg& B)
+		{
+			return VectorMultiply(A, B);
+		}
+
+		FORCEINLINE FReg Min(const FReg& A, const FReg& B)
+		{
+			return VectorMin(A, B);
+		}
+
+		FORCEINLINE FReg Max(const FReg& A, const FReg& B)
+		{
+			return VectorMax(A, B);
+		}
+
+		FORCEINLINE FReg Abs(const FReg& V)
+		{
+			return VectorAbs(V);
+		}
+
+		FORCEINLINE FReg Sqrt(const FReg& V)
+		{
+			return VectorSqrt(V);
+		}
+
+		/** A + T * (B - A) */
+		FORCEINLINE FReg Lerp(const FReg& A, const FReg& B, const FReg& T)
+		{
+			return Add(A, Mul(T, Sub(B, A)));
+		}
+
+		/** Quintic smoothstep, same order as Math::SmoothStep */
+		FORCEINLINE FReg SmoothStep(const FReg& T)
+		{
+			const FReg Inner = Add(Mul(T, Sub(Mul(T, Splat(6.0)), Splat(15.0))), Splat(10.0));
+			return Mul(Mul(Mul(T, T), T), Inner);
+		}
+
+		/** GX * X + GY * Y + GZ * Z */
+		FORCEINLINE FReg Dot3(const FReg& GX, const FReg& GY, const FReg& GZ, const FReg& X, const FReg& Y, const FReg& Z)
+		{
+			return Add(Add(Mul(GX, X), Mul(GY, Y)), Mul(GZ, Z));
+		}
+
+		/** Radius - X^2 - Y^2 - Z^2, clamped at zero so out-of-range corners contribute nothing */
+		FORCEINLINE FReg Falloff(const double Radius, const FReg& X, const FReg& Y, const FReg& Z)
+		{
+			return Max(Sub(Sub(Sub(Splat(Radius), Mul(X, X)), Mul(Y, Y)), Mul(Z, Z)), VectorZeroDouble());
+		}
+
+		/** Floors each lane, storing the result both as a register and as integer lattice coordinates */
+		FORCEINLINE FReg FloorToLattice(const FReg& V, int32 (&OutLattice)[Lanes])
+		{
+			const FReg Floored = VectorFloor(V);
+			alignas(32) double Tmp[Lanes];
+			Store(Floored, Tmp);
+			for (int32 l = 0; l < Lanes; ++l)
+			{
+				OutLattice[l] = static_cast<int32>(Tmp[l]);
+			}
+			return Floored;
+		}
+	}
+}
@@ -11,6 +11,8 @@ struct FPCGExContext;
 
 namespace PCGExNoise3D
 {
+	class FNoiseLatticeCache;
+
 	/**
 	 * Noise generator that combines multiple noise operations
 	 * Thread-safe after initialization
@@ -34,6 +36,13 @@ namespace PCGExNoise3D
 		/** Blend mode used for BlendResult in-place mode */
 		EPCGExNoiseBlendMode InPlaceBlendMode = EPCGExNoiseBlendMode::Blend;
 
+		/** Exact identity of the operation stack (types, configs, order), and its hash */
+		FString StackIdentity;
+		uint32 StackHash = 0;
+
+		/** When set, every sample goes through this lattice cache */
+		TSharedPtr<FNoiseLatticeCache> LatticeCache;
+
 	public:
 		FNoiseGenerator() = default;
 
@@ -91,6 +100,30 @@ namespace PCGExNoise3D
 			return InPlaceBlendMode;
 		}
 
+		uint32 GetStackHash() const
+		{
+			return StackHash;
+		}
+
+		const FString& GetStackIdentity() const
+		{
+			return StackIdentity;
+		}
+
+		/**
+		 * Route all sampling through a lattice cache shared across executions via UPCGExNoise3DSubSystem.
+		 * Values are exact on lattice points and trilinearly interpolated in between, so Spacing trades accuracy for reuse.
+		 * Call after Init, before sampling.
+		 * @param Spacing World distance between lattice points
+		 * @return false if no subsystem is available, in which case sampling stays uncached
+		 */
+		bool EnableLatticeCache(const double Spacing);
+
+		bool IsLatticeCached() const
+		{
+			return LatticeCache.IsValid();
+		}
+
 		//
 		// Single-point generation
 		//
@@ -126,6 +159,13 @@ namespace PCGExNoise3D
 		template <typename ValueType>
 		void GenerateTyped(TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults) const;
 
+		/** GenerateTyped bypassing the lattice cache; also what fills it */
+		template <typename ValueType>
+		void GenerateUncached(TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults) const;
+
+		template <typename ValueType>
+		void SampleLattice(TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults) const;
+
 		template <typename ValueType>
 		void GenerateParallelImpl(TArrayView<const FVector> Positions, TArrayView<ValueType> OutResults, int32 MinBatchSize) const;
 		//
@@ -0,0 +1,82 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace PCGExNoise3D
+{
+	/**
+	 * Noise samples snapped to a regular lattice, stored in chunks filled on demand.
+	 * Positions between lattice points are trilinearly interpolated from the 8 surrounding samples,
+	 * so results are exact on the lattice and an approximation elsewhere.
+	 * One cache serves one noise stack at one spacing; see UPCGExNoise3DSubSystem for sharing.
+	 * Thread-safe.
+	 */
+	class PCGEXNOISE3D_API FNoiseLatticeCache : public TSharedFromThis<FNoiseLatticeCache>
+	{
+	public:
+		/** Lattice cells per chunk axis */
+		static constexpr int32 ChunkCells = 8;
+
+		/** Samples per chunk axis; the far face is duplicated so a cell never straddles two chunks */
+		static constexpr int32 ChunkSamples = ChunkCells + 1;
+		static constexpr int32 ChunkVolume = ChunkSamples * ChunkSamples * ChunkSamples;
+
+		/** Highest channel count (FVector4) */
+		static constexpr int32 MaxChannels = 4;
+
+		/** Computes uncached noise for FillPositions, NumChannels doubles per position */
+		using FFillFunc = TFunctionRef<void(TArrayView<const FVector> FillPositions, double* OutValues)>;
+
+		/**
+		 * @param InSpacing World distance between lattice points
+		 * @param InMaxChunks Chunk budget; past it, the least recently sampled quarter is dropped
+		 */
+		FNoiseLatticeCache(const uint32 InStackHash, const double InSpacing, const int32 InMaxChunks);
+
+		uint32 GetStackHash() const { return StackHash; }
+		double GetSpacing() const { return Spacing; }
+
+		/**
+		 * Samples the cache, filling missing chunks through Fill.
+		 * @param NumChannels Doubles per value (1 to MaxChannels); each channel count has its own chunks
+		 * @param OutValues NumChannels doubles per position
+		 */
+		void Sample(const int32 NumChannels, TArrayView<const FVector> Positions, double* OutValues, FFillFunc Fill);
+
+		/** Chunks currently held, all channel counts combined */
+		int32 NumChunks() const;
+
+		void Empty();
+
+	protected:
+		struct FChunk
+		{
+			TArray<double> Samples;
+			std::atomic<uint32> LastUsed{0};
+		};
+
+		using FChunkPtr = TSharedPtr<FChunk, ESPMode::ThreadSafe>;
+
+		uint32 StackHash = 0;
+		double Spacing = 1.0;
+		double InvSpacing = 1.0;
+		int32 MaxChunks = 0;
+		int32 TotalChunks = 0;
+
+		mutable FRWLock ChunksLock;
+		TMap<FIntVector, FChunkPtr> Chunks[MaxChannels];
+
+		/** Bumped once per Sample call, stamped onto every chunk it touches */
+		std::atomic<uint32> Epoch{0};
+
+		FChunkPtr FindOrFillChunk(const int32 NumChannels, const FIntVector& ChunkCoord, FFillFunc Fill);
+
+		/** Drops the least recently sampled chunks until at most InMaxChunks remain. Expects ChunksLock held for write. */
+		void TrimUnsafe(const int32 InMaxChunks);
+	};
+}
@@ -79,6 +79,13 @@ public:
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
 
+	virtual bool HasBatchRaw() const override
+	{
+		return true;
+	}
+
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const override;
+
 private:
 	FORCEINLINE double Contrib(int32 XSV, int32 YSV, int32 ZSV, double DX, double DY, double DZ) const
 	{
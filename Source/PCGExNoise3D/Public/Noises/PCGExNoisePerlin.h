@@ -40,6 +40,13 @@ public:
 
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
+
+	virtual bool HasBatchRaw() const override
+	{
+		return true;
+	}
+
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const override;
 };
 
 ////
@@ -45,6 +45,13 @@ public:
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
 
+	virtual bool HasBatchRaw() const override
+	{
+		return true;
+	}
+
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const override;
+
 private:
 	/** Contribution from a simplex corner */
 	FORCEINLINE double Contrib(int32 Hash, double X, double Y, double Z) const
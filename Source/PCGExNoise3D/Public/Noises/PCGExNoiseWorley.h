@@ -71,10 +71,41 @@ public:
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
 
+	/** Cell values need the winning cell coordinates, which stay on the scalar path */
+	virtual bool HasBatchRaw() const override
+	{
+		return ReturnType != EPCGExWorleyReturnType::CellValue;
+	}
+
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutRaw, const int32 Count) const override;
+
 private:
 	/** Approximate normalization for the configured distance function, precomputed in PostInitDerived */
 	double MaxDist = 1.0;
 
+	/** Normalizes F1/F2 and combines them according to ReturnType (CellValue excluded) */
+	FORCEINLINE double ResolveDistances(double WF1, double WF2) const
+	{
+		WF1 = FMath::Min(WF1 / MaxDist, 1.0);
+		WF2 = FMath::Min(WF2 / MaxDist, 1.0);
+
+		switch (ReturnType)
+		{
+		case EPCGExWorleyReturnType::F1:
+			return WF1;
+		case EPCGExWorleyReturnType::F2:
+			return WF2;
+		case EPCGExWorleyReturnType::F2MinusF1:
+			return WF2 - WF1;
+		case EPCGExWorleyReturnType::F1PlusF2:
+			return (WF1 + WF2) * 0.5;
+		case EPCGExWorleyReturnType::F1TimesF2:
+			return WF1 * WF2;
+		default:
+			return WF1;
+		}
+	}
+
 	FORCEINLINE double CalcDistance(const FVector& A, const FVector& B) const
 	{
 		switch (DistanceFunction)
@@ -0,0 +1,76 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PCGExNoise3DSubSystem.generated.h"
+
+#define PCGEX_NOISE3D_SUBSYSTEM UPCGExNoise3DSubSystem* PCGExNoise3DSubsystem = UPCGExNoise3DSubSystem::GetSubsystemForCurrentWorld(); check(PCGExNoise3DSubsystem)
+
+namespace PCGExNoise3D
+{
+	class FNoiseLatticeCache;
+}
+
+UCLASS()
+class PCGEXNOISE3D_API UPCGExNoise3DSubSystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExNoise3DSubSystem();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** To be used when a PCG component can not have a world anymore, to unregister itself. */
+	static UPCGExNoise3DSubSystem* GetSubsystemForCurrentWorld();
+
+	/** Will return the subsystem from the World if it exists and if it is initialized */
+	static UPCGExNoise3DSubSystem* GetInstance(UWorld* World);
+
+	/**
+	 * Lattice cache for a noise stack at a given spacing, created on first request.
+	 * Caches outlive the executions that fill them, so unchanged stacks resample for free. Thread-safe.
+	 * Past the global cache and chunk budgets, the least recently requested caches are dropped.
+	 */
+	TSharedPtr<PCGExNoise3D::FNoiseLatticeCache> GetOrCreateLatticeCache(const FString& StackIdentity, const uint32 StackHash, const double Spacing);
+
+	/** Drops every lattice cache. Samplers already holding one keep it until they release it. */
+	void ClearLatticeCaches();
+
+protected:
+	/** Full stack identity and exact spacing; the hash only buckets, equality decides. */
+	struct FLatticeCacheKey
+	{
+		FString StackIdentity;
+		double Spacing = 1.0;
+		uint32 Hash = 0;
+
+		bool operator==(const FLatticeCacheKey& Other) const
+		{
+			return Hash == Other.Hash && Spacing == Other.Spacing && StackIdentity.Equals(Other.StackIdentity, ESearchCase::CaseSensitive);
+		}
+
+		friend uint32 GetTypeHash(const FLatticeCacheKey& Key)
+		{
+			return Key.Hash;
+		}
+	};
+
+	struct FLatticeCacheEntry
+	{
+		TSharedPtr<PCGExNoise3D::FNoiseLatticeCache> Cache;
+		uint64 LastRequest = 0;
+	};
+
+	FRWLock LatticeCachesLock;
+	TMap<FLatticeCacheKey, FLatticeCacheEntry> LatticeCaches;
+	uint64 NumLatticeRequests = 0;
+
+	/** Drops the least recently requested caches, other than KeepKey, until both budgets hold. Expects LatticeCachesLock held for write. */
+	void TrimLatticeCachesUnsafe(const FLatticeCacheKey& KeepKey);
+};
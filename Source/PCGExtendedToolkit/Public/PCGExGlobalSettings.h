@@ -56,6 +56,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bUseDelaunator = true;
 
+	/** Delaunay inputs with at least this many points are processed in parallel -- strips in 2D, overlapping tiles in 3D -- and stitched together. 0 disables. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=0))
+	int32 ParallelDelaunayMinPoints = 250000;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=1))
 	int32 SmallClusterSize = 512;
 